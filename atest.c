@@ -81,6 +81,8 @@
 #include "dlq.h"
 #include "ptt.h"
 #include "dtime_now.h"
+#include "fsk_demod_state.h"
+#include "dsp.h"
 
 
 
@@ -170,7 +172,7 @@ static void usage (void);
 static int decode_only = 0;		/* Set to 0 or 1 to decode only one channel.  2 for both.  */
 
 static int sample_number = -1;		/* Sample number from the file. */
-					/* Incremented only for channel 0. */
+					/* Last sample of the previous block processed. */
 					/* Use to print timestamp, relative to beginning */
 					/* of file, when frame was decoded. */
 
@@ -286,7 +288,7 @@ int main (int argc, char *argv[])
 
 	  /* ':' following option character means arg is required. */
 
-          c = getopt_long(argc, argv, "B:P:D:F:L:G:012",
+          c = getopt_long(argc, argv, "B:P:D:F:L:G:j:J:K:I012",
                         long_options, &option_index);
           if (c == -1)
             break;
@@ -384,6 +386,44 @@ int main (int argc, char *argv[])
 	      }
 	      break;	
 
+	    case 'j':				/* -j number of threads for demodulators. */
+
+	      my_audio_config.achan[0].demod_threads = atoi(optarg);
+
+	      if (my_audio_config.achan[0].demod_threads < 1 || my_audio_config.achan[0].demod_threads > MAX_SUBCHANS) {
+		text_color_set(DW_COLOR_ERROR);
+		dw_printf ("Invalid number of demodulator threads.\n");
+		exit (EXIT_FAILURE);
+	      }
+	      break;
+
+	    case 'J':				/* -J number of threads for fixing frames. */
+
+	      my_audio_config.achan[0].fix_threads = atoi(optarg);
+
+	      if (my_audio_config.achan[0].fix_threads < 1 || my_audio_config.achan[0].fix_threads > MAX_FIX_THREADS) {
+		text_color_set(DW_COLOR_ERROR);
+		dw_printf ("Invalid number of threads for fixing frames.\n");
+		exit (EXIT_FAILURE);
+	      }
+	      break;
+
+	    case 'K':				/* -K fix up budget. */
+
+	      my_audio_config.achan[0].fix_budget = atoi(optarg);
+
+	      if (my_audio_config.achan[0].fix_budget < 0 || my_audio_config.achan[0].fix_budget > MAX_FIX_BUDGET) {
+		text_color_set(DW_COLOR_ERROR);
+		dw_printf ("Invalid fix up budget.\n");
+		exit (EXIT_FAILURE);
+	      }
+	      break;
+
+	    case 'I':				/* -I integer (fixed point) arithmetic. */
+
+	      my_audio_config.achan[0].fixed_point = 1;
+	      break;
+
 	    case 'L':				/* -L error if less than this number decoded. */
 
 	      error_if_less_than = atoi(optarg);
@@ -521,6 +561,7 @@ int main (int argc, char *argv[])
 		(int)(wav_data.datasize),
 		duration);
 	dw_printf ("Fix Bits level = %d\n", my_audio_config.achan[0].fix_bits);
+	dw_printf ("Using %s FIR filter kernels.\n", dsp_kernel_name());
 		
 /*
  * Initialize the AFSK demodulator and HDLC decoder.
@@ -533,30 +574,29 @@ int main (int argc, char *argv[])
 	{
 
 
-          int audio_sample;
+          int16_t samples[2][DEMOD_BLOCK_SIZE];
+          int n;
           int c;
 
-          for (c=0; c<my_audio_config.adev[0].num_channels; c++)
-          {
-
-            /* This reads either 1 or 2 bytes depending on */
-            /* bits per sample.  */
-
-            audio_sample = demod_get_sample (ACHAN2ADEV(c));
+          /* This reads either 1 or 2 bytes depending on */
+          /* bits per sample.  */
 
-            if (audio_sample >= 256 * 256) {
-               e_o_f = 1;
-	       continue;
-	    }
+          n = demod_get_block (ACHAN2ADEV(0), my_audio_config.adev[0].num_channels, samples);
 
-	    if (c == 0) sample_number++;
+          if (n < DEMOD_BLOCK_SIZE) {
+            e_o_f = 1;
+	  }
 
+          for (c=0; c<my_audio_config.adev[0].num_channels; c++)
+          {
             if (decode_only == 0 && c != 0) continue;
             if (decode_only == 1 && c != 1) continue;
 
-            multi_modem_process_sample(c,audio_sample);
+            multi_modem_process_block(c, samples[c], n);
           }
 
+          sample_number += n;
+
                 /* When a complete frame is accumulated, */
                 /* process_rec_frame, below, is called. */
 
@@ -690,7 +730,11 @@ void dlq_rec_frame (int chan, int subchan, int slice, packet_t pp, alevel_t alev
 
 	/* Insert time stamp relative to start of file. */
 
-	double sec = (double)sample_number / my_audio_config.adev[0].samples_per_sec;
+	/* sample_number is the last one of the previous block. */
+	/* When more than one decoder is used for a channel, frames are */
+	/* delivered at the end of the block so this is less precise. */
+
+	double sec = (double)(sample_number + 1 + demod_get_block_pos(chan, subchan)) / my_audio_config.adev[0].samples_per_sec;
 	int min = (int)(sec / 60.);
 	sec -= min * 60;
 
@@ -807,8 +851,16 @@ static void usage (void) {
 	dw_printf ("               1 = Try to fix only a single bit.  \n");
 	dw_printf ("               more = Try modifying more bits to get a good CRC.\n");
 	dw_printf ("\n");
+	dw_printf ("        -I     Use fixed point rather than floating point arithmetic.\n");
+	dw_printf ("\n");
+	dw_printf ("        -j n   Spread the demodulators over n threads.\n");
+	dw_printf ("\n");
+	dw_printf ("        -J n   Share the search for two separated bits (-F 4) among n threads.\n");
+	dw_printf ("\n");
+	dw_printf ("        -K n   Try fixing only the n least confident bits or groups of bits.\n");
+	dw_printf ("\n");
 	dw_printf ("        -P m   Select  the  demodulator  type such as A, B, C, D (default for 300 baud),\n");
-	dw_printf ("               E (default for 1200 baud), F, A+, B+, C+, D+, E+, F+.\n");
+	dw_printf ("               E (default for 1200 baud), F, H, A+, B+, C+, D+, E+, F+, H+.\n");
 	dw_printf ("\n");
 	dw_printf ("        -0     Use channel 0 (left) of stereo audio (default).\n");
 	dw_printf ("        -1     use channel 1 (right) of stereo audio.\n");
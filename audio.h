@@ -79,6 +79,10 @@ struct audio_s {
 	    int samples_per_sec;	/* Audio sampling rate.  Typically 11025, 22050, or 44100. */
 	    int bits_per_sample;	/* 8 (unsigned char) or 16 (signed short). */
 
+	    int split_channels;		/* Version 1.5: Demodulate left and right channels */
+					/* of stereo device in separate threads so a */
+					/* heavy load on one doesn't delay the other. */
+
 	} adev[MAX_ADEVS];
 
 
@@ -163,6 +167,14 @@ struct audio_s {
 
 	    int num_subchan;		/* Total number of modems for each channel. */
 
+	    int demod_threads;		/* Number of threads, including the audio receive */
+					/* thread, sharing the work of the demodulators. */
+					/* 0 or 1 means don't use any extra threads. */
+
+	    int fixed_point;		/* Version 1.5: Demodulate with integer rather than */
+					/* floating point arithmetic.  For processors without */
+					/* floating point hardware. */
+
 
 	/* These are for dealing with imperfect frames. */
 
@@ -172,6 +184,17 @@ struct audio_s {
 					/* 1 = try fixing a single bit */
 					/* 2... = more techniques... */
 
+	    int fix_budget;		/* Version 1.5:  If non-zero, try only this many of */
+					/* the least confident bit positions for each technique. */
+
+	    int fix_threads;		/* Version 1.5:  Number of threads, including the */
+					/* one receiving the frame, sharing the work of */
+					/* fixing two separated bits.  1 for no extra. */
+
+	    int governor;		/* Version 1.5:  Percent of real time allowed for */
+					/* demodulating and fixing before we start giving */
+					/* up marginal work.  0 for no limit. */
+
 	    enum sanity_e sanity_test;	/* Sanity test to apply when finding a good */
 					/* CRC after making a change. */
 					/* Must look like APRS, AX.25, or anything. */
@@ -290,6 +313,9 @@ struct audio_s {
 
 	    int fulldup;		/* Full Duplex. */
 
+	    int txqueue_limit;		/* Version 1.5:  Client applications wait when this */
+					/* many frames are in the transmit queue.  0 for no limit. */
+
 	} achan[MAX_CHANS];
 
 #ifdef USE_HAMLIB
@@ -343,6 +369,8 @@ struct audio_s {
 
 #define DEFAULT_FIX_BITS RETRY_INVERT_SINGLE
 
+#define DEFAULT_GOVERNOR 90
+
 /* 
  * Standard for AFSK on VHF FM. 
  * Reversing mark and space makes no difference because
@@ -376,6 +404,7 @@ struct audio_s {
 #define DEFAULT_TXDELAY		30
 #define DEFAULT_TXTAIL		10	
 #define DEFAULT_FULLDUP		0
+#define DEFAULT_TXQUEUE_LIMIT	50
 
 /* 
  * Note that we have two versions of these in audio.c and audio_win.c.
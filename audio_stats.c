@@ -67,6 +67,9 @@
 #include "textcolor.h"
 #include "dtime_now.h"
 #include "demod.h"		/* for alevel_t & demod_get_audio_level() */
+#include "multi_modem.h"	/* for multi_modem_get_load() */
+#include "dlq.h"		/* for dlq_get_stats() */
+#include "ax25_pad.h"		/* for ax25_get_alloc_stats() */
 
 
 
@@ -152,6 +155,7 @@ void audio_stats (int adev, int nchan, int nsamp, int interval)
 	    }
 	    else {
 	      float ave_rate = (sample_count[adev] / 1000.0) / interval;
+	      int n;
 
 	      text_color_set(DW_COLOR_DEBUG);
 
@@ -161,16 +165,60 @@ void audio_stats (int adev, int nchan, int nsamp, int interval)
 	        int ch1 = ADEVFIRSTCHAN(adev) + 1;
 	        alevel_t alevel1 = demod_get_audio_level(ch1,0);
 
-	        dw_printf ("\nADEVICE%d: Sample rate approx. %.1f k, %d errors, receive audio levels CH%d %d, CH%d %d\n\n", 
+	        dw_printf ("\nADEVICE%d: Sample rate approx. %.1f k, %d errors, receive audio levels CH%d %d, CH%d %d\n", 
 			adev, ave_rate, error_count[adev], ch0, alevel0.rec, ch1, alevel1.rec);
 	      }
 	      else {
 	        int ch0 = ADEVFIRSTCHAN(adev);
 	        alevel_t alevel0 = demod_get_audio_level(ch0,0);
 
-	        dw_printf ("\nADEVICE%d: Sample rate approx. %.1f k, %d errors, receive audio level CH%d %d\n\n", 
+	        dw_printf ("\nADEVICE%d: Sample rate approx. %.1f k, %d errors, receive audio level CH%d %d\n", 
 			adev, ave_rate, error_count[adev], ch0, alevel0.rec);
 	      }
+
+	      /* Version 1.5:  How hard we are working.  See governor in multi_modem.c. */
+
+	      for (n = 0; n < nchan; n++) {
+	        int ch = ADEVFIRSTCHAN(adev) + n;
+	        int fix_bits, fix_reduced, slicers, slicers_reduced;
+	        int load = multi_modem_get_load (ch, &fix_bits, &fix_reduced, &slicers, &slicers_reduced);
+
+	        if (load >= 0) {
+	          char slicer_text[40];
+
+	          if (slicers_reduced) {
+	            snprintf (slicer_text, sizeof(slicer_text), "slicers reduced to %d", slicers);
+	          }
+	          else {
+	            snprintf (slicer_text, sizeof(slicer_text), "%d slicer%s", slicers, slicers == 1 ? "" : "s");
+	          }
+	          dw_printf ("CH%d processing load %d%% of real time, FIX_BITS %s%d, %s\n",
+			ch, load, fix_reduced ? "reduced to " : "", fix_bits, slicer_text);
+	        }
+	      }
+
+	      /* Version 1.5:  Received frame queue is shared by all.  Only if it's backing up. */
+
+	      if (adev == 0) {
+	        int depth, peak, overflow;
+
+	        dlq_get_stats (&depth, &peak, &overflow);
+	        if (peak > 10 || overflow > 0) {
+	          dw_printf ("Received frame queue: %d waiting, most %d, %d discarded since start\n", depth, peak, overflow);
+	        }
+
+	        /* Packet objects only when more had to be taken from the heap. */
+
+	        static int last_heap = 0;
+	        int in_use, most_in_use, heap;
+
+	        ax25_get_alloc_stats (&in_use, &most_in_use, &heap);
+	        if (heap > last_heap) {
+	          dw_printf ("Packet objects: %d in use, most %d, %d allocated\n", in_use, most_in_use, heap);
+	          last_heap = heap;
+	        }
+	      }
+	      dw_printf ("\n");
 	    }
 	    last_time[adev] = this_time[adev];
 	    sample_count[adev] = 0;
@@ -186,12 +186,89 @@ char *strtok_r(char *str, const char *delim, char **saveptr);
  * Accumulate statistics.
  * If new_count gets much larger than delete_count plus the size of 
  * the transmit queue we have a memory leak.
+ *
+ * Version 1.5:  These are always kept, with atomic updates, because
+ * there is now more than one thread creating and deleting packets.
+ * We also keep track of the most in use at the same time and how
+ * many had to come from the heap.
  */
 
 static volatile int new_count = 0;
 static volatile int delete_count = 0;
 static volatile int last_seq_num = 0;
 
+static volatile int peak_in_use = 0;
+static volatile int heap_count = 0;
+
+
+/*
+ * Version 1.5:  Deleted packet objects are kept for reuse.
+ *
+ * Every decoded candidate frame, ax25_dup, beacon, and IGate line
+ * used to be a calloc and free of a couple kilobytes.
+ *
+ * Each thread has its own small cache of free packet objects so
+ * the usual case of creating and deleting in the same thread needs
+ * no locking at all.  Packets are often created in one thread
+ * (receive) and deleted in another (transmit, app), so the caches
+ * would become lopsided.  When a thread's cache gets too big, a batch
+ * of PKT_BATCH is moved to the global depot.  When a thread's cache
+ * is empty, it takes a whole batch from the depot.  Only the depot
+ * needs a lock and it is held just long enough to move a pointer.
+ *
+ * The depot is limited so the memory goes back to the heap after an
+ * unusual burst.  Packets cached by a thread that goes away are lost
+ * but our threads normally last as long as the application.
+ */
+
+#define PKT_BATCH 16			/* Packets moved between a thread cache and the depot at once. */
+#define PKT_DEPOT_BATCHES 32		/* Maximum batches kept in the depot. */
+
+static __thread struct packet_s *cache_list = NULL;	/* Linked with nextp. */
+static __thread int cache_count = 0;
+
+static struct packet_s *depot[PKT_DEPOT_BATCHES];	/* Each a list of PKT_BATCH. */
+static int depot_count = 0;
+
+/*
+ * Packets can be created before anything else is initialized so the
+ * lock must not need an init function.  A Windows critical section
+ * can't be set up statically so there we spin, giving up the rest of
+ * the time slice so a lock holder that was preempted can finish.
+ */
+
+#if __WIN32__
+
+static char depot_lock = 0;
+
+static void depot_acquire (void)
+{
+	while (__atomic_test_and_set (&depot_lock, __ATOMIC_ACQUIRE)) {
+	  SwitchToThread ();
+	}
+}
+
+static void depot_release (void)
+{
+	__atomic_clear (&depot_lock, __ATOMIC_RELEASE);
+}
+
+#else
+
+static dw_mutex_t depot_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void depot_acquire (void)
+{
+	dw_mutex_lock (&depot_mutex);
+}
+
+static void depot_release (void)
+{
+	dw_mutex_unlock (&depot_mutex);
+}
+
+#endif
+
 #if AX25MEMDEBUG
 
 int ax25memdebug = 0;
@@ -243,8 +320,15 @@ packet_t ax25_new (void)
         dw_printf ("ax25_new(): before alloc, new=%d, delete=%d\n", new_count, delete_count);
 #endif
 
-	last_seq_num++;
-	new_count++;
+	int seq = __atomic_add_fetch (&last_seq_num, 1, __ATOMIC_RELAXED);
+	int in_use = __atomic_add_fetch (&new_count, 1, __ATOMIC_RELAXED) -
+			__atomic_load_n (&delete_count, __ATOMIC_RELAXED);
+
+	int peak = __atomic_load_n (&peak_in_use, __ATOMIC_RELAXED);
+	while (in_use > peak &&
+		! __atomic_compare_exchange_n (&peak_in_use, &peak, in_use, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+	  ;
+	}
 
 /*
  * check for memory leak.
@@ -253,7 +337,7 @@ packet_t ax25_new (void)
 // version 1.4 push up the threshold.   We could have considerably more with connected mode.
 
 	//if (new_count > delete_count + 100) {
-	if (new_count > delete_count + 256) {
+	if (in_use > 256) {
 
 
 	  text_color_set(DW_COLOR_ERROR);
@@ -264,17 +348,37 @@ packet_t ax25_new (void)
 #endif
 	}
 
-	this_p = calloc(sizeof (struct packet_s), (size_t)1);
+	if (cache_list == NULL) {
+	  depot_acquire ();
+	  if (depot_count > 0) {
+	    depot_count--;
+	    cache_list = depot[depot_count];
+	    cache_count = PKT_BATCH;
+	  }
+	  depot_release ();
+	}
 
-	if (this_p == NULL) {
-	  text_color_set(DW_COLOR_ERROR);
-	  dw_printf ("ERROR - can't allocate memory in ax25_new.\n");
+	if (cache_list != NULL) {
+	  this_p = cache_list;
+	  cache_list = this_p->nextp;
+	  cache_count--;
+	  memset (this_p, 0, sizeof (struct packet_s));
+	}
+	else {
+	  this_p = calloc(sizeof (struct packet_s), (size_t)1);
+
+	  if (this_p == NULL) {
+	    text_color_set(DW_COLOR_ERROR);
+	    dw_printf ("ERROR - can't allocate memory in ax25_new.\n");
+	  }
+	  __atomic_add_fetch (&heap_count, 1, __ATOMIC_RELAXED);
 	}
 
 	assert (this_p != NULL);
 
 	this_p->magic1 = MAGIC;
-	this_p->seq = last_seq_num;
+	this_p->seq = seq;
+	this_p->refcnt = 1;
 	this_p->magic2 = MAGIC;
 	this_p->num_addr = (-1);
 
@@ -306,8 +410,23 @@ void ax25_delete (packet_t this_p)
 	  return;
 	}
 
+	assert (this_p->magic1 == MAGIC);
+	assert (this_p->magic2 == MAGIC);
 
-	delete_count++;
+/*
+ * Version 1.5:  This might be only one of several references.
+ */
+	if (__atomic_sub_fetch (&(this_p->refcnt), 1, __ATOMIC_ACQ_REL) > 0) {
+#if AX25MEMDEBUG	
+	  if (ax25memdebug) {
+	    text_color_set(DW_COLOR_DEBUG);
+	    dw_printf ("ax25_delete, seq=%d, called from %s %d, %d references remain\n", this_p->seq, src_file, src_line, this_p->refcnt);
+	  }
+#endif
+	  return;
+	}
+
+	__atomic_add_fetch (&delete_count, 1, __ATOMIC_RELAXED);
 
 #if AX25MEMDEBUG	
 	if (ax25memdebug) {
@@ -316,14 +435,180 @@ void ax25_delete (packet_t this_p)
 	}
 #endif
 
+	this_p->magic1 = 0;
+	this_p->magic2 = 0;
+
+	if (this_p->aprs != NULL) {
+	  free (this_p->aprs);
+	  this_p->aprs = NULL;
+	}
+
+	this_p->nextp = cache_list;
+	cache_list = this_p;
+	cache_count++;
+
+/*
+ * Too many here.  Move the most recently deleted batch to the depot,
+ * or back to the heap if the depot is full.
+ */
+	if (cache_count >= 2 * PKT_BATCH) {
+	  struct packet_s *batch = cache_list;
+	  struct packet_s *last = batch;
+	  int n;
+
+	  for (n = 1; n < PKT_BATCH; n++) {
+	    last = last->nextp;
+	  }
+	  cache_list = last->nextp;
+	  last->nextp = NULL;
+	  cache_count -= PKT_BATCH;
+
+	  depot_acquire ();
+	  if (depot_count < PKT_DEPOT_BATCHES) {
+	    depot[depot_count] = batch;
+	    depot_count++;
+	    batch = NULL;
+	  }
+	  depot_release ();
+
+	  while (batch != NULL) {
+	    struct packet_s *next = batch->nextp;
+	    free (batch);
+	    __atomic_sub_fetch (&heap_count, 1, __ATOMIC_RELAXED);
+	    batch = next;
+	  }
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Name:	ax25_freeze
+ * 
+ * Purpose:	Make the packet contents read-only so it can be shared.
+ *
+ * Description:	A received frame goes to many places: client applications,
+ *		IGate, digipeaters, log, etc.  Rather than each making its
+ *		own copy, they can use ax25_ref to hold on to the same one.
+ *		After this, anything that wants to change the addresses or
+ *		information part must make its own copy with ax25_dup.
+ *		The functions that change the frame will assert if called.
+ *
+ *		The queue link, release time, and modulo are not part of
+ *		the frame contents.  A shared packet may be in only one
+ *		queue at a time.
+ *
+ *------------------------------------------------------------------------------*/
+
+void ax25_freeze (packet_t this_p)
+{
 	assert (this_p->magic1 == MAGIC);
 	assert (this_p->magic2 == MAGIC);
-	
-	this_p->magic1 = 0;
-	this_p->magic1 = 0;
 
-	//memset (this_p, 0, sizeof (struct packet_s));
-	free (this_p);
+	this_p->frozen = 1;
+}
+
+int ax25_is_frozen (packet_t this_p)
+{
+	assert (this_p->magic1 == MAGIC);
+	assert (this_p->magic2 == MAGIC);
+
+	return (this_p->frozen);
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Name:	ax25_ref
+ * 
+ * Purpose:	Obtain another reference to a frozen packet.
+ *
+ * Returns:	The same packet object.  
+ *		Each reference is given up with ax25_delete.
+ *		The last one frees it.
+ *
+ *------------------------------------------------------------------------------*/
+
+packet_t ax25_ref (packet_t this_p)
+{
+	assert (this_p->magic1 == MAGIC);
+	assert (this_p->magic2 == MAGIC);
+	assert (this_p->frozen);
+
+	__atomic_add_fetch (&(this_p->refcnt), 1, __ATOMIC_RELAXED);
+
+	return (this_p);
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Name:	ax25_get_aprs_cache
+ * 
+ * Purpose:	Get APRS decoding previously attached to a frozen packet.
+ *
+ * Returns:	Pointer set by ax25_set_aprs_cache or NULL if none yet.
+ *
+ * Description:	This is only storage.  decode_aprs_cached in decode_aprs.c
+ *		is what should normally be used.
+ *
+ *------------------------------------------------------------------------------*/
+
+struct decode_aprs_s *ax25_get_aprs_cache (packet_t this_p)
+{
+	assert (this_p->magic1 == MAGIC);
+	assert (this_p->magic2 == MAGIC);
+
+	return (__atomic_load_n (&(this_p->aprs), __ATOMIC_ACQUIRE));
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Name:	ax25_set_aprs_cache
+ * 
+ * Purpose:	Attach APRS decoding to a frozen packet.
+ *
+ * Inputs:	A	- Allocated with malloc.  It becomes owned by the
+ *			  packet and is freed along with it.
+ *
+ * Returns:	1 if attached.
+ *		0 if another thread got there first.  Caller still owns A.
+ *
+ *------------------------------------------------------------------------------*/
+
+int ax25_set_aprs_cache (packet_t this_p, struct decode_aprs_s *A)
+{
+	struct decode_aprs_s *expected = NULL;
+
+	assert (this_p->magic1 == MAGIC);
+	assert (this_p->magic2 == MAGIC);
+	assert (this_p->frozen);
+
+	return (__atomic_compare_exchange_n (&(this_p->aprs), &expected, A, 0, __ATOMIC_RELEASE, __ATOMIC_ACQUIRE));
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Name:	ax25_get_alloc_stats
+ * 
+ * Purpose:	Get statistics about packet objects.
+ *
+ * Outputs:	in_use	- Number of packet objects currently in existence.
+ *
+ *		peak	- Most in use at the same time since the start.
+ *
+ *		heap	- Number obtained from the heap.  This is the
+ *			  number in use plus those cached for reuse.
+ *
+ *------------------------------------------------------------------------------*/
+
+void ax25_get_alloc_stats (int *in_use, int *peak, int *heap)
+{
+	*in_use = __atomic_load_n (&new_count, __ATOMIC_RELAXED) - __atomic_load_n (&delete_count, __ATOMIC_RELAXED);
+	*peak = __atomic_load_n (&peak_in_use, __ATOMIC_RELAXED);
+	*heap = __atomic_load_n (&heap_count, __ATOMIC_RELAXED);
 }
 
 
@@ -683,6 +968,9 @@ packet_t ax25_dup (packet_t copy_from)
 
 	memcpy (this_p, copy_from, sizeof (struct packet_s));
 	this_p->seq = save_seq;
+	this_p->refcnt = 1;
+	this_p->frozen = 0;
+	this_p->aprs = NULL;
 
 #if AX25MEMDEBUG
 	if (ax25memdebug) {	
@@ -980,6 +1268,7 @@ void ax25_set_addr (packet_t this_p, int n, char *ad)
 
 	assert (this_p->magic1 == MAGIC);
 	assert (this_p->magic2 == MAGIC);
+	assert (! this_p->frozen);
 	assert (n >= 0 && n < AX25_MAX_ADDRS);
 
 	//dw_printf ("ax25_set_addr (%d, %s) num_addr=%d\n", n, ad, this_p->num_addr);
@@ -1061,6 +1350,7 @@ void ax25_insert_addr (packet_t this_p, int n, char *ad)
 
 	assert (this_p->magic1 == MAGIC);
 	assert (this_p->magic2 == MAGIC);
+	assert (! this_p->frozen);
 	assert (n >= AX25_REPEATER_1 && n < AX25_MAX_ADDRS);
 
 	//dw_printf ("ax25_insert_addr (%d, %s)\n", n, ad);
@@ -1131,6 +1421,7 @@ void ax25_remove_addr (packet_t this_p, int n)
 
 	assert (this_p->magic1 == MAGIC);
 	assert (this_p->magic2 == MAGIC);
+	assert (! this_p->frozen);
 	assert (n >= AX25_REPEATER_1 && n < AX25_MAX_ADDRS);
 
 	/* Shift those beyond to fill this position. */
@@ -1432,6 +1723,7 @@ void ax25_set_ssid (packet_t this_p, int n, int ssid)
 
 	assert (this_p->magic1 == MAGIC);
 	assert (this_p->magic2 == MAGIC);
+	assert (! this_p->frozen);
 
 
 	if (n >= 0 && n < this_p->num_addr) {
@@ -1502,6 +1794,7 @@ void ax25_set_h (packet_t this_p, int n)
 
 	assert (this_p->magic1 == MAGIC);
 	assert (this_p->magic2 == MAGIC);
+	assert (! this_p->frozen);
 
 	if (n >= 0 && n < this_p->num_addr) {
 	  this_p->frame_data[n*7+6] |= SSID_H_MASK;
@@ -1698,6 +1991,7 @@ int ax25_cut_at_crlf (packet_t this_p)
 
 	assert (this_p->magic1 == MAGIC);
 	assert (this_p->magic2 == MAGIC);
+	assert (! this_p->frozen);
 
 	info_len = ax25_get_info (this_p, &info_ptr);
 
@@ -2529,6 +2823,30 @@ int ax25_get_frame_len (packet_t this_p)
 } /* end ax25_get_frame_len */
 
 
+/*------------------------------------------------------------------
+ *
+ * Function:	ax25_get_frame_data_ptr
+ *
+ * Purpose:	Get pointer to the frame, in the same form as ax25_pack,
+ *		without copying it.
+ *
+ * Inputs:	this_p	- pointer to packet object.
+ *		
+ * Returns:	Address of the frame contents.  Use ax25_get_frame_len
+ *		for the length.  This must not be modified.
+ *
+ *------------------------------------------------------------------*/
+
+unsigned char *ax25_get_frame_data_ptr (packet_t this_p) 
+{
+	assert (this_p->magic1 == MAGIC);
+	assert (this_p->magic2 == MAGIC);
+
+	return (this_p->frame_data);
+
+} /* end ax25_get_frame_data_ptr */
+
+
 
 /*------------------------------------------------------------------------------
  *
@@ -78,6 +78,16 @@ struct packet_s {
 
 	int seq;		/* unique sequence number for debugging. */
 
+	int refcnt;		/* Version 1.5: Number of references held.  */
+				/* ax25_delete releases it when this goes to 0. */
+
+	int frozen;		/* Version 1.5: Set when shared by ax25_freeze. */
+				/* Frame contents can't be changed after that. */
+
+	struct decode_aprs_s *aprs;	/* Version 1.5: APRS decoding of a frozen packet */
+				/* saved by decode_aprs_cached so it is done only once. */
+				/* Freed along with the packet. */
+
 	double release_time;	/* Time stamp in format returned by dtime_now(). */
 				/* When to release from the SATgate mode delay queue. */
 
@@ -158,11 +168,22 @@ struct packet_s {
 
 typedef struct packet_s *packet_t;
 
+struct decode_aprs_s;		/* Full definition in decode_aprs.h */
+
 typedef enum cmdres_e { cr_00 = 2, cr_cmd = 1, cr_res = 0, cr_11 = 3 } cmdres_t;
 
 
 extern packet_t ax25_new (void);
 
+extern void ax25_get_alloc_stats (int *in_use, int *peak, int *heap);
+
+extern void ax25_freeze (packet_t pp);
+extern int ax25_is_frozen (packet_t pp);
+extern packet_t ax25_ref (packet_t pp);
+
+extern struct decode_aprs_s *ax25_get_aprs_cache (packet_t pp);
+extern int ax25_set_aprs_cache (packet_t pp, struct decode_aprs_s *A);
+
 
 #ifdef AX25_PAD_C	/* Keep this hidden - implementation could change. */
 
@@ -428,6 +449,7 @@ extern int ax25_get_c2 (packet_t this_p);
 extern int ax25_get_pid (packet_t this_p);
 
 extern int ax25_get_frame_len (packet_t this_p);
+extern unsigned char *ax25_get_frame_data_ptr (packet_t this_p);
 
 extern unsigned short ax25_dedupe_crc (packet_t pp);
 
@@ -750,6 +750,7 @@ void config_init (char *fname, struct audio_s *p_audio_config,
 	  p_audio_config->adev[adevice].num_channels = DEFAULT_NUM_CHANNELS;		/* -2 stereo */
 	  p_audio_config->adev[adevice].samples_per_sec = DEFAULT_SAMPLES_PER_SEC;	/* -r option */
 	  p_audio_config->adev[adevice].bits_per_sample = DEFAULT_BITS_PER_SAMPLE;	/* -8 option for 8 instead of 16 bits */
+	  p_audio_config->adev[adevice].split_channels = 0;
 	}
 
 	p_audio_config->adev[0].defined = 1;
@@ -771,7 +772,12 @@ void config_init (char *fname, struct audio_s *p_audio_config,
 	  p_audio_config->achan[channel].num_freq = 1;				
 	  p_audio_config->achan[channel].offset = 0;
 
+	  p_audio_config->achan[channel].demod_threads = 1;
+	  p_audio_config->achan[channel].fixed_point = 0;
 	  p_audio_config->achan[channel].fix_bits = DEFAULT_FIX_BITS;
+	  p_audio_config->achan[channel].fix_threads = 1;
+	  p_audio_config->achan[channel].fix_budget = 0;
+	  p_audio_config->achan[channel].governor = DEFAULT_GOVERNOR;
 	  p_audio_config->achan[channel].sanity_test = SANITY_APRS;
 	  p_audio_config->achan[channel].passall = 0;
 
@@ -798,6 +804,7 @@ void config_init (char *fname, struct audio_s *p_audio_config,
 	  p_audio_config->achan[channel].txdelay = DEFAULT_TXDELAY;				
 	  p_audio_config->achan[channel].txtail = DEFAULT_TXTAIL;				
 	  p_audio_config->achan[channel].fulldup = DEFAULT_FULLDUP;
+	  p_audio_config->achan[channel].txqueue_limit = DEFAULT_TXQUEUE_LIMIT;
 	}
 
 	/* First channel should always be valid. */
@@ -1157,6 +1164,35 @@ void config_init (char *fname, struct audio_s *p_audio_config,
    	    }
 	  }
 
+/*
+ * SPLIT_CHANNELS	- Demodulate left and right channels of stereo device in separate threads.
+ *
+ *			  Version 1.5:  Separate threads allow the two channels to run on
+ *			  different processor cores so a heavy load on one, such as 9600 baud,
+ *			  doesn't delay the other.
+ */
+
+	  else if (strcasecmp(t, "SPLIT_CHANNELS") == 0) {
+
+	    t = split(NULL,0);
+	    if (t == NULL) {
+	      text_color_set(DW_COLOR_ERROR);
+	      dw_printf ("Line %d: Missing parameter for SPLIT_CHANNELS command.  Expecting ON or OFF.\n", line);
+	      continue;
+	    }
+	    if (strcasecmp(t, "ON") == 0) {
+	      p_audio_config->adev[adevice].split_channels = 1;
+	    }
+	    else if (strcasecmp(t, "OFF") == 0) {
+	      p_audio_config->adev[adevice].split_channels = 0;
+	    }
+	    else {
+	      p_audio_config->adev[adevice].split_channels = 0;
+	      text_color_set(DW_COLOR_ERROR);
+	      dw_printf ("Line %d: Expected ON or OFF for SPLIT_CHANNELS.\n", line);
+	    }
+	  }
+
 /*
  * ==================== Radio channel parameters ==================== 
  */
@@ -1549,6 +1585,62 @@ void config_init (char *fname, struct audio_s *p_audio_config,
 	  }
 
 
+/*
+ * DEMOD_THREADS  n	- Spread the demodulators for the channel over n threads.
+ *
+ *	- Useful only when there are multiple demodulators, e.g. ABC or 7@30.
+ */
+
+	  else if (strcasecmp(t, "DEMOD_THREADS") == 0) {
+	    int n;
+	    t = split(NULL,0);
+	    if (t == NULL) {
+	      text_color_set(DW_COLOR_ERROR);
+	      dw_printf ("Line %d: Missing number for DEMOD_THREADS command.\n", line);
+	      continue;
+	    }
+	    n = atoi(t);
+            if (n >= 1 && n <= MAX_SUBCHANS) {
+	      p_audio_config->achan[channel].demod_threads = n;
+	    }
+	    else {
+	      p_audio_config->achan[channel].demod_threads = 1;
+	      text_color_set(DW_COLOR_ERROR);
+              dw_printf ("Line %d: Invalid number of threads for DEMOD_THREADS, must be in range of 1 to %d. Using %d.\n", 
+			line, MAX_SUBCHANS, p_audio_config->achan[channel].demod_threads);
+   	    }
+	  }
+
+
+/*
+ * FIXED_POINT  ON|OFF	- Use integer arithmetic for demodulator.
+ *
+ *	- Version 1.5:  For processors without floating point hardware.
+ *	  Applies to 9600 baud and AFSK profiles other than H.
+ */
+
+	  else if (strcasecmp(t, "FIXED_POINT") == 0) {
+
+	    t = split(NULL,0);
+	    if (t == NULL) {
+	      text_color_set(DW_COLOR_ERROR);
+	      dw_printf ("Line %d: Missing parameter for FIXED_POINT command.  Expecting ON or OFF.\n", line);
+	      continue;
+	    }
+	    if (strcasecmp(t, "ON") == 0) {
+	      p_audio_config->achan[channel].fixed_point = 1;
+	    }
+	    else if (strcasecmp(t, "OFF") == 0) {
+	      p_audio_config->achan[channel].fixed_point = 0;
+	    }
+	    else {
+	      p_audio_config->achan[channel].fixed_point = 0;
+	      text_color_set(DW_COLOR_ERROR);
+	      dw_printf ("Line %d: Expected ON or OFF for FIXED_POINT.\n", line);
+	    }
+	  }
+
+
 /*
  * FIX_BITS  n  [ APRS | AX25 | NONE ] [ PASSALL ]
  *
@@ -1617,6 +1709,90 @@ void config_init (char *fname, struct audio_s *p_audio_config,
 	  }
 
 
+/*
+ * FIX_BUDGET  n	- Try inverting only the n bits, or groups of bits, that
+ *			  the demodulator was least sure about.  0 for all.
+ *
+ *	- Version 1.5:  Much less work for the higher FIX_BITS levels.
+ */
+
+	  else if (strcasecmp(t, "FIX_BUDGET") == 0) {
+	    int n;
+	    t = split(NULL,0);
+	    if (t == NULL) {
+	      text_color_set(DW_COLOR_ERROR);
+	      dw_printf ("Line %d: Missing number for FIX_BUDGET command.\n", line);
+	      continue;
+	    }
+	    n = atoi(t);
+            if (n >= 0 && n <= MAX_FIX_BUDGET) {
+	      p_audio_config->achan[channel].fix_budget = n;
+	    }
+	    else {
+	      p_audio_config->achan[channel].fix_budget = 0;
+	      text_color_set(DW_COLOR_ERROR);
+              dw_printf ("Line %d: Invalid value for FIX_BUDGET, must be in range of 0 to %d. Using %d.\n", 
+			line, MAX_FIX_BUDGET, p_audio_config->achan[channel].fix_budget);
+   	    }
+	  }
+
+
+/*
+ * FIX_THREADS  n	- Share the search for two separated bits among n threads.
+ *
+ *	- Version 1.5:  Useful only with FIX_BITS 4.
+ */
+
+	  else if (strcasecmp(t, "FIX_THREADS") == 0) {
+	    int n;
+	    t = split(NULL,0);
+	    if (t == NULL) {
+	      text_color_set(DW_COLOR_ERROR);
+	      dw_printf ("Line %d: Missing number for FIX_THREADS command.\n", line);
+	      continue;
+	    }
+	    n = atoi(t);
+            if (n >= 1 && n <= MAX_FIX_THREADS) {
+	      p_audio_config->achan[channel].fix_threads = n;
+	    }
+	    else {
+	      p_audio_config->achan[channel].fix_threads = 1;
+	      text_color_set(DW_COLOR_ERROR);
+              dw_printf ("Line %d: Invalid number of threads for FIX_THREADS, must be in range of 1 to %d. Using %d.\n", 
+			line, MAX_FIX_THREADS, p_audio_config->achan[channel].fix_threads);
+   	    }
+	  }
+
+
+/*
+ * GOVERNOR  n		- Percent of real time we can spend on demodulating and
+ *			  fixing frames before giving up the most marginal work.
+ *			  0 for no limit.
+ *
+ *	- Version 1.5:  Lower FIX_BITS, then use fewer slicers, when falling behind.
+ */
+
+	  else if (strcasecmp(t, "GOVERNOR") == 0) {
+	    int n;
+	    t = split(NULL,0);
+	    if (t == NULL) {
+	      text_color_set(DW_COLOR_ERROR);
+	      dw_printf ("Line %d: Missing percent for GOVERNOR command.\n", line);
+	      continue;
+	    }
+	    n = atoi(t);
+            if (n >= 0 && n <= 100) {
+	      p_audio_config->achan[channel].governor = n;
+	    }
+	    else {
+	      p_audio_config->achan[channel].governor = DEFAULT_GOVERNOR;
+	      text_color_set(DW_COLOR_ERROR);
+              dw_printf ("Line %d: Invalid percent for GOVERNOR, must be in range of 0 to 100. Using %d.\n", 
+			line, p_audio_config->achan[channel].governor);
+   	    }
+	  }
+
+
 /*
  * PTT 		- Push To Talk signal line.
  * DCD		- Data Carrier Detect indicator.
@@ -2119,6 +2295,34 @@ void config_init (char *fname, struct audio_s *p_audio_config,
 	    }
 	  }
 
+/*
+ * TXQUEUE_LIMIT n	- Client applications wait when this many frames are
+ *			  waiting to be transmitted on the channel.  0 for no limit.
+ *			  Frames are discarded after waiting 30 seconds.  See tq_wait_while_full.
+ *
+ *	- Version 1.5:  Previously a client could make the queue grow without bound.
+ */
+
+	  else if (strcasecmp(t, "TXQUEUE_LIMIT") == 0) {
+	    int n;
+	    t = split(NULL,0);
+	    if (t == NULL) {
+	      text_color_set(DW_COLOR_ERROR);
+	      dw_printf ("Line %d: Missing number for TXQUEUE_LIMIT command.\n", line);
+	      continue;
+	    }
+	    n = atoi(t);
+            if (n >= 0 && n <= 1000) {
+	      p_audio_config->achan[channel].txqueue_limit = n;
+	    }
+	    else {
+	      p_audio_config->achan[channel].txqueue_limit = DEFAULT_TXQUEUE_LIMIT;
+	      text_color_set(DW_COLOR_ERROR);
+              dw_printf ("Line %d: Invalid value for TXQUEUE_LIMIT, must be in range of 0 to 1000. Using %d.\n", 
+			line, p_audio_config->achan[channel].txqueue_limit);
+   	    }
+	  }
+
 /*
  * SPEECH  script 
  *
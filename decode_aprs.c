@@ -129,6 +129,23 @@ static void process_comment (decode_aprs_t *A, char *pstart, int clen);
 
 
 
+/* Remove trailing LF, then CR, from end of string. */
+
+static void trim_crlf (char *str)
+{
+	int n = strlen(str);
+
+	if (n >= 1 && str[n-1] == '\n') {
+	  str[n-1] = '\0';
+	  n--;
+	}
+	if (n >= 1 && str[n-1] == '\r') {
+	  str[n-1] = '\0';
+	  n--;
+	}
+}
+
+
 /*------------------------------------------------------------------
  *
  * Function:	decode_aprs
@@ -389,10 +406,82 @@ void decode_aprs (decode_aprs_t *A, packet_t pp, int quiet)
 	    decode_tocall (A, dest);
 	    break;
 	}
+
+/*
+ * Version 1.5:  These were done in decode_aprs_print.  Now the result can be
+ * shared, by decode_aprs_cached, so nothing should change it after this.
+ *
+ * Convert Maidenhead locator to latitude and longitude if that's all we have.
+ */
+
+	if (strlen(A->g_maidenhead) > 0 && A->g_lat == G_UNKNOWN && A->g_lon == G_UNKNOWN) {
+
+	  ll_from_grid_square (A->g_maidenhead, &(A->g_lat), &(A->g_lon));
+	}
+
+/*
+ * Drop annoying trailing CR LF.  Anyone who cares can see it in the raw data.
+ */
+
+	trim_crlf (A->g_weather);
+	trim_crlf (A->g_comment);
 	
 } /* end decode_aprs */
 
 
+/*------------------------------------------------------------------
+ *
+ * Function:	decode_aprs_cached
+ *
+ * Purpose:	Decode a frozen APRS packet only once.
+ *
+ * Inputs:	pp	- APRS packet object.  Must be frozen.
+ *
+ *		quiet	- Suppress error messages.
+ *			  Only applies if it is decoded now.
+ *
+ * Returns:	Pointer to result attached to the packet.
+ *		This is shared by everyone and must not be modified.
+ *		It goes away when the packet is deleted.
+ *
+ * Description:	Version 1.5:  A received frame was being decoded for
+ *		display, then again for every filter it went through
+ *		(IGate, each digipeater channel).  Now the first one
+ *		does the work and the rest use the same result.
+ *
+ *------------------------------------------------------------------*/
+
+decode_aprs_t *decode_aprs_cached (packet_t pp, int quiet)
+{
+	decode_aprs_t *A;
+
+	A = ax25_get_aprs_cache (pp);
+	if (A != NULL) {
+	  return (A);
+	}
+
+	A = malloc (sizeof (decode_aprs_t));
+	if (A == NULL) {
+	  text_color_set(DW_COLOR_ERROR);
+	  dw_printf ("FATAL: Out of memory in decode_aprs_cached.\n");
+	  exit (1);
+	}
+
+	decode_aprs (A, pp, quiet);
+
+	if ( ! ax25_set_aprs_cache (pp, A)) {
+
+	  /* Another thread was doing the same thing at the same time. */
+
+	  free (A);
+	  A = ax25_get_aprs_cache (pp);
+	}
+
+	return (A);
+
+} /* end decode_aprs_cached */
+
+
 void decode_aprs_print (decode_aprs_t *A) {
 
 	char stemp[200];
@@ -481,11 +570,6 @@ void decode_aprs_print (decode_aprs_t *A) {
 
 	if (strlen(A->g_maidenhead) > 0) {
 
-	  if (A->g_lat == G_UNKNOWN && A->g_lon == G_UNKNOWN) {
-
-	    ll_from_grid_square (A->g_maidenhead, &(A->g_lat), &(A->g_lon));
-	  }
-
 	  dw_printf("Grid square = %s, ", A->g_maidenhead);
 	}
 
@@ -614,18 +698,10 @@ void decode_aprs_print (decode_aprs_t *A) {
  * Non-printable characters are changed to safe hexadecimal representations.
  * For example, carriage return is displayed as <0x0d>.
  *
- * Drop annoying trailing CR LF.  Anyone who cares can see it in the raw datA->
+ * Trailing CR LF was already removed by decode_aprs.
  */
 
 	n = strlen(A->g_weather);
-	if (n >= 1 && A->g_weather[n-1] == '\n') {
-	  A->g_weather[n-1] = '\0';
-	  n--;
-	}
-	if (n >= 1 && A->g_weather[n-1] == '\r') {
-	  A->g_weather[n-1] = '\0';
-	  n--;
-	}
 	if (n > 0) {  
 	  ax25_safe_print (A->g_weather, -1, 0);
 	  dw_printf("\n");
@@ -639,14 +715,6 @@ void decode_aprs_print (decode_aprs_t *A) {
 
 
 	n = strlen(A->g_comment);
-	if (n >= 1 && A->g_comment[n-1] == '\n') {
-	  A->g_comment[n-1] = '\0';
-	  n--;
-	}
-	if (n >= 1 && A->g_comment[n-1] == '\r') {
-	  A->g_comment[n-1] = '\0';
-	  n--;
-	}
 	if (n > 0) {
 	  int j;
 
@@ -137,6 +137,8 @@ typedef struct decode_aprs_s {
 
 extern void decode_aprs (decode_aprs_t *A, packet_t pp, int quiet);
 
+extern decode_aprs_t *decode_aprs_cached (packet_t pp, int quiet);
+
 extern void decode_aprs_print (decode_aprs_t *A);
 
 
@@ -42,17 +42,21 @@
 #include <assert.h>
 #include <ctype.h>
 
+#if __WIN32__
+#include <malloc.h>		// for _aligned_malloc
+#endif
+
 #include "audio.h"
 #include "demod.h"
 #include "tune.h"
 #include "fsk_demod_state.h"
 #include "fsk_gen_filter.h"
-#include "fsk_fast_filter.h"
 #include "hdlc_rec.h"
 #include "textcolor.h"
 #include "demod_9600.h"
 #include "demod_afsk.h"
 #include "demod_psk.h"
+#include "dsp.h"
 
 
 
@@ -67,13 +71,19 @@ static int upsample = 2;	// temp experiment.
 static int zerostuff = 1;	// temp experiment.
 
 // Current state of all the decoders.
+// Version 1.5:  Allocated only for the subchannels in use.  See demod_state_alloc.
 
-static struct demodulator_state_s demodulator_state[MAX_CHANS][MAX_SUBCHANS];
+static struct demodulator_state_s *demodulator_state[MAX_CHANS][MAX_SUBCHANS];
+
+static struct demodulator_state_s *demod_state_alloc (int chan, int subchan);
 
 
 static int sample_sum[MAX_CHANS][MAX_SUBCHANS];
 static int sample_count[MAX_CHANS][MAX_SUBCHANS];
 
+static void share_front_ends (int chan);
+static void fixed_point_init (int chan);
+
 
 /*------------------------------------------------------------------
  *
@@ -106,6 +116,11 @@ int demod_init (struct audio_s *pa)
 
 	save_audio_config_p = pa;
 
+/*
+ * Version 1.5:  Pick the filter kernels for this processor.
+ */
+	dsp_kernel_init ();
+
 	for (chan = 0; chan < MAX_CHANS; chan++) {
 
 	 if (save_audio_config_p->achan[chan].valid) {
@@ -374,7 +389,7 @@ int demod_init (struct audio_s *pa)
 	          assert (d >= 0 && d < MAX_SUBCHANS);
 
 	          struct demodulator_state_s *D;
-	          D = &demodulator_state[chan][d];
+	          D = demod_state_alloc (chan, d);
 
 	          profile = save_audio_config_p->achan[chan].profiles[d];
 	          mark = save_audio_config_p->achan[chan].mark_freq;
@@ -434,7 +449,7 @@ int demod_init (struct audio_s *pa)
 		}
 
 	        struct demodulator_state_s *D;
-	        D = &demodulator_state[chan][0];
+	        D = demod_state_alloc (chan, 0);
 
 		/* I'm not happy about putting this hack here. */
 		/* This belongs in demod_afsk_init but it doesn't have access to the audio config. */
@@ -482,7 +497,7 @@ int demod_init (struct audio_s *pa)
 	          assert (d >= 0 && d < MAX_SUBCHANS);
 
 	          struct demodulator_state_s *D;
-	          D = &demodulator_state[chan][d];
+	          D = demod_state_alloc (chan, d);
 
 	          profile = save_audio_config_p->achan[chan].profiles[0];
 
@@ -516,6 +531,19 @@ int demod_init (struct audio_s *pa)
 
 	        } 	  /* for each freq pair */
 	      }	
+
+/*
+ * Version 1.5:  Different letters don't necessarily mean different
+ * mark/space filters.  e.g. A and B differ only in what happens after.
+ * Don't compute the same thing more than once.
+ * The interleaved case is excluded because each subchannel gets different samples.
+ */
+	      if (save_audio_config_p->achan[chan].fixed_point) {
+	        fixed_point_init (chan);
+	      }
+	      if (save_audio_config_p->achan[chan].interleave <= 1) {
+	        share_front_ends (chan);
+	      }
 	      break;
 
 	    case MODEM_QPSK:		// New for 1.4
@@ -548,7 +576,7 @@ int demod_init (struct audio_s *pa)
 
 	        assert (d >= 0 && d < MAX_SUBCHANS);
 	        struct demodulator_state_s *D;
-	        D = &demodulator_state[chan][d];
+	        D = demod_state_alloc (chan, d);
 	        profile = save_audio_config_p->achan[chan].profiles[d];
 
 	        //text_color_set(DW_COLOR_DEBUG);
@@ -602,7 +630,7 @@ int demod_init (struct audio_s *pa)
 
 	        assert (d >= 0 && d < MAX_SUBCHANS);
 	        struct demodulator_state_s *D;
-	        D = &demodulator_state[chan][d];
+	        D = demod_state_alloc (chan, d);
 	        profile = save_audio_config_p->achan[chan].profiles[d];
 
 	        //text_color_set(DW_COLOR_DEBUG);
@@ -667,7 +695,7 @@ int demod_init (struct audio_s *pa)
 	      dw_printf (".\n");
 	      
 	      struct demodulator_state_s *D;
-	      D = &demodulator_state[chan][0];	// first subchannel
+	      D = demod_state_alloc (chan, 0);	// first subchannel
 
 	      save_audio_config_p->achan[chan].num_subchan = 1;
               save_audio_config_p->achan[chan].num_slicers = 1;
@@ -724,6 +752,10 @@ int demod_init (struct audio_s *pa)
 
 	      D->quick_attack = D->agc_fast_attack * 0.2f;
 	      D->sluggish_decay = D->agc_slow_decay * 0.2f;
+
+	      if (save_audio_config_p->achan[chan].fixed_point) {
+	        fixed_point_init (chan);
+	      }
 	      }
 	      break;
 
@@ -740,6 +772,186 @@ int demod_init (struct audio_s *pa)
 
 
 
+/*------------------------------------------------------------------
+ *
+ * Name:        demod_state_alloc
+ *
+ * Purpose:     Get demodulator state for a subchannel, allocating it
+ *		the first time.
+ *
+ * Inputs:	chan	- Audio channel.
+ *
+ *		subchan	- Subchannel (demodulator) within the channel.
+ *
+ * Returns:	Pointer to state.  The caller's init function clears it.
+ *
+ * Description:	Version 1.5:  Previously there was a static array for
+ *		every possible channel and subchannel.  Each one is large,
+ *		mostly filter kernels and delay lines, and usually only
+ *		a few are used.
+ *
+ *		The structure is aligned on a cache line so the groups
+ *		of fields within it start on cache line boundaries.
+ *		It is kept for the life of the application.
+ *
+ *----------------------------------------------------------------*/
+
+static struct demodulator_state_s *demod_state_alloc (int chan, int subchan)
+{
+	assert (chan >= 0 && chan < MAX_CHANS);
+	assert (subchan >= 0 && subchan < MAX_SUBCHANS);
+
+	if (demodulator_state[chan][subchan] == NULL) {
+	  void *p;
+
+#if __WIN32__
+	  p = _aligned_malloc (sizeof(struct demodulator_state_s), 64);
+#else
+	  if (posix_memalign (&p, 64, sizeof(struct demodulator_state_s)) != 0) {
+	    p = NULL;
+	  }
+#endif
+	  if (p == NULL) {
+	    text_color_set(DW_COLOR_ERROR);
+	    dw_printf ("FATAL: Out of memory for channel %d demodulator %d.\n", chan, subchan);
+	    exit (1);
+	  }
+	  memset (p, 0, sizeof(struct demodulator_state_s));
+	  demodulator_state[chan][subchan] = p;
+	}
+
+	return (demodulator_state[chan][subchan]);
+}
+
+
+
+/*------------------------------------------------------------------
+ *
+ * Name:        fixed_point_init
+ *
+ * Purpose:     Prepare the demodulators of a channel to use integer
+ *		rather than floating point arithmetic.
+ *
+ * Inputs:	chan	- Audio channel.  Demodulators must already be initialized.
+ *
+ * Description:	Version 1.5:  The filter kernels and other settings are
+ *		converted from floating point.  The rest of the 
+ *		initialization is exactly the same.
+ *
+ *		The sliding DFT (profile H) and PSK don't have this.
+ *
+ *----------------------------------------------------------------*/
+
+static int q31 (float x)
+{
+	return ((int) lrint (x * 2147483647.0));
+}
+
+static void fixed_point_init (int chan)
+{
+	int afsk = save_audio_config_p->achan[chan].modem_type == MODEM_AFSK;
+	int d;
+
+	for (d = 0; d < save_audio_config_p->achan[chan].num_subchan; d++) {
+	  struct demodulator_state_s *D = demodulator_state[chan][d];
+
+	  if (D->use_sdft) {
+	    text_color_set(DW_COLOR_INFO);
+	    dw_printf ("Channel %d: Demodulator type %c doesn't have fixed point.  Using floating point.\n", chan, D->profile);
+	    continue;
+	  }
+
+	  if (afsk) {
+	    const float *ms[4] = { D->m_sin_table, D->m_cos_table, D->s_sin_table, D->s_cos_table };
+
+	    if (D->use_prefilter) {
+	      const float *pre[1] = { D->pre_filter };
+	      D->qp.pre_shift = dsp_q15_shift (pre, 1, D->pre_filter_size);
+	      dsp_to_q15 (D->pre_filter, D->pre_filter_size, D->qp.pre_shift, D->pre_filter_q15);
+	    }
+
+	    D->qp.ms_shift = dsp_q15_shift (ms, 4, D->ms_filter_size);
+	    dsp_to_q15 (D->m_sin_table, D->ms_filter_size, D->qp.ms_shift, D->m_sin_q15);
+	    dsp_to_q15 (D->m_cos_table, D->ms_filter_size, D->qp.ms_shift, D->m_cos_q15);
+	    dsp_to_q15 (D->s_sin_table, D->ms_filter_size, D->qp.ms_shift, D->s_sin_q15);
+	    dsp_to_q15 (D->s_cos_table, D->ms_filter_size, D->qp.ms_shift, D->s_cos_q15);
+	  }
+
+	  if (D->lpf_use_fir || ! afsk) {
+	    const float *lp[1] = { D->lp_filter };
+	    D->qp.lp_shift = dsp_q15_shift (lp, 1, D->lp_filter_size);
+	    dsp_to_q15 (D->lp_filter, D->lp_filter_size, D->qp.lp_shift, D->lp_filter_q15);
+	  }
+
+	  D->qp.lpf_iir = (int) lrintf (D->lpf_iir * 32768);
+	  D->qp.agc_fast_attack = q31 (D->agc_fast_attack);
+	  D->qp.agc_slow_decay = q31 (D->agc_slow_decay);
+	  D->qp.quick_attack = q31 (D->quick_attack);
+	  D->qp.sluggish_decay = q31 (D->sluggish_decay);
+	  D->qp.hysteresis = (int) lrintf (D->hysteresis * 65536);
+	  D->qp.pll_locked_inertia = (int) lrintf (D->pll_locked_inertia * 65536);
+	  D->qp.pll_searching_inertia = (int) lrintf (D->pll_searching_inertia * 65536);
+
+	  D->use_fixed = 1;
+	}
+
+	text_color_set(DW_COLOR_DEBUG);
+	dw_printf ("Channel %d: Using fixed point arithmetic for demodulator.\n", chan);
+}
+
+
+
+/*------------------------------------------------------------------
+ *
+ * Name:        share_front_ends
+ *
+ * Purpose:     Find AFSK subchannels with identical tones and filters
+ *		so they can share the mark/space amplitude calculation.
+ *
+ * Inputs:	chan	- Audio channel.  Demodulators must already be initialized.
+ *
+ * Description:	The first subchannel, of a group with identical front ends,
+ *		computes the mark and space amplitudes and saves them for
+ *		the current block.  The others use those results and have
+ *		only their own lowpass filter, AGC, slicers and PLLs.
+ *
+ *		This depends on multi_modem processing subchannels in
+ *		increasing order so the first of the group has already
+ *		done its work for the block when the others need it.
+ *
+ *----------------------------------------------------------------*/
+
+static void share_front_ends (int chan)
+{
+	int d, e;
+
+	for (d = 1; d < save_audio_config_p->achan[chan].num_subchan; d++) {
+	  struct demodulator_state_s *D = demodulator_state[chan][d];
+
+	  if (D->use_fixed) continue;		/* Fixed point always does its own. */
+
+	  for (e = 0; e < d; e++) {
+	    struct demodulator_state_s *E = demodulator_state[chan][e];
+
+	    if (E->ms_source == NULL && demod_afsk_same_front_end (D, E)) {
+
+	      D->ms_source = E;
+	      if (E->m_amp_share == NULL) {
+	        E->m_amp_share = calloc (DEMOD_BLOCK_SIZE, sizeof(float));
+	        E->s_amp_share = calloc (DEMOD_BLOCK_SIZE, sizeof(float));
+	        assert (E->m_amp_share != NULL && E->s_amp_share != NULL);
+	      }
+
+	      text_color_set(DW_COLOR_DEBUG);
+	      dw_printf ("        %d.%d: uses mark/space filter results from %d.%d\n", chan, d, chan, e);
+	      break;
+	    }
+	  }
+	}
+}
+
+
+
 /*------------------------------------------------------------------
  *
  * Name:        demod_get_sample
@@ -804,17 +1016,63 @@ int demod_get_sample (int a)
 }
 
 
+/*------------------------------------------------------------------
+ *
+ * Name:        demod_get_block
+ *
+ * Purpose:     Get a block of audio samples from the specified sound input source.
+ *
+ * Inputs:	a	- Index for audio device.  0 = first.
+ *
+ *		num_chan - Number of audio channels.  1 for mono, 2 for stereo.
+ *
+ * Outputs:	samples	- Audio samples, -32768 .. 32767, separated by channel.
+ *			  samples[0] is left, samples[1] is right.
+ *
+ * Returns:     Number of samples, for each channel, in range of 1 .. DEMOD_BLOCK_SIZE.
+ *		Something less than DEMOD_BLOCK_SIZE means end of file or other error.
+ *		0 means we didn't get anything.
+ *
+ * Description:	The stereo samples are interleaved in the audio stream.
+ *		Here we separate them so each channel can be processed
+ *		as a contiguous block.
+ *
+ *----------------------------------------------------------------*/
+
+__attribute__((hot))
+int demod_get_block (int a, int num_chan, int16_t samples[][DEMOD_BLOCK_SIZE])
+{
+	int n, c;
+
+	assert (num_chan >= 1 && num_chan <= 2);
+
+	for (n = 0; n < DEMOD_BLOCK_SIZE; n++) {
+	  for (c = 0; c < num_chan; c++) {
+	    int sam = demod_get_sample (a);
+
+	    if (sam >= FSK_READ_ERR) {
+	      return (n);		/* Partial sample set is discarded. */
+	    }
+	    samples[c][n] = sam;
+	  }
+	}
+	return (n);
+}
+
+
+
 /*-------------------------------------------------------------------
  *
- * Name:        demod_process_sample
+ * Name:        demod_process_block
  *
  * Purpose:     (1) Demodulate the AFSK signal.
  *		(2) Recover clock and data.
  *
  * Inputs:	chan	- Audio channel.  0 for left, 1 for right.
  *		subchan - modem of the channel.
- *		sam	- One sample of audio.
+ *		samples	- Block of audio samples.
  *			  Should be in range of -32768 .. 32767.
+ *		n	- Number of samples in block.
  *
  * Returns:	None 
  *
@@ -835,6 +1093,11 @@ int demod_get_sample (int a)
  *
  *		to decode HDLC frames from the stream of bits.
  *
+ * Version 1.5:	Originally this was called for one audio sample at a time,
+ *		once for each subchannel.  Now we process a whole block of
+ *		samples so the modem type dispatch and other overhead 
+ *		is done once per block rather than for every sample.
+ *
  * Future:	This could be generalized by passing in the name
  *		of the function to be called for each bit recovered
  *		from the demodulator.  For now, it's simply hard-coded.
@@ -843,10 +1106,9 @@ int demod_get_sample (int a)
 
 
 __attribute__((hot))
-void demod_process_sample (int chan, int subchan, int sam)
+void demod_process_block (int chan, int subchan, const int16_t *samples, int n)
 {
-	float fsam;
-	int k;
+	int i;
 
 
 	struct demodulator_state_s *D;
@@ -854,40 +1116,15 @@ void demod_process_sample (int chan, int subchan, int sam)
 	assert (chan >= 0 && chan < MAX_CHANS);
 	assert (subchan >= 0 && subchan < MAX_SUBCHANS);
 
-	D = &demodulator_state[chan][subchan];
-
-
-	/* Scale to nice number, actually -2.0 to +2.0 for extra headroom */
+	D = demodulator_state[chan][subchan];
 
-	fsam = sam / 16384.0f;
 
 /*
  * Accumulate measure of the input signal level.
+ * Version 1.5: This is now done by the demodulators, sample by sample,
+ * with rec_level_update.  See dsp.h.
  */
 
-
-/*
- * Version 1.2: Try new approach to capturing the amplitude.
- * This is same as the later AGC without the normalization step.
- * We want decay to be substantially slower to get a longer
- * range idea of the received audio.
- */
-
-	if (fsam >= D->alevel_rec_peak) {
-	  D->alevel_rec_peak = fsam * D->quick_attack + D->alevel_rec_peak * (1.0f - D->quick_attack);
-	}
-	else {
-	  D->alevel_rec_peak = fsam * D->sluggish_decay + D->alevel_rec_peak * (1.0f - D->sluggish_decay);
-	}
-
-	if (fsam <= D->alevel_rec_valley) {
-	  D->alevel_rec_valley = fsam * D->quick_attack + D->alevel_rec_valley * (1.0f - D->quick_attack);
-	}
-	else  {   
-	  D->alevel_rec_valley = fsam * D->sluggish_decay + D->alevel_rec_valley * (1.0f - D->sluggish_decay);
-	}
-
-
 /*
  * Select decoder based on modulation type.
  */
@@ -904,16 +1141,25 @@ void demod_process_sample (int chan, int subchan, int sam)
 
 	    if (save_audio_config_p->achan[chan].decimate > 1) {
 
-	      sample_sum[chan][subchan] += sam;
-	      sample_count[chan][subchan]++;
-	      if (sample_count[chan][subchan] >= save_audio_config_p->achan[chan].decimate) {
-  	        demod_afsk_process_sample (chan, subchan, sample_sum[chan][subchan] / save_audio_config_p->achan[chan].decimate, D);
-	        sample_sum[chan][subchan] = 0;
-	        sample_count[chan][subchan] = 0;
+	      for (i = 0; i < n; i++) {
+	        if (D->use_fixed) {
+	          rec_level_update_q (samples[i], D);
+	        }
+	        else {
+	          rec_level_update (samples[i] / 16384.0f, D);
+	        }
+	        sample_sum[chan][subchan] += samples[i];
+	        sample_count[chan][subchan]++;
+	        if (sample_count[chan][subchan] >= save_audio_config_p->achan[chan].decimate) {
+	          D->block_pos = i;
+  	          demod_afsk_process_sample (chan, subchan, sample_sum[chan][subchan] / save_audio_config_p->achan[chan].decimate, D);
+	          sample_sum[chan][subchan] = 0;
+	          sample_count[chan][subchan] = 0;
+	        }
 	      }
 	    }
 	    else {
-	      demod_afsk_process_sample (chan, subchan, sam, D);
+	      demod_afsk_process_block (chan, subchan, samples, n, D);
 	    }
 	    break;
 
@@ -928,7 +1174,7 @@ void demod_process_sample (int chan, int subchan, int sam)
 	      exit (1);
 	    }
 	    else {
-	      demod_psk_process_sample (chan, subchan, sam, D);
+	      demod_psk_process_block (chan, subchan, samples, n, D);
 	    }
 	    break;
 
@@ -942,47 +1188,146 @@ void demod_process_sample (int chan, int subchan, int sam)
 	      /* So far, both are same in tests with different */
 	      /* optimal low pass filter parameters. */
 
-	      for (k=1; k<upsample; k++) {
-	        demod_9600_process_sample (chan, 0, D);
-	      }
-	      demod_9600_process_sample (chan, sam * upsample, D);
+	      demod_9600_process_block (chan, samples, n, upsample, D);
 	    }
 	    else {
 
 	      /* Linear interpolation. */
 	      static int prev_sam;
 
-	      switch (upsample) {
-	        case 1:
-	          demod_9600_process_sample (chan, sam, D);
-	          break;
-	        case 2:
-	          demod_9600_process_sample (chan, (prev_sam + sam) / 2, D);
-	          demod_9600_process_sample (chan, sam, D);
-	          break;
-                case 3:
-                  demod_9600_process_sample (chan, (2 * prev_sam + sam) / 3, D);
-                  demod_9600_process_sample (chan, (prev_sam + 2 * sam) / 3, D);
-                  demod_9600_process_sample (chan, sam, D);
-                  break;
-                case 4:
-                  demod_9600_process_sample (chan, (3 * prev_sam + sam) / 4, D);
-                  demod_9600_process_sample (chan, (prev_sam + sam) / 2, D);
-                  demod_9600_process_sample (chan, (prev_sam + 3 * sam) / 4, D);
-                  demod_9600_process_sample (chan, sam, D);
-                  break;
-                default:
-                  assert (0);
-                  break;
+	      for (i = 0; i < n; i++) {
+	        int sam = samples[i];
+
+	        D->block_pos = i;
+	        if (D->use_fixed) {
+	          rec_level_update_q (sam, D);
+	        }
+	        else {
+	          rec_level_update (sam / 16384.0f, D);
+	        }
+
+	        switch (upsample) {
+	          case 1:
+	            demod_9600_process_sample (chan, sam, D);
+	            break;
+	          case 2:
+	            demod_9600_process_sample (chan, (prev_sam + sam) / 2, D);
+	            demod_9600_process_sample (chan, sam, D);
+	            break;
+                  case 3:
+                    demod_9600_process_sample (chan, (2 * prev_sam + sam) / 3, D);
+                    demod_9600_process_sample (chan, (prev_sam + 2 * sam) / 3, D);
+                    demod_9600_process_sample (chan, sam, D);
+                    break;
+                  case 4:
+                    demod_9600_process_sample (chan, (3 * prev_sam + sam) / 4, D);
+                    demod_9600_process_sample (chan, (prev_sam + sam) / 2, D);
+                    demod_9600_process_sample (chan, (prev_sam + 3 * sam) / 4, D);
+                    demod_9600_process_sample (chan, sam, D);
+                    break;
+                  default:
+                    assert (0);
+                    break;
+	        }
+	        prev_sam = sam;
 	      }
-	      prev_sam = sam;
 	    }
 	    break;
 
 	}  /* switch modem_type */
 	return;
 
-} /* end demod_process_sample */
+} /* end demod_process_block */
+
+
+/*
+ * Original interface for one sample at a time.
+ */
+
+void demod_process_sample (int chan, int subchan, int sam)
+{
+	int16_t s = sam;
+
+	demod_process_block (chan, subchan, &s, 1);
+}
+
+
+/*
+ * Index of the sample, within the current block, being processed by the demodulator.
+ */
+
+int demod_get_block_pos (int chan, int subchan)
+{
+	assert (chan >= 0 && chan < MAX_CHANS);
+	assert (subchan >= 0 && subchan < MAX_SUBCHANS);
+
+	return (demodulator_state[chan][subchan]->block_pos);
+}
+
+/*
+ * Version 1.5:  Put it back while fixing a frame, after the whole block
+ * was demodulated, so the result is placed where the frame was received.
+ */
+
+void demod_set_block_pos (int chan, int subchan, int pos)
+{
+	assert (chan >= 0 && chan < MAX_CHANS);
+	assert (subchan >= 0 && subchan < MAX_SUBCHANS);
+
+	demodulator_state[chan][subchan]->block_pos = pos;
+}
+
+
+/*
+ * Version 1.5:  Use only the middle slicers, leaving out 'off' at each end.
+ * Must be called between blocks by the thread doing this subchannel.
+ */
+
+void demod_set_slicers_off (int chan, int subchan, int off)
+{
+	struct demodulator_state_s *D;
+
+	assert (chan >= 0 && chan < MAX_CHANS);
+	assert (subchan >= 0 && subchan < MAX_SUBCHANS);
+
+	D = demodulator_state[chan][subchan];
+
+	if (D == NULL || D->num_slicers <= 1) {
+	  return;
+	}
+	if (off < 0) off = 0;
+	if (off > (D->num_slicers - 1) / 2) off = (D->num_slicers - 1) / 2;
+
+	D->slicers_off = off;
+}
+
+
+/*
+ * Version 1.5:  Which subchannel computes the mark/space amplitudes
+ * used by this one?  Usually itself.  See share_front_ends.
+ * Anyone splitting up the work must do that one first.
+ */
+
+int demod_get_front_end_source (int chan, int subchan)
+{
+	struct demodulator_state_s *D;
+
+	assert (chan >= 0 && chan < MAX_CHANS);
+	assert (subchan >= 0 && subchan < MAX_SUBCHANS);
+
+	D = demodulator_state[chan][subchan];
+
+	if (D->ms_source != NULL) {
+	  int e;
+
+	  for (e = 0; e < subchan; e++) {
+	    if (demodulator_state[chan][e] == D->ms_source) {
+	      return (e);
+	    }
+	  }
+	}
+	return (subchan);
+}
 
 
 
@@ -1002,26 +1347,46 @@ alevel_t demod_get_audio_level (int chan, int subchan)
 	assert (chan >= 0 && chan < MAX_CHANS);
 	assert (subchan >= 0 && subchan < MAX_SUBCHANS);
 
-	/* We have to consider two different cases here. */
-	/* N demodulators, each with own slicer and HDLC decoder. */
-	/* Single demodulator, multiple slicers each with own HDLC decoder. */
+	/* Multiple slicers of one demodulator are no longer numbered */
+	/* as subchannels so there is no need to map them back to 0. */
+	/* That would also read state belonging to another thread when */
+	/* the demodulators are split among multiple threads. */
 
-	if (demodulator_state[chan][0].num_slicers > 1) {
-	  subchan = 0;
+	D = demodulator_state[chan][subchan];
+
+	if (D == NULL) {
+	  /* Not a channel with a demodulator. */
+	  memset (&alevel, 0, sizeof(alevel));
+	  return (alevel);
 	}
 
-	D = &demodulator_state[chan][subchan];
+	float rec_peak = D->alevel_rec_peak;
+	float rec_valley = D->alevel_rec_valley;
+	float mark_peak = D->alevel_mark_peak;
+	float space_peak = D->alevel_space_peak;
+
+	if (D->use_fixed) {
+
+	  /* Same as floating point after scaling.  See rec_level_update_q. */
+
+	  const float scale = 1.0f / (16384.0f * (1 << AGC_FRAC));
+
+	  rec_peak = D->q.alevel_rec_peak * scale;
+	  rec_valley = D->q.alevel_rec_valley * scale;
+	  mark_peak = D->q.alevel_mark_peak * scale;
+	  space_peak = D->q.alevel_space_peak * scale;
+	}
 
 	// Take half of peak-to-peak for received audio level.
 
-	alevel.rec = (int) (( D->alevel_rec_peak - D->alevel_rec_valley ) * 50.0f + 0.5f);
+	alevel.rec = (int) (( rec_peak - rec_valley ) * 50.0f + 0.5f);
 
 	if (save_audio_config_p->achan[chan].modem_type == MODEM_AFSK) {
 
 	  /* For AFSK, we have mark and space amplitudes. */
 
-	  alevel.mark = (int) ((D->alevel_mark_peak ) * 100.0f + 0.5f);
-	  alevel.space = (int) ((D->alevel_space_peak ) * 100.0f + 0.5f);
+	  alevel.mark = (int) ((mark_peak ) * 100.0f + 0.5f);
+	  alevel.space = (int) ((space_peak ) * 100.0f + 0.5f);
 	}
 	else if (save_audio_config_p->achan[chan].modem_type == MODEM_QPSK ||
 	         save_audio_config_p->achan[chan].modem_type == MODEM_8PSK) {
@@ -1035,8 +1400,8 @@ alevel_t demod_get_audio_level (int chan, int subchan)
 	  /* Normally we'd expect them to be about the same. */
 	  /* However, with SDR, or other DC coupling, we could have an offset. */
 
-	  alevel.mark = (int) ((D->alevel_mark_peak) * 200.0f  + 0.5f);
-	  alevel.space = (int) ((D->alevel_space_peak) * 200.0f - 0.5f);
+	  alevel.mark = (int) ((mark_peak) * 200.0f  + 0.5f);
+	  alevel.space = (int) ((space_peak) * 200.0f - 0.5f);
 
 
 #else
@@ -1045,7 +1410,7 @@ alevel_t demod_get_audio_level (int chan, int subchan)
 	  /* The "5/6" factor worked out right for the current low pass filter. */
 	  /* Will it need to be different if the filter is tweaked? */
 
-	  alevel.mark = (int) ((D->alevel_mark_peak - D->alevel_space_peak) * 100.0f * 5.0f/6.0f + 0.5f);
+	  alevel.mark = (int) ((mark_peak - space_peak) * 100.0f * 5.0f/6.0f + 0.5f);
 	  alevel.space = -1;		/* to print one number inside of ( ) */
 #endif
 	}
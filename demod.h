@@ -8,10 +8,31 @@
 
 int demod_init (struct audio_s *pa);
 
+#include <stdint.h>	/* for int16_t */
+
 int demod_get_sample (int a);
 
+
+/* Number of audio samples, per channel, processed at once. */
+/* This is a few milliseconds, much shorter than any frame, */
+/* so added latency is insignificant. */
+
+#define DEMOD_BLOCK_SIZE 256
+
+int demod_get_block (int a, int num_chan, int16_t samples[][DEMOD_BLOCK_SIZE]);
+
 void demod_process_sample (int chan, int subchan, int sam);
 
+void demod_process_block (int chan, int subchan, const int16_t *samples, int n);
+
+int demod_get_block_pos (int chan, int subchan);
+
+void demod_set_block_pos (int chan, int subchan, int pos);
+
+int demod_get_front_end_source (int chan, int subchan);
+
+void demod_set_slicers_off (int chan, int subchan, int off);
+
 void demod_print_agc (int chan, int subchan);
 
 alevel_t demod_get_audio_level (int chan, int subchan);
\ No newline at end of file
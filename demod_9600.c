@@ -53,33 +53,9 @@
 
 
 static float slice_point[MAX_SUBCHANS];
+static int slice_point_q16[MAX_SUBCHANS];	/* Same for fixed point. */
 
 
-/* Add sample to buffer and shift the rest down. */
-
-__attribute__((hot)) __attribute__((always_inline))
-static inline void push_sample (float val, float *buff, int size)
-{
-	memmove(buff+1,buff,(size-1)*sizeof(float));
-	buff[0] = val; 
-}
-
-
-/* FIR filter kernel. */
-
-__attribute__((hot)) __attribute__((always_inline))
-static inline float convolve (const float *__restrict__ data, const float *__restrict__ filter, int filter_size)
-{
-	float sum = 0.0f;
-	int j;
-
-//#pragma GCC ivdep				// ignored until gcc 4.9
-	for (j=0; j<filter_size; j++) {
-	    sum += filter[j] * data[j];
-	}
-	return (sum);
-}
-
 /* Automatic gain control. */
 /* Result should settle down to 1 unit peak to peak.  i.e. -0.5 to +0.5 */
 
@@ -200,6 +176,7 @@ void demod_9600_init (int samples_per_sec, int baud, struct demodulator_state_s
 
 	for (j = 0; j < MAX_SUBCHANS; j++) {
 	  slice_point[j] = 0.02f * (j - 0.5f * (MAX_SUBCHANS-1));
+	  slice_point_q16[j] = (int) lrintf(slice_point[j] * 65536);
 	  //dw_printf ("slice_point[%d] = %+5.2f\n", j, slice_point[j]);
 	}
 
@@ -263,8 +240,8 @@ void demod_9600_init (int samples_per_sec, int baud, struct demodulator_state_s
 
 inline static void nudge_pll (int chan, int subchan, int slice, float demod_out, struct demodulator_state_s *D);
 
-__attribute__((hot))
-void demod_9600_process_sample (int chan, int sam, struct demodulator_state_s *D)
+__attribute__((hot)) __attribute__((always_inline))
+static inline void process_sample (int chan, int sam, struct demodulator_state_s *D)
 {
 
 	float fsam;
@@ -288,14 +265,9 @@ void demod_9600_process_sample (int chan, int sam, struct demodulator_state_s *D
 /* 
  * Filters use last 'filter_size' samples.
  *
- * First push the older samples down. 
- *
- * Finally, put the most recent at the beginning.
- *
- * Future project?  Rather than shifting the samples,
- * it might be faster to add another variable to keep
- * track of the most recent sample and change the 
- * indexing in the later loops that multipy and add.
+ * Version 1.5:  The delay lines are now mirrored circular buffers
+ * so nothing needs to be shifted for each new sample.
+ * delay_line() gives us the most recent at the beginning as before.
  */
 
 	/* Scale to nice number for convenience. */
@@ -312,13 +284,13 @@ void demod_9600_process_sample (int chan, int sam, struct demodulator_state_s *D
 	amp = fsam;
 
 #else
-	push_sample (fsam, D->raw_cb, D->lp_filter_size);
+	push_sample (fsam, &(D->raw_cb), D->lp_filter_size);
 
 /*
  * Low pass filter to reduce noise yet pass the data. 
  */
 
-	amp = convolve (D->raw_cb, D->lp_filter, D->lp_filter_size);
+	amp = dsp_convolve (delay_line(&(D->raw_cb)), D->lp_filter, D->lp_filter_size);
 #endif
 
 /*
@@ -375,7 +347,7 @@ void demod_9600_process_sample (int chan, int sam, struct demodulator_state_s *D
 
 	  /* Multiple slicers each feeding its own HDLC decoder. */
 
-	  for (slice=0; slice<D->num_slicers; slice++) {
+	  for (slice=D->slicers_off; slice<D->num_slicers-D->slicers_off; slice++) {
 	    demod_data = demod_out - slice_point[slice] > 0;
 	    nudge_pll (chan, subchan, slice, demod_out - slice_point[slice], D);
 	  }
@@ -426,7 +398,134 @@ void demod_9600_process_sample (int chan, int sam, struct demodulator_state_s *D
 	}
 #endif
 
-} /* end demod_9600_process_sample */
+} /* end process_sample */
+
+
+/*-------------------------------------------------------------------
+ *
+ * Name:        process_sample_q
+ *
+ * Purpose:     Version 1.5:  Same as process_sample but using only
+ *		integer arithmetic for processors without floating point.
+ *
+ * Inputs:	sam	- Audio sample, or 0 for upsampling.
+ *		gain	- Multiply filter output by this.  With zero stuffing
+ *			  the audio samples must be scaled up so the average
+ *			  is the same.  We do it after the filter so the
+ *			  input fits in the 16 bit delay line.
+ *
+ * Description:	The normalized AGC output would require a division for
+ *		every sample.  Instead the slicer level is scaled by the
+ *		AGC range.  The result has the same sign as
+ *		demod_out - slice_point  so it works for the bit decision
+ *		and finding zero crossings.
+ *
+ *--------------------------------------------------------------------*/
+
+inline static void nudge_pll_q (int chan, int subchan, int slice, int demod_out, struct demodulator_state_s *D);
+
+#define AGC_CMP_SHIFT 6		/* Drop some fraction bits to leave headroom. */
+
+__attribute__((hot)) __attribute__((always_inline))
+static inline void process_sample_q (int chan, int sam, int gain, struct demodulator_state_s *D)
+{
+	int amp, x, num, den;
+
+	push_sample_q15 (sam, &(D->raw_q15), D->lp_filter_size);
+
+	amp = (dsp_convolve_q15 (delay_line_q15(&(D->raw_q15)), D->lp_filter_q15, D->lp_filter_size) >> D->qp.lp_shift) * gain;
+	x = amp * (1 << AGC_FRAC);
+
+	smooth_q (amp, x >= D->q.alevel_mark_peak ? D->qp.quick_attack : D->qp.sluggish_decay, &(D->q.alevel_mark_peak));
+	smooth_q (amp, x <= D->q.alevel_space_peak ? D->qp.quick_attack : D->qp.sluggish_decay, &(D->q.alevel_space_peak));
+
+	smooth_q (amp, x >= D->q.m_peak ? D->qp.agc_fast_attack : D->qp.agc_slow_decay, &(D->q.m_peak));
+	smooth_q (amp, x <= D->q.m_valley ? D->qp.agc_fast_attack : D->qp.agc_slow_decay, &(D->q.m_valley));
+
+	if (D->q.m_peak > D->q.m_valley) {
+	  num = (x - (int)(((int64_t)D->q.m_peak + D->q.m_valley) >> 1)) >> AGC_CMP_SHIFT;
+	  den = ((D->q.m_peak - D->q.m_valley) >> AGC_CMP_SHIFT) + 1;
+	}
+	else {
+	  num = 0;
+	  den = 1;
+	}
+
+	D->soft_s_q = den;
+
+	if (D->num_slicers <= 1) {
+	  nudge_pll_q (chan, 0, 0, num, D);
+	}
+	else {
+	  int slice;
+
+	  for (slice=D->slicers_off; slice<D->num_slicers-D->slicers_off; slice++) {
+	    nudge_pll_q (chan, 0, slice, num - (int)(((int64_t)slice_point_q16[slice] * den) >> 16), D);
+	  }
+	}
+
+} /* end process_sample_q */
+
+
+__attribute__((hot))
+void demod_9600_process_sample (int chan, int sam, struct demodulator_state_s *D)
+{
+	if (D->use_fixed) {
+	  process_sample_q (chan, sam, 1, D);
+	}
+	else {
+	  process_sample (chan, sam, D);
+	}
+}
+
+
+/*-------------------------------------------------------------------
+ *
+ * Name:        demod_9600_process_block
+ *
+ * Purpose:     Same as demod_9600_process_sample but for a whole
+ *		block of audio samples at once.
+ *
+ * Inputs:	chan	 - Audio channel.  0 for left, 1 for right.
+ *		samples	 - Audio samples in range of -32768 .. 32767.
+ *		n	 - Number of samples.
+ *		upsample - Insert upsample-1 zero samples before each 
+ *			   audio sample.  (See "zerostuff" in demod.c)
+ *
+ * Outputs:	D->block_pos is the index of the audio sample being 
+ *		processed so frames can be placed in time within the block.
+ *
+ * Description:	This avoids a function call, for every upsampled
+ *		audio sample.
+ *
+ *--------------------------------------------------------------------*/
+
+__attribute__((hot))
+void demod_9600_process_block (int chan, const int16_t *samples, int n, int upsample, struct demodulator_state_s *D)
+{
+	int i, k;
+
+	if (D->use_fixed) {
+	  for (i = 0; i < n; i++) {
+	    D->block_pos = i;
+	    rec_level_update_q (samples[i], D);
+	    for (k = 1; k < upsample; k++) {
+	      process_sample_q (chan, 0, upsample, D);
+	    }
+	    process_sample_q (chan, samples[i], upsample, D);
+	  }
+	  return;
+	}
+
+	for (i = 0; i < n; i++) {
+	  D->block_pos = i;
+	  rec_level_update (samples[i] / 16384.0f, D);
+	  for (k = 1; k < upsample; k++) {
+	    process_sample (chan, 0, D);
+	  }
+	  process_sample (chan, samples[i] * upsample, D);
+	}
+}
 
 
 /*-------------------------------------------------------------------
@@ -498,8 +597,12 @@ inline static void nudge_pll (int chan, int subchan, int slice, float demod_out_
 	if ( D->slicer[slice].prev_d_c_pll > 1000000000 && D->slicer[slice].data_clock_pll < -1000000000) {
 
 	  /* Overflow.  Was large positive, wrapped around, now large negative. */
+	  /* Version 1.5:  Pass along how far it is from the slicing */
+	  /* point.  The AGC keeps it in about the -0.5 to +0.5 range. */
 
-	  hdlc_rec_bit (chan, subchan, slice, demod_out_f > 0, 1, D->slicer[slice].lfsr);
+	  int conf = (int)(fabsf(demod_out_f) * 512.0f);
+
+	  hdlc_rec_bit (chan, subchan, slice, demod_out_f > 0, 1, conf > 255 ? 255 : conf);
 	}
 
 /*
@@ -574,4 +677,43 @@ inline static void nudge_pll (int chan, int subchan, int slice, float demod_out_
 } /* end nudge_pll */
 
 
+/*
+ * Version 1.5:  Fixed point version of the above.
+ * demod_out has the same sign as the floating point version but
+ * a different scale.  Only the ratio is used to find where the
+ * zero crossing happened so the scale doesn't matter.
+ */
+
+__attribute__((hot))
+inline static void nudge_pll_q (int chan, int subchan, int slice, int demod_out, struct demodulator_state_s *D)
+{
+	int prev = D->slicer[slice].prev_demod_out_q;
+
+	D->slicer[slice].prev_d_c_pll = D->slicer[slice].data_clock_pll;
+
+	D->slicer[slice].data_clock_pll = (signed)((unsigned)(D->slicer[slice].data_clock_pll) + (unsigned)(D->pll_step_per_sample));
+
+	if ( D->slicer[slice].prev_d_c_pll > 1000000000 && D->slicer[slice].data_clock_pll < -1000000000) {
+
+	  int conf = (int)(((int64_t)abs(demod_out) * 512) / D->soft_s_q);
+
+	  hdlc_rec_bit (chan, subchan, slice, demod_out > 0, 1, conf > 255 ? 255 : conf);
+	}
+
+        if ((prev < 0 && demod_out > 0) || (prev > 0 && demod_out < 0)) {
+
+	  /* Fraction of sample time, Q16, since zero crossing. */
+
+	  int frac = (int) (((int64_t)demod_out * 65536) / ((int64_t)demod_out - prev));
+	  int target = (int) (((int64_t)D->pll_step_per_sample * frac) >> 16);
+	  int inertia = hdlc_rec_gathering (chan, subchan, slice) ? D->qp.pll_locked_inertia : D->qp.pll_searching_inertia;
+
+	  D->slicer[slice].data_clock_pll = (int) (((int64_t)D->slicer[slice].data_clock_pll * inertia + (int64_t)target * (65536 - inertia)) / 65536);
+	}
+
+	D->slicer[slice].prev_demod_out_q = demod_out;
+
+} /* end nudge_pll_q */
+
+
 /* end demod_9600.c */
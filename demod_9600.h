@@ -10,6 +10,8 @@ void demod_9600_init (int samples_per_sec, int baud, struct demodulator_state_s
 
 void demod_9600_process_sample (int chan, int sam, struct demodulator_state_s *D);
 
+void demod_9600_process_block (int chan, const int16_t *samples, int n, int upsample, struct demodulator_state_s *D);
+
 
 
 
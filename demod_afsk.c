@@ -84,33 +84,6 @@ static inline float z (float x, float y)
         }
 }
 
-/* Add sample to buffer and shift the rest down. */
-
-__attribute__((hot)) __attribute__((always_inline))
-static inline void push_sample (float val, float *buff, int size)
-{
-	memmove(buff+1,buff,(size-1)*sizeof(float));
-	buff[0] = val; 
-}
-
-
-/* FIR filter kernel. */
-
-__attribute__((hot)) __attribute__((always_inline))
-static inline float convolve (const float *__restrict__ data, const float *__restrict__ filter, int filter_size)
-{
-	float sum = 0.0f;
-	int j;
-
-
-//#pragma GCC ivdep				// ignored until gcc 4.9
-	for (j=0; j<filter_size; j++) {
-	    sum += filter[j] * data[j];
-	}
-
-	return (sum);
-}
-
 /* Automatic gain control. */
 /* Result should settle down to 1 unit peak to peak.  i.e. -0.5 to +0.5 */
 
@@ -137,6 +110,10 @@ static inline float agc (float in, float fast_attack, float slow_decay, float *p
 	return (0.0f);
 }
 
+
+static void fff_select (int samples_per_sec, int baud, int mark_freq, int space_freq, 
+						char profile, struct demodulator_state_s *D);
+
 #endif	// ifndef GEN_FFF
 
 
@@ -148,6 +125,144 @@ static inline float agc (float in, float fast_attack, float slow_decay, float *p
 #define MAX_G 4.0f
 
 /* TODO: static */  float space_gain[MAX_SUBCHANS];
+static int space_gain_q12[MAX_SUBCHANS];		/* Same for fixed point. */
+
+
+
+/*------------------------------------------------------------------
+ *
+ * Name:        sdft_init
+ *
+ * Purpose:     Set up the sliding DFT alternative to the mark/space filters.
+ *
+ * Inputs:   	samples_per_sec
+ *		mark_freq
+ *		space_freq
+ *		D->ms_filter_size	- Number of samples in the window.
+ *		D->ms_window		- Window shape.
+ *
+ * Outputs:	D->sdft_...
+ *
+ * Description:	The FIR filters calculate, for each tone,
+ *
+ *			sum over j of  x[n-j] * w[j] * exp(-i*f*j)
+ *
+ *		which takes filter_size multiplies for every sample.
+ *		Without the window shape, w, this can be updated recursively
+ *		by rotating the previous sum, adding the new sample, and 
+ *		removing the one leaving the window.  That is the same amount
+ *		of work for any filter length.
+ *
+ *		The window shapes are a sum of cosines so the shaped sum
+ *		can be obtained by combining the unshaped sums at several
+ *		frequencies, f +- m*W, where W depends on the window type.
+ *		The coefficients here must match those in window() in dsp.c.
+ *
+ *		A slight damping, r, is applied so rounding errors
+ *		die out rather than accumulating forever.  The effect is
+ *		the same as multiplying the window by r**j.
+ *
+ *----------------------------------------------------------------*/
+
+#define SDFT_DAMPING 0.99995
+
+static void sdft_init (int samples_per_sec, int mark_freq, int space_freq, struct demodulator_state_s *D)
+{
+	int size = D->ms_filter_size;
+	double center = 0.5 * (size - 1);
+	double W;		/* Spacing of frequencies, radians / sample. */
+	double b[5];		/* Weight of cos (m * W * (j - center)) in window shape. */
+	int nterms;
+	int m, k, t, j;
+	double rN = pow (SDFT_DAMPING, size);
+	double G;
+
+	memset (b, 0, sizeof(b));
+
+	switch (D->ms_window) {
+
+	  case BP_WINDOW_COSINE:
+	    W = M_PI / size;
+	    b[0] = 0;
+	    b[1] = 1;
+	    nterms = 2;
+	    break;
+
+	  case BP_WINDOW_HAMMING:
+	    W = 2 * M_PI / (size - 1);
+	    b[0] = 0.53836;
+	    b[1] = 0.46164;
+	    nterms = 2;
+	    break;
+
+	  case BP_WINDOW_BLACKMAN:
+	    W = 2 * M_PI / (size - 1);
+	    b[0] = 0.42659;
+	    b[1] = 0.49656;
+	    b[2] = 0.076849;
+	    nterms = 3;
+	    break;
+
+	  case BP_WINDOW_FLATTOP:
+	    W = 2 * M_PI / (size - 1);
+	    b[0] = 1.0;
+	    b[1] = 1.93;
+	    b[2] = 1.29;
+	    b[3] = 0.388;
+	    b[4] = 0.028;
+	    nterms = 5;
+	    break;
+
+	  case BP_WINDOW_TRUNCATED:
+	  default:
+	    W = 0;
+	    b[0] = 1;
+	    nterms = 1;
+	    break;
+	}
+
+/*
+ * One bin for each frequency offset, 0 or +- m * W, with a non-zero weight.
+ */
+	D->sdft_bins = 0;
+
+	for (m = 0; m < nterms; m++) {
+	  int sign;
+
+	  if (b[m] == 0) continue;
+
+	  for (sign = (m == 0 ? 1 : -1); sign <= 1; sign += 2) {
+	    double offset = sign * m * W;
+	    double weight = (m == 0 ? b[0] : 0.5 * b[m]);
+
+	    k = D->sdft_bins;
+	    assert (k < MAX_SDFT_BINS);
+
+	    D->sdft_mix_re[k] = weight * cos(offset * center);
+	    D->sdft_mix_im[k] = weight * sin(offset * center);
+
+	    for (t = 0; t < 2; t++) {
+	      double fk = 2 * M_PI * (t == 0 ? mark_freq : space_freq) / samples_per_sec + offset;
+
+	      D->sdft[t].rot_re[k] = SDFT_DAMPING * cos(fk);
+	      D->sdft[t].rot_im[k] = - SDFT_DAMPING * sin(fk);
+	      D->sdft[t].old_re[k] = rN * cos(fk * size);
+	      D->sdft[t].old_im[k] = - rN * sin(fk * size);
+	    }
+	    D->sdft_bins++;
+	  }
+	}
+
+/*
+ * Amplitude of sum for sine wave of amplitude 1 is half the sum of the weights.
+ */
+	G = 0;
+	for (j = 0; j < size; j++) {
+	  G += window (D->ms_window, size, j) * pow (SDFT_DAMPING, j);
+	}
+	D->sdft_gain = 2.0 / G;
+
+}  /* end sdft_init */
 
 
 
@@ -197,21 +312,6 @@ void demod_afsk_init (int samples_per_sec, int baud, int mark_freq,
 #endif
 
 
-	if (profile == 'F') {
-
-	  if (baud != DEFAULT_BAUD ||
-	      mark_freq != DEFAULT_MARK_FREQ ||
-	      space_freq!= DEFAULT_SPACE_FREQ ||
-	      samples_per_sec != DEFAULT_SAMPLES_PER_SEC) {
-
-	    	text_color_set(DW_COLOR_INFO);
-		dw_printf ("Note: Decoder 'F' works only for %d baud, %d/%d tones, %d samples/sec.\n",
-			DEFAULT_BAUD, DEFAULT_MARK_FREQ, DEFAULT_SPACE_FREQ, DEFAULT_SAMPLES_PER_SEC);
-		dw_printf ("Using Decoder 'A' instead.\n");
-		profile = 'A';
-	  }
-	}
-
 	D->profile = profile;		// so we know whether to take fast path later.
 
 	switch (profile) {
@@ -354,6 +454,32 @@ void demod_afsk_init (int samples_per_sec, int baud, int mark_freq,
 	    D->pll_searching_inertia = 0.50;
 	    break;
 
+	  case 'H':
+
+		/* Version 1.5 */
+		/* Sliding DFT rather than FIR filters for mark and space. */
+		/* Same amount of computation for any filter length so */
+		/* it's good for 300 baud at a high sample rate on a slow processor. */
+		/* No prefilter and the IIR lowpass to keep it that way. */
+
+	    D->use_prefilter = 0;
+
+	    D->use_sdft = 1;
+	    D->ms_filter_len_bits = 1.6;
+	    D->ms_window = BP_WINDOW_TRUNCATED;	/* Others work but not as well. */
+
+	    D->lpf_use_fir = 0;
+	    D->lpf_baud = 1.5;
+	    D->lpf_iir = 1.0f - expf(-2.0f * (float)M_PI * D->lpf_baud * baud / (float)samples_per_sec);
+
+	    D->agc_fast_attack = 0.495;		
+	    D->agc_slow_decay = 0.00022;
+	    D->hysteresis = 0.027;
+
+	    D->pll_locked_inertia = 0.620;
+	    D->pll_searching_inertia = 0.350;
+	    break;
+
 	  case 'G':
 
 		/* 1200 baud - Started out same as E but add 3 way interleave. */
@@ -607,6 +733,15 @@ void demod_afsk_init (int samples_per_sec, int baud, int mark_freq,
 	    D->s_cos_table[j] = D->s_cos_table[j] / Gc;
 	  }
 
+	if (D->use_sdft) {
+	  sdft_init (samples_per_sec, mark_freq, space_freq, D);
+	}
+#ifndef GEN_FFF
+	else {
+	  fff_select (samples_per_sec, baud, mark_freq, space_freq, profile, D);
+	}
+#endif
+
 /*
  * Now the lowpass filter.
  * I thought we'd want a cutoff of about 0.5 the baud rate 
@@ -677,6 +812,9 @@ failed experiment
 	for (j=1; j<MAX_SUBCHANS; j++) {
 	  space_gain[j] = space_gain[j-1] * step;
 	}
+	for (j=0; j<MAX_SUBCHANS; j++) {
+	  space_gain_q12[j] = (int) lrintf(space_gain[j] * 4096);
+	}
 
 #ifndef GEN_FFF
 #if 0
@@ -694,10 +832,23 @@ failed experiment
 #if GEN_FFF
 
 
-
-// Properties of the radio channels.
-
-static struct audio_s modem;
+/*-------------------------------------------------------------------
+ *
+ * Name:        gen_fff
+ *
+ * Purpose:     Generate fsk_fast_filter.h at build time.
+ *
+ * Description:	Originally this produced unrolled code for profile 'F' 
+ *		at one sample rate.  In version 1.5 it produces a 
+ *		mark/space correlator for each combination of profile,
+ *		sample rate, baud, and tones listed below.  
+ *		The filter length and coefficients are constants 
+ *		so the compiler can unroll and schedule them.
+ *
+ *		demod_afsk_init picks a matching one at run time and
+ *		falls back to the general case for anything else.
+ *
+ *--------------------------------------------------------------------*/
 
 
 // Filters will be stored here. 
@@ -705,56 +856,98 @@ static struct audio_s modem;
 static struct demodulator_state_s ds;
 
 
-#define SPARSE 3
+/*
+ * Audio sample rates commonly used.  
+ * The demodulator sees this divided by the decimation factor.
+ */
 
+static const int fff_rates[] = { 44100, 48000, 96000 };
 
-static void emit_macro (char *name, int size, float *coeff)
-{
-	int i;
+/*
+ * Modems and the profiles normally used with them.
+ * These should be kept in agreement with the defaults picked in demod_init.
+ * Some filters would be longer than MAX_FILTER_SIZE at the highest rate.
+ */
 
-	dw_printf ("#define %s(x) \\\n", name);
+static const struct {
+	int baud;
+	int mark_freq;
+	int space_freq;
+	int decimate;
+	int max_rate;
+	char *profiles;
+} fff_modems[] = {
+
+	{ DEFAULT_BAUD, DEFAULT_MARK_FREQ, DEFAULT_SPACE_FREQ, 1, 96000, "ABCF" },
+	{ DEFAULT_BAUD, DEFAULT_MARK_FREQ, DEFAULT_SPACE_FREQ, 1, 48000, "E" },
+	{ DEFAULT_BAUD, DEFAULT_MARK_FREQ, DEFAULT_SPACE_FREQ, 3, 96000, "E" },	/* Default for ARM. */
+	{ 300, 1600, 1800, 3, 96000, "D" },						/* Default for 300 baud. */
+};
 
-	for (i=SPARSE/2; i<size; i+=SPARSE) {
-	  dw_printf ("\t%c (%.6ff * x[%d]) \\\n", (i==0 ? ' ' : '+'), coeff[i], i);
-	}
-	dw_printf ("\n");
-}
 
 int main (void)
 {
-	//int n;
-	char fff_profile;
+	int m, r, n;
+	const char *p;
+	char name[40];
 
-	fff_profile = 'F';		
+	printf ("/* This is an automatically generated file.  Do not edit. */\n");
+	printf ("\n");
 
-	memset (&modem, 0, sizeof(modem));
-	memset (&ds, 0, sizeof(ds));
+	for (m = 0; m < (int)(sizeof(fff_modems) / sizeof(fff_modems[0])); m++) {
+	  for (r = 0; r < (int)(sizeof(fff_rates) / sizeof(fff_rates[0])); r++) {
+	    for (p = fff_modems[m].profiles; *p != '\0' && fff_rates[r] <= fff_modems[m].max_rate; p++) {
 
-	modem.adev[0].num_channels = 1;
-	modem.adev[0].samples_per_sec = DEFAULT_SAMPLES_PER_SEC;
-	modem.achan[0].mark_freq = DEFAULT_MARK_FREQ;
-	modem.achan[0].space_freq = DEFAULT_SPACE_FREQ;
-	modem.achan[0].baud = DEFAULT_BAUD;
- 	modem.achan[0].num_subchan = 1;
- 	modem.achan[0].num_slicers = 1;
+	      int samples_per_sec = fff_rates[r] / fff_modems[m].decimate;
+	      int j;
 
+	      demod_afsk_init (samples_per_sec, fff_modems[m].baud,
+			fff_modems[m].mark_freq, fff_modems[m].space_freq, *p, &ds);
 
-	demod_afsk_init (modem.adev[0].samples_per_sec, modem.achan[0].baud,
-			modem.achan[0].mark_freq, modem.achan[0].space_freq, fff_profile, &ds);
-	
-	printf ("/* This is an automatically generated file.  Do not edit. */\n");
-	printf ("\n");
-	printf ("#define FFF_SAMPLES_PER_SEC %d\n", modem.adev[0].samples_per_sec);
-	printf ("#define FFF_BAUD %d\n", modem.achan[0].baud);
-	printf ("#define FFF_MARK_FREQ %d\n", modem.achan[0].mark_freq);
-	printf ("#define FFF_SPACE_FREQ %d\n", modem.achan[0].space_freq);
-	printf ("#define FFF_PROFILE '%c'\n", fff_profile);
-	printf ("\n");
+	      snprintf (name, sizeof(name), "fff_%c_%d_%d", *p, fff_modems[m].baud, samples_per_sec);
+
+	      printf ("\n/* %c, %d baud, %d & %d Hz, %d samples per second. */\n\n", 
+			*p, fff_modems[m].baud, fff_modems[m].mark_freq, fff_modems[m].space_freq, samples_per_sec);
+
+	      printf ("static const float %s[%d][4] = {\n", name, ds.ms_filter_size);
+	      for (j = 0; j < ds.ms_filter_size; j++) {
+	        printf ("\t{ %.8ef, %.8ef, %.8ef, %.8ef },\n",
+			ds.m_sin_table[j], ds.m_cos_table[j], ds.s_sin_table[j], ds.s_cos_table[j]);
+	      }
+	      printf ("};\n\n");
+
+	      printf ("static void %s_calc (const float *x, float *sums)\n", name);
+	      printf ("{\n");
+	      printf ("\t%s (x, %s, %d, sums);\n", *p == 'F' ? "fff_calc_sparse" : "fff_calc", name, ds.ms_filter_size);
+	      printf ("}\n");
+	    }
+	  }
+	}
 
-	emit_macro ("CALC_M_SUM1", ds.ms_filter_size, ds.m_sin_table);
-	emit_macro ("CALC_M_SUM2", ds.ms_filter_size, ds.m_cos_table);
-	emit_macro ("CALC_S_SUM1", ds.ms_filter_size, ds.s_sin_table);
-	emit_macro ("CALC_S_SUM2", ds.ms_filter_size, ds.s_cos_table);
+	printf ("\n\nstatic const struct fff_kernel_s fff_kernel[] = {\n");
+
+	n = 0;
+	for (m = 0; m < (int)(sizeof(fff_modems) / sizeof(fff_modems[0])); m++) {
+	  for (r = 0; r < (int)(sizeof(fff_rates) / sizeof(fff_rates[0])); r++) {
+	    for (p = fff_modems[m].profiles; *p != '\0' && fff_rates[r] <= fff_modems[m].max_rate; p++) {
+
+	      int samples_per_sec = fff_rates[r] / fff_modems[m].decimate;
+
+	      demod_afsk_init (samples_per_sec, fff_modems[m].baud,
+			fff_modems[m].mark_freq, fff_modems[m].space_freq, *p, &ds);
+
+	      snprintf (name, sizeof(name), "fff_%c_%d_%d", *p, fff_modems[m].baud, samples_per_sec);
+
+	      printf ("\t{ '%c', %d, %d, %d, %d, %d, %s, %s_calc },\n", *p, samples_per_sec, 
+			fff_modems[m].baud, fff_modems[m].mark_freq, fff_modems[m].space_freq,
+			ds.ms_filter_size, name, name);
+	      n++;
+	    }
+	  }
+	}
+
+	printf ("};\n\n");
+	printf ("#define FFF_NUM_KERNELS %d\n", n);
 
 	exit(EXIT_SUCCESS);
 }
@@ -765,11 +958,253 @@ int main (void)
 
 #ifndef GEN_FFF
 
-/* Optimization for slow processors. */
+/* 
+ * Optimization for slow processors.
+ *
+ * Version 1.5:  The mark/space correlators are generated ahead of time 
+ * for the usual combinations of profile, sample rate, baud, and tones.
+ * Each one is a small wrapper around fff_calc, or fff_calc_sparse for
+ * profile 'F', with the filter size and coefficients as constants.
+ */
+
+#define FFF_SPARSE 3		/* 'F' uses only every third tap. */
+
+struct fff_kernel_s {
+	char profile;
+	int samples_per_sec;		/* After decimation. */
+	int baud;
+	int mark_freq;
+	int space_freq;
+	int size;			/* Number of taps. */
+	const float (*coeff)[4];	/* Mark sin & cos, space sin & cos for each tap. */
+	void (*calc) (const float *x, float *sums);
+};
+
+__attribute__((hot)) __attribute__((always_inline))
+static inline void fff_calc (const float *x, const float (*coeff)[4], int size, float *sums)
+{
+	float s[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	int j, k;
+
+	for (j = 0; j < size; j++) {
+	  for (k = 0; k < 4; k++) {
+	    s[k] += coeff[j][k] * x[j];
+	  }
+	}
+	for (k = 0; k < 4; k++) {
+	  sums[k] = s[k];
+	}
+}
+
+__attribute__((hot)) __attribute__((always_inline))
+static inline void fff_calc_sparse (const float *x, const float (*coeff)[4], int size, float *sums)
+{
+	float s[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	int j, k;
+
+	for (j = FFF_SPARSE / 2; j < size; j += FFF_SPARSE) {
+	  for (k = 0; k < 4; k++) {
+	    s[k] += coeff[j][k] * x[j];
+	  }
+	}
+	for (k = 0; k < 4; k++) {
+	  sums[k] = s[k];
+	}
+}
 
 #include "fsk_fast_filter.h"
 
 
+/*-------------------------------------------------------------------
+ *
+ * Name:        fff_select
+ *
+ * Purpose:     Pick a generated mark/space correlator for a demodulator.
+ *
+ * Inputs:	samples_per_sec, baud, mark_freq, space_freq, profile
+ *			- Same as for demod_afsk_init.
+ *		D	- Demodulator with the mark and space tables filled in.
+ *
+ * Outputs:	D->ms_calc	- Generated correlator or NULL for general case.
+ *		D->profile	- 'F' is changed to 'A' if not available.
+ *
+ * Description:	The coefficients are compared too in case they were
+ *		generated with different tune.h settings.
+ *
+ *		The generated code is used only when we don't have 
+ *		SIMD filter kernels.  Those are faster when available.
+ *		'F' is different.  It uses only some of the taps so
+ *		it must always use its own.
+ *
+ *--------------------------------------------------------------------*/
+
+static void fff_select (int samples_per_sec, int baud, int mark_freq, int space_freq, 
+						char profile, struct demodulator_state_s *D)
+{
+	const struct fff_kernel_s *found = NULL;
+	int n, j;
+
+	D->ms_calc = NULL;
+
+	for (n = 0; n < FFF_NUM_KERNELS && found == NULL; n++) {
+	  const struct fff_kernel_s *k = &(fff_kernel[n]);
+
+	  if (k->profile == profile && k->samples_per_sec == samples_per_sec && k->baud == baud &&
+		k->mark_freq == mark_freq && k->space_freq == space_freq && k->size == D->ms_filter_size) {
+
+	    found = k;
+	    for (j = 0; j < k->size; j++) {
+	      if (k->coeff[j][0] != D->m_sin_table[j] || k->coeff[j][1] != D->m_cos_table[j] ||
+		  k->coeff[j][2] != D->s_sin_table[j] || k->coeff[j][3] != D->s_cos_table[j]) {
+	        found = NULL;
+	        break;
+	      }
+	    }
+	  }
+	}
+
+	if (profile == 'F') {
+	  if (found == NULL) {
+	    text_color_set(DW_COLOR_INFO);
+	    dw_printf ("Note: Decoder 'F' is not available for %d baud, %d/%d tones, %d samples/sec.\n",
+			baud, mark_freq, space_freq, samples_per_sec);
+	    dw_printf ("Using Decoder 'A' instead.\n");
+	    D->profile = 'A';
+	    return;
+	  }
+	  D->ms_calc = found->calc;
+	}
+	else if (found != NULL && strcmp(dsp_kernel_name(), "generic") == 0) {
+	  D->ms_calc = found->calc;
+	}
+}
+
+/* 
+ * Version 1.5:  Sliding DFT update for one tone.  See sdft_init.
+ * Returns amplitude of the tone.
+ */
+
+__attribute__((hot)) __attribute__((always_inline))
+static inline float sdft_update (float in, float leaving, struct sdft_tone_s *T, struct demodulator_state_s *D)
+{
+	float yr = 0.0f, yi = 0.0f;
+	int k;
+
+	for (k = 0; k < D->sdft_bins; k++) {
+	  float ar = in + T->rot_re[k] * T->acc_re[k] - T->rot_im[k] * T->acc_im[k] - T->old_re[k] * leaving;
+	  float ai = T->rot_re[k] * T->acc_im[k] + T->rot_im[k] * T->acc_re[k] - T->old_im[k] * leaving;
+
+	  T->acc_re[k] = ar;
+	  T->acc_im[k] = ai;
+
+	  yr += D->sdft_mix_re[k] * ar - D->sdft_mix_im[k] * ai;
+	  yi += D->sdft_mix_re[k] * ai + D->sdft_mix_im[k] * ar;
+	}
+
+	return (sqrtf(yr * yr + yi * yi) * D->sdft_gain);
+}
+
+
+/*-------------------------------------------------------------------
+ *
+ * Name:        mark_space_amplitudes
+ *
+ * Purpose:     Front end of the demodulator.  Find the amplitudes
+ *		of the mark and space tones.
+ *
+ * Inputs:	fsam	- One audio sample, scaled to about -2 .. +2.
+ *		D	- Demodulator state.  Only the prefilter and 
+ *			  mark/space filter parts are used here.
+ *
+ * Outputs:	pm_amp	- Amplitude of the mark tone.
+ *		ps_amp	- Amplitude of the space tone.
+ *
+ * Description:	This is split out from the rest so subchannels with
+ *		identical tones and filters can share the results.
+ *
+ *--------------------------------------------------------------------*/
+
+__attribute__((hot)) __attribute__((always_inline))
+static inline void mark_space_amplitudes (float fsam, struct demodulator_state_s *D, float *pm_amp, float *ps_amp)
+{
+	float m_sum1, m_sum2, s_sum1, s_sum2;
+
+/*
+ * Optional bandpass filter before the mark/space discriminator.
+ */
+
+	float ms_in = fsam;
+
+	if (D->use_prefilter) {
+	  push_sample (fsam, &(D->raw_cb), D->pre_filter_size);
+	  ms_in = dsp_convolve (delay_line(&(D->raw_cb)), D->pre_filter, D->pre_filter_size);
+	}
+
+/*
+ * Version 1.5:  Sliding DFT alternative.  
+ * Needs the sample about to fall off the end of the window.
+ */
+	if (D->use_sdft) {
+	  float leaving = delay_line(&(D->ms_in_cb))[D->ms_filter_size - 1];
+
+	  push_sample (ms_in, &(D->ms_in_cb), D->ms_filter_size);
+
+	  *pm_amp = sdft_update (ms_in, leaving, &(D->sdft[0]), D);
+	  *ps_amp = sdft_update (ms_in, leaving, &(D->sdft[1]), D);
+	  return;
+	}
+
+	push_sample (ms_in, &(D->ms_in_cb), D->ms_filter_size);
+
+/*
+ * Next we have bandpass filters for the mark and space tones.
+ *
+ * This takes a lot of computation.
+ * It's not a problem on a typical (Intel x86 based) PC.
+ * Dire Wolf takes only about 2 or 3% of the CPU time.
+ *
+ * It might be too much for a little microcomputer to handle.
+ *
+ * Here we have optimized cases for the usual values.
+ */
+
+/*
+ * Find amplitudes of "Mark" and "Space" tones.
+ *
+ * Version 1.5:  All four correlations are done in one pass
+ * over the samples rather than going thru them four times.
+ * Use code generated for this particular case if we have it.
+ */
+	float sums[4];
+
+	if (D->ms_calc != NULL) {
+	  (*D->ms_calc) (delay_line(&(D->ms_in_cb)), sums);
+	}
+	else {
+	  dsp_convolve4 (delay_line(&(D->ms_in_cb)), D->m_sin_table, D->m_cos_table,
+				D->s_sin_table, D->s_cos_table, D->ms_filter_size, sums);
+	}
+	m_sum1 = sums[0];
+	m_sum2 = sums[1];
+	s_sum1 = sums[2];
+	s_sum2 = sums[3];
+
+	if (D->profile == 'F') {
+
+				/* ========== Faster for default values on slower processors. ========== */
+
+	  *pm_amp = z(m_sum1,m_sum2);
+	  *ps_amp = z(s_sum1,s_sum2);
+	}
+	else {
+	  *pm_amp = sqrtf(m_sum1 * m_sum1 + m_sum2 * m_sum2);
+	  *ps_amp = sqrtf(s_sum1 * s_sum1 + s_sum2 * s_sum2);
+	}
+
+} /* end mark_space_amplitudes */
+
+
+
 
 /*-------------------------------------------------------------------
  *
@@ -810,12 +1245,11 @@ int main (void)
 
 inline static void nudge_pll (int chan, int subchan, int slice, int demod_data, struct demodulator_state_s *D);
 
-__attribute__((hot))
-void demod_afsk_process_sample (int chan, int subchan, int sam, struct demodulator_state_s *D)
+__attribute__((hot)) __attribute__((always_inline))
+static inline void process_sample (int chan, int subchan, int sam, struct demodulator_state_s *D)
 {
 	float fsam;
 	//float abs_fsam;
-	float m_sum1, m_sum2, s_sum1, s_sum2;
 	float m_amp, s_amp;
 	float m_norm, s_norm;
 	float demod_out;
@@ -835,11 +1269,9 @@ void demod_afsk_process_sample (int chan, int subchan, int sam, struct demodulat
 /* 
  * Filters use last 'filter_size' samples.
  *
- * First push the older samples down. 
- *
- * Finally, put the most recent at the beginning.
- *
- * Future project?  Can we do better than shifting each time?
+ * Version 1.5:  The delay lines are now mirrored circular buffers
+ * so nothing needs to be shifted for each new sample.
+ * delay_line() gives us the most recent at the beginning as before.
  */
 
 	/* Scale to nice number, TODO: range -1.0 to +1.0, not 2. */
@@ -850,72 +1282,26 @@ void demod_afsk_process_sample (int chan, int subchan, int sam, struct demodulat
 
 
 /*
- * Optional bandpass filter before the mark/space discriminator.
- */
-
-	if (D->use_prefilter) {
-	  float cleaner;
-
-	  push_sample (fsam, D->raw_cb, D->pre_filter_size);
-	  cleaner = convolve (D->raw_cb, D->pre_filter, D->pre_filter_size);
-	  push_sample (cleaner, D->ms_in_cb, D->ms_filter_size);
-	}
-	else {
-	  push_sample (fsam, D->ms_in_cb, D->ms_filter_size);
-	}
-
-/*
- * Next we have bandpass filters for the mark and space tones.
+ * Amplitudes of the mark and space tones.
  *
- * This takes a lot of computation.
- * It's not a problem on a typical (Intel x86 based) PC.
- * Dire Wolf takes only about 2 or 3% of the CPU time.
- *
- * It might be too much for a little microcomputer to handle.
- *
- * Here we have an optimized case for the default values.
+ * Version 1.5:  Another subchannel, with the same tones and filters,
+ * might have already done this for the same audio sample.
+ * If so, use its results.  If others will be using ours, save them.
+ * block_pos identifies the sample within the current block.
  */
 
-
-
-// TODO1.2:   is this right or do we need to store profile in the modulator info?
-
-	
-	if (D->profile == toupper(FFF_PROFILE)) {
-
-				/* ========== Faster for default values on slower processors. ========== */
-
-	  m_sum1 = CALC_M_SUM1(D->ms_in_cb);
-	  m_sum2 = CALC_M_SUM2(D->ms_in_cb);
-	  m_amp = z(m_sum1,m_sum2);
-
-	  s_sum1 = CALC_S_SUM1(D->ms_in_cb);
-	  s_sum2 = CALC_S_SUM2(D->ms_in_cb);
-	  s_amp = z(s_sum1,s_sum2);
+	if (D->ms_source != NULL) {
+	  m_amp = D->ms_source->m_amp_share[D->block_pos];
+	  s_amp = D->ms_source->s_amp_share[D->block_pos];
 	}
 	else {
+	  mark_space_amplitudes (fsam, D, &m_amp, &s_amp);
 
-				/* ========== General case to handle all situations. ========== */
-	
-/*
- * find amplitude of "Mark" tone.
- */
-	  m_sum1 = convolve (D->ms_in_cb, D->m_sin_table, D->ms_filter_size);
-	  m_sum2 = convolve (D->ms_in_cb, D->m_cos_table, D->ms_filter_size);
-
-	  m_amp = sqrtf(m_sum1 * m_sum1 + m_sum2 * m_sum2);
-
-/*
- * Find amplitude of "Space" tone.
- */
-	  s_sum1 = convolve (D->ms_in_cb, D->s_sin_table, D->ms_filter_size);
-	  s_sum2 = convolve (D->ms_in_cb, D->s_cos_table, D->ms_filter_size);
-
-	  s_amp = sqrtf(s_sum1 * s_sum1 + s_sum2 * s_sum2);
-
-				/* ========== End of general case. ========== */
+	  if (D->m_amp_share != NULL) {
+	    D->m_amp_share[D->block_pos] = m_amp;
+	    D->s_amp_share[D->block_pos] = s_amp;
+	  }
 	}
-		
 
 /* 
  * Apply some low pass filtering BEFORE the AGC to remove
@@ -929,11 +1315,11 @@ void demod_afsk_process_sample (int chan, int subchan, int sam, struct demodulat
 
 	if (D->lpf_use_fir) {
 
-	  push_sample (m_amp, D->m_amp_cb, D->lp_filter_size);
-	  m_amp = convolve (D->m_amp_cb, D->lp_filter, D->lp_filter_size);
+	  push_sample (m_amp, &(D->m_amp_cb), D->lp_filter_size);
+	  m_amp = dsp_convolve (delay_line(&(D->m_amp_cb)), D->lp_filter, D->lp_filter_size);
 
-	  push_sample (s_amp, D->s_amp_cb, D->lp_filter_size);
-	  s_amp = convolve (D->s_amp_cb, D->lp_filter, D->lp_filter_size);
+	  push_sample (s_amp, &(D->s_amp_cb), D->lp_filter_size);
+	  s_amp = dsp_convolve (delay_line(&(D->s_amp_cb)), D->lp_filter, D->lp_filter_size);
 	}
 	else {
 	
@@ -1026,6 +1412,8 @@ void demod_afsk_process_sample (int chan, int subchan, int sam, struct demodulat
 	  /* AGC should generally keep this around -1 to +1 range. */
 
 	  demod_out = m_norm - s_norm;
+	  D->soft_m = m_norm;
+	  D->soft_s = s_norm;
 
 	  /* Try adding some Hysteresis. */
 	  /* (Not to be confused with Hysteria.) */
@@ -1044,7 +1432,10 @@ void demod_afsk_process_sample (int chan, int subchan, int sam, struct demodulat
 	else {
 	  int slice;
 
-	  for (slice=0; slice<D->num_slicers; slice++) {
+	  D->soft_m = m_amp;
+	  D->soft_s = s_amp;
+
+	  for (slice=D->slicers_off; slice<D->num_slicers-D->slicers_off; slice++) {
 	    demod_data = m_amp > s_amp * space_gain[slice];
 	    nudge_pll (chan, subchan, slice, demod_data, D);
 	  }
@@ -1084,7 +1475,299 @@ void demod_afsk_process_sample (int chan, int subchan, int sam, struct demodulat
 #endif
 
 
-} /* end demod_afsk_process_sample */
+} /* end process_sample */
+
+
+/*-------------------------------------------------------------------
+ *
+ * Name:        process_sample_q
+ *
+ * Purpose:     Version 1.5:  Same as process_sample but using only
+ *		integer arithmetic for processors without floating point.
+ *
+ * Description:	Samples and amplitudes are kept in the original 16 bit
+ *		units, with 16 bit delay lines and 32 bit sums.  See 
+ *		dsp_q15_shift for why the filters can't overflow.
+ *
+ *		The AGC normalization would require division.  Instead
+ *		of comparing  m_norm - s_norm  with the hysteresis, we
+ *		multiply both sides by the two ranges and compare that.
+ *
+ *		Only the FIR filter profiles are handled.  The sliding
+ *		DFT, profile H, is always floating point.
+ *
+ *--------------------------------------------------------------------*/
+
+/* Amplitude from sin and cos correlations. */
+
+__attribute__((hot)) __attribute__((always_inline))
+static inline int magnitude_q (int32_t i, int32_t q, int shift)
+{
+	i >>= shift;
+	q >>= shift;
+	return ((int) dsp_isqrt ((uint32_t)(i * i) + (uint32_t)(q * q)));
+}
+
+/* AGC, without the normalization, leaving (in - center) / range as num / den. */
+
+#define AGC_CMP_SHIFT 6		/* Drop some fraction bits so products fit in 64. */
+
+__attribute__((hot)) __attribute__((always_inline))
+static inline void agc_q (int in, struct demodulator_state_s *D, int *ppeak, int *pvalley, int *num, int *den)
+{
+	int x = in * (1 << AGC_FRAC);
+
+	smooth_q (in, x >= *ppeak ? D->qp.agc_fast_attack : D->qp.agc_slow_decay, ppeak);
+	smooth_q (in, x <= *pvalley ? D->qp.agc_fast_attack : D->qp.agc_slow_decay, pvalley);
+
+	if (*ppeak > *pvalley) {
+	  *num = (x - (int)(((int64_t)*ppeak + *pvalley) >> 1)) >> AGC_CMP_SHIFT;
+	  *den = ((*ppeak - *pvalley) >> AGC_CMP_SHIFT) + 1;
+	}
+	else {
+	  *num = 0;
+	  *den = 1;
+	}
+}
+
+__attribute__((hot)) __attribute__((always_inline))
+static inline void process_sample_q (int chan, int subchan, int sam, struct demodulator_state_s *D)
+{
+	int ms_in = sam;
+	int32_t sums[4];
+	int m_amp, s_amp;
+	int m_num, m_den, s_num, s_den;
+	int demod_data;
+
+	if (D->use_prefilter) {
+	  push_sample_q15 (sam, &(D->raw_q15), D->pre_filter_size);
+	  ms_in = dsp_convolve_q15 (delay_line_q15(&(D->raw_q15)), D->pre_filter_q15, D->pre_filter_size) >> D->qp.pre_shift;
+	}
+
+	push_sample_q15 (ms_in, &(D->ms_in_q15), D->ms_filter_size);
+
+	dsp_convolve4_q15 (delay_line_q15(&(D->ms_in_q15)), D->m_sin_q15, D->m_cos_q15,
+				D->s_sin_q15, D->s_cos_q15, D->ms_filter_size, sums);
+
+	m_amp = magnitude_q (sums[0], sums[1], D->qp.ms_shift);
+	s_amp = magnitude_q (sums[2], sums[3], D->qp.ms_shift);
+
+	if (D->lpf_use_fir) {
+
+	  push_sample_q15 (m_amp, &(D->m_amp_q15), D->lp_filter_size);
+	  m_amp = dsp_convolve_q15 (delay_line_q15(&(D->m_amp_q15)), D->lp_filter_q15, D->lp_filter_size) >> D->qp.lp_shift;
+
+	  push_sample_q15 (s_amp, &(D->s_amp_q15), D->lp_filter_size);
+	  s_amp = dsp_convolve_q15 (delay_line_q15(&(D->s_amp_q15)), D->lp_filter_q15, D->lp_filter_size) >> D->qp.lp_shift;
+	}
+	else {
+
+	  m_amp = (D->qp.lpf_iir * m_amp + (32768 - D->qp.lpf_iir) * D->q.m_amp_prev) >> 15;
+	  D->q.m_amp_prev = m_amp;
+
+	  s_amp = (D->qp.lpf_iir * s_amp + (32768 - D->qp.lpf_iir) * D->q.s_amp_prev) >> 15;
+	  D->q.s_amp_prev = s_amp;
+	}
+
+	smooth_q (m_amp, m_amp * (1 << AGC_FRAC) >= D->q.alevel_mark_peak ? D->qp.quick_attack : D->qp.sluggish_decay, &(D->q.alevel_mark_peak));
+	smooth_q (s_amp, s_amp * (1 << AGC_FRAC) >= D->q.alevel_space_peak ? D->qp.quick_attack : D->qp.sluggish_decay, &(D->q.alevel_space_peak));
+
+	agc_q (m_amp, D, &(D->q.m_peak), &(D->q.m_valley), &m_num, &m_den);
+	agc_q (s_amp, D, &(D->q.s_peak), &(D->q.s_valley), &s_num, &s_den);
+
+	if (D->num_slicers <= 1) {
+
+	  /*   m_num / m_den - s_num / s_den   compared to  hysteresis. */
+
+	  int64_t diff = (int64_t)m_num * s_den - (int64_t)s_num * m_den;
+	  int64_t h = (((int64_t)D->qp.hysteresis * m_den) >> 16) * s_den;
+
+	  D->soft_m_q = diff;
+	  D->soft_s_q = (int64_t)m_den * s_den;
+
+	  if (diff > h) {
+	    demod_data = 1;
+	  }
+	  else if (diff < -h) {
+	    demod_data = 0;
+	  }
+	  else {
+	    demod_data = D->slicer[subchan].prev_demod_data;
+	  }
+	  nudge_pll (chan, subchan, 0, demod_data, D);
+	}
+	else {
+	  int slice;
+
+	  D->soft_m_q = m_amp;
+	  D->soft_s_q = s_amp;
+
+	  for (slice=D->slicers_off; slice<D->num_slicers-D->slicers_off; slice++) {
+	    demod_data = m_amp * 4096 > s_amp * space_gain_q12[slice];
+	    nudge_pll (chan, subchan, slice, demod_data, D);
+	  }
+	}
+
+} /* end process_sample_q */
+
+
+__attribute__((hot))
+void demod_afsk_process_sample (int chan, int subchan, int sam, struct demodulator_state_s *D)
+{
+	if (D->use_fixed) {
+	  process_sample_q (chan, subchan, sam, D);
+	}
+	else {
+	  process_sample (chan, subchan, sam, D);
+	}
+}
+
+
+/*-------------------------------------------------------------------
+ *
+ * Name:        demod_afsk_process_block
+ *
+ * Purpose:     Same as demod_afsk_process_sample but for a whole
+ *		block of audio samples at once.
+ *
+ * Inputs:	chan	- Audio channel.  0 for left, 1 for right.
+ *		subchan - modem of the channel.
+ *		samples	- Audio samples in range of -32768 .. 32767.
+ *		n	- Number of samples.
+ *
+ * Outputs:	D->block_pos is the index of the sample being processed
+ *		so frames can be placed in time within the block.
+ *
+ * Description:	This avoids a function call, for every subchannel,
+ *		for every audio sample.
+ *
+ *--------------------------------------------------------------------*/
+
+__attribute__((hot))
+void demod_afsk_process_block (int chan, int subchan, const int16_t *samples, int n, struct demodulator_state_s *D)
+{
+	int i;
+
+	if (D->use_fixed) {
+	  for (i = 0; i < n; i++) {
+	    D->block_pos = i;
+	    rec_level_update_q (samples[i], D);
+	    process_sample_q (chan, subchan, samples[i], D);
+	  }
+	  return;
+	}
+
+	for (i = 0; i < n; i++) {
+	  D->block_pos = i;
+	  rec_level_update (samples[i] / 16384.0f, D);
+	  process_sample (chan, subchan, samples[i], D);
+	}
+}
+
+
+/*-------------------------------------------------------------------
+ *
+ * Name:        demod_afsk_same_front_end
+ *
+ * Purpose:     Determine whether two demodulators would compute
+ *		the same mark and space amplitudes from the same audio.
+ *
+ * Inputs:	a, b	- Demodulators, already initialized by demod_afsk_init.
+ *
+ * Returns:	1 if the prefilter and mark/space filters are identical.
+ *
+ * Description:	For example, profiles A and B use the same mark/space
+ *		filters but differ in what happens after that.
+ *		Compare the filters themselves rather than all of the
+ *		parameters used to generate them.
+ *
+ *--------------------------------------------------------------------*/
+
+int demod_afsk_same_front_end (struct demodulator_state_s *a, struct demodulator_state_s *b)
+{
+	if ((a->profile == 'F') != (b->profile == 'F') || a->ms_calc != b->ms_calc) {
+	  return (0);
+	}
+
+	if (a->use_sdft != b->use_sdft) {
+	  return (0);
+	}
+
+	if (a->use_prefilter != b->use_prefilter) {
+	  return (0);
+	}
+
+	if (a->use_prefilter) {
+	  if (a->pre_filter_size != b->pre_filter_size ||
+		memcmp (a->pre_filter, b->pre_filter, a->pre_filter_size * sizeof(float)) != 0) {
+	    return (0);
+	  }
+	}
+
+	if (a->ms_filter_size != b->ms_filter_size ||
+		memcmp (a->m_sin_table, b->m_sin_table, a->ms_filter_size * sizeof(float)) != 0 ||
+		memcmp (a->m_cos_table, b->m_cos_table, a->ms_filter_size * sizeof(float)) != 0 ||
+		memcmp (a->s_sin_table, b->s_sin_table, a->ms_filter_size * sizeof(float)) != 0 ||
+		memcmp (a->s_cos_table, b->s_cos_table, a->ms_filter_size * sizeof(float)) != 0) {
+	  return (0);
+	}
+
+	return (1);
+}
+
+
+/*
+ * Version 1.5:  How sure are we about the data bit being sampled?
+ * 0 for a coin toss up to 255 for certain.  This is the difference
+ * between the mark and space amplitudes, relative to their sum.
+ * With one slicer, they have been normalized by the AGC so the
+ * difference is already about -1 to +1.  Only the order of the 
+ * bits in one frame matters.  See hdlc_rec2.c.
+ */
+
+static int bit_confidence (int slice, int demod_data, struct demodulator_state_s *D)
+{
+	int conf;
+
+	if (D->use_fixed) {
+	  int64_t diff, sum;
+
+	  if (D->num_slicers <= 1) {
+	    diff = D->soft_m_q;
+	    sum = D->soft_s_q;
+	  }
+	  else {
+	    diff = D->soft_m_q * 4096 - D->soft_s_q * space_gain_q12[slice];
+	    sum = D->soft_m_q * 4096 + D->soft_s_q * space_gain_q12[slice];
+	  }
+	  if ((diff > 0) != demod_data || sum <= 0) {
+	    return (0);
+	  }
+	  if (diff < 0) diff = - diff;
+	  while (sum > (1LL << 40)) {
+	    diff >>= 8;
+	    sum >>= 8;
+	  }
+	  conf = (int)((diff * 255) / (sum + 1));
+	}
+	else {
+	  float diff, sum;
+
+	  if (D->num_slicers <= 1) {
+	    diff = D->soft_m - D->soft_s;
+	    sum = 1.0f;
+	  }
+	  else {
+	    diff = D->soft_m - D->soft_s * space_gain[slice];
+	    sum = D->soft_m + D->soft_s * space_gain[slice];
+	  }
+	  if ((diff > 0) != demod_data || sum <= 0) {
+	    return (0);
+	  }
+	  conf = (int)(fabsf(diff) * 255.0f / sum);
+	}
+	return (conf > 255 ? 255 : conf);
+}
 
 
 __attribute__((hot))
@@ -1133,12 +1816,17 @@ inline static void nudge_pll (int chan, int subchan, int slice, int demod_data,
 
 	  /* Overflow. */
 
-	  hdlc_rec_bit (chan, subchan, slice, demod_data, 0, -1);
+	  hdlc_rec_bit (chan, subchan, slice, demod_data, 0, bit_confidence (slice, demod_data, D));
 	}
 
         if (demod_data != D->slicer[slice].prev_demod_data) {
 
-	  if (hdlc_rec_gathering (chan, subchan, slice)) {
+	  if (D->use_fixed) {
+	    int inertia = hdlc_rec_gathering (chan, subchan, slice) ? D->qp.pll_locked_inertia : D->qp.pll_searching_inertia;
+
+	    D->slicer[slice].data_clock_pll = (int)(((int64_t)D->slicer[slice].data_clock_pll * inertia) / 65536);
+	  }
+	  else if (hdlc_rec_gathering (chan, subchan, slice)) {
 	    D->slicer[slice].data_clock_pll = (int)(D->slicer[slice].data_clock_pll * D->pll_locked_inertia);
 	  }
 	  else {
@@ -116,31 +116,6 @@
 #include "dsp.h"
 
 
-/* Add sample to buffer and shift the rest down. */
-
-__attribute__((hot)) __attribute__((always_inline))
-static inline void push_sample (float val, float *buff, int size)
-{
-	memmove(buff+1,buff,(size-1)*sizeof(float));
-	buff[0] = val; 
-}
-
-
-/* FIR filter kernel. */
-
-__attribute__((hot)) __attribute__((always_inline))
-static inline float convolve (const float *__restrict__ data, const float *__restrict__ filter, int filter_size)
-{
-	float sum = 0.0;
-	int j;
-
-	for (j=0; j<filter_size; j++) {
-	    sum += filter[j] * data[j];
-	}
-
-	return (sum);
-}
-
 
 /* Might replace this with faster, lower precision version someday. */
 
@@ -579,16 +554,19 @@ void demod_psk_init (enum modem_t modem_type, int samples_per_sec, int bps, char
 
 
 
-inline static void nudge_pll (int chan, int subchan, int slice, int demod_bits, struct demodulator_state_s *D);
+inline static void nudge_pll (int chan, int subchan, int slice, int demod_bits, int conf, struct demodulator_state_s *D);
 
-__attribute__((hot))
-void demod_psk_process_sample (int chan, int subchan, int sam, struct demodulator_state_s *D)
+static int sector_confidence (int p, int width);
+
+__attribute__((hot)) __attribute__((always_inline))
+static inline void process_sample (int chan, int subchan, int sam, struct demodulator_state_s *D)
 {
 	float fsam;
 	float sam_x_cos, sam_x_sin;
 	float I, Q;
 	int demod_phase_shift;		// Phase shift relative to previous symbol.
 					// range 0-3, 1 unit for each 90 degrees.
+	int conf;			// Version 1.5:  How sure we are.  0 to 255.
 	int slice = 0;
 
 #if DEBUG4
@@ -611,8 +589,8 @@ void demod_psk_process_sample (int chan, int subchan, int sam, struct demodulato
  */
 
 	if (D->use_prefilter) {
-	  push_sample (fsam, D->raw_cb, D->pre_filter_size);
-	  fsam = convolve (D->raw_cb, D->pre_filter, D->pre_filter_size);
+	  push_sample (fsam, &(D->raw_cb), D->pre_filter_size);
+	  fsam = dsp_convolve (delay_line(&(D->raw_cb)), D->pre_filter, D->pre_filter_size);
 	}
 
 	if (D->psk_use_lo) {
@@ -628,16 +606,16 @@ void demod_psk_process_sample (int chan, int subchan, int sam, struct demodulato
 
 	  sam_x_sin = fsam * D->m_sin_table[(D->lo_phase >> 24) & 0xff];
 
-	  push_sample (sam_x_cos, D->m_amp_cb, D->lp_filter_size);
-	  I = convolve (D->m_amp_cb, D->lp_filter, D->lp_filter_size);
+	  push_sample (sam_x_cos, &(D->m_amp_cb), D->lp_filter_size);
+	  I = dsp_convolve (delay_line(&(D->m_amp_cb)), D->lp_filter, D->lp_filter_size);
 
-	  push_sample (sam_x_sin, D->s_amp_cb, D->lp_filter_size);
-	  Q = convolve (D->s_amp_cb, D->lp_filter, D->lp_filter_size);
+	  push_sample (sam_x_sin, &(D->s_amp_cb), D->lp_filter_size);
+	  Q = dsp_convolve (delay_line(&(D->s_amp_cb)), D->lp_filter, D->lp_filter_size);
 
 	  a = my_atan2f(I,Q);
-	  push_sample (a, D->ms_in_cb, D->ms_filter_size);
+	  push_sample (a, &(D->ms_in_cb), D->ms_filter_size);
 
-	  delta = a - D->ms_in_cb[D->boffs];
+	  delta = a - delay_line(&(D->ms_in_cb))[D->boffs];
 
 	  /* 256 units/cycle makes modulo processing easier. */
 	  /* Make sure it is positive before truncating to integer. */
@@ -646,11 +624,13 @@ void demod_psk_process_sample (int chan, int subchan, int sam, struct demodulato
 	  
 	  if (D->modem_type == MODEM_QPSK) {
 	    demod_phase_shift = ((id + 32) >> 6) & 0x3;
+	    conf = sector_confidence ((id + 32) & 0x3f, 64);
 	  }
 	  else {
 	    demod_phase_shift = ((id + 16) >> 5) & 0x7;
+	    conf = sector_confidence ((id + 16) & 0x1f, 32);
 	  }
-	  nudge_pll (chan, subchan, slice, demod_phase_shift, D);
+	  nudge_pll (chan, subchan, slice, demod_phase_shift, conf, D);
 
 	  D->lo_phase += D->lo_step;
 	}
@@ -658,16 +638,16 @@ void demod_psk_process_sample (int chan, int subchan, int sam, struct demodulato
 /*
  * Correlate with previous symbol.  We are looking for the phase shift.
  */
-	  push_sample (fsam, D->ms_in_cb, D->ms_filter_size);
+	  push_sample (fsam, &(D->ms_in_cb), D->ms_filter_size);
 
-	  sam_x_cos = fsam *  D->ms_in_cb[D->coffs];
-	  sam_x_sin = fsam *  D->ms_in_cb[D->soffs];
+	  sam_x_cos = fsam *  delay_line(&(D->ms_in_cb))[D->coffs];
+	  sam_x_sin = fsam *  delay_line(&(D->ms_in_cb))[D->soffs];
 
-	  push_sample (sam_x_cos, D->m_amp_cb, D->lp_filter_size);
-	  I = convolve (D->m_amp_cb, D->lp_filter, D->lp_filter_size);
+	  push_sample (sam_x_cos, &(D->m_amp_cb), D->lp_filter_size);
+	  I = dsp_convolve (delay_line(&(D->m_amp_cb)), D->lp_filter, D->lp_filter_size);
 
-	  push_sample (sam_x_sin, D->s_amp_cb, D->lp_filter_size);
-	  Q = convolve (D->s_amp_cb, D->lp_filter, D->lp_filter_size);
+	  push_sample (sam_x_sin, &(D->s_amp_cb), D->lp_filter_size);
+	  Q = dsp_convolve (delay_line(&(D->s_amp_cb)), D->lp_filter, D->lp_filter_size);
 
 	  if (D->modem_type == MODEM_QPSK) {
 
@@ -684,6 +664,11 @@ void demod_psk_process_sample (int chan, int subchan, int sam, struct demodulato
 	      else
 	        demod_phase_shift = 2;
 	    }
+
+	    /* Closer to an axis is less certain. */
+
+	    float aI = fabsf(I), aQ = fabsf(Q);
+	    conf = (aI > aQ) ? (int)(255.f * aQ / aI) : (aQ > 0) ? (int)(255.f * aI / aQ) : 0;
 #else
 	    a = my_atan2f(I,Q);
 	    int id = ((int)((a / (2.f * (float)M_PI) + 1.f) * 256.f)) & 0xff;
@@ -701,9 +686,10 @@ void demod_psk_process_sample (int chan, int subchan, int sam, struct demodulato
 	    // 32 (90 degrees) compensates for 1800 carrier vs. 1800 baud.
 	    // 16 is to set threshold between constellation points.
 	    demod_phase_shift = ((idelta - 32 - 16) >> 5) & 0x7;
+	    conf = sector_confidence ((idelta - 32 - 16) & 0x1f, 32);
 	  }
 
-	  nudge_pll (chan, subchan, slice, demod_phase_shift, D);
+	  nudge_pll (chan, subchan, slice, demod_phase_shift, conf, D);
 	}
 
 #if DEBUG4
@@ -729,8 +715,8 @@ void demod_psk_process_sample (int chan, int subchan, int sam, struct demodulato
 
 	    fprintf (demod_log_fp, "%.3f, %.3f, %.3f, %.3f, %.3f, %.3f, %.2f, %.2f, %.2f\n", 
 			fsam + 2,
-			- D->ms_in_cb[D->soffs] + 6,
-			- D->ms_in_cb[D->coffs] + 6,
+			- delay_line(&(D->ms_in_cb))[D->soffs] + 6,
+			- delay_line(&(D->ms_in_cb))[D->coffs] + 6,
 			sam_x_cos + 8,
 			sam_x_sin + 10, 
 			2 * I + 12,
@@ -750,7 +736,47 @@ void demod_psk_process_sample (int chan, int subchan, int sam, struct demodulato
 #endif
 
 
-} /* end demod_psk_process_sample */
+} /* end process_sample */
+
+
+__attribute__((hot))
+void demod_psk_process_sample (int chan, int subchan, int sam, struct demodulator_state_s *D)
+{
+	process_sample (chan, subchan, sam, D);
+}
+
+
+/*-------------------------------------------------------------------
+ *
+ * Name:        demod_psk_process_block
+ *
+ * Purpose:     Same as demod_psk_process_sample but for a whole
+ *		block of audio samples at once.
+ *
+ * Inputs:	chan	- Audio channel.  0 for left, 1 for right.
+ *		subchan - modem of the channel.
+ *		samples	- Audio samples in range of -32768 .. 32767.
+ *		n	- Number of samples.
+ *
+ * Outputs:	D->block_pos is the index of the sample being processed
+ *		so frames can be placed in time within the block.
+ *
+ * Description:	This avoids a function call, for every subchannel,
+ *		for every audio sample.
+ *
+ *--------------------------------------------------------------------*/
+
+__attribute__((hot))
+void demod_psk_process_block (int chan, int subchan, const int16_t *samples, int n, struct demodulator_state_s *D)
+{
+	int i;
+
+	for (i = 0; i < n; i++) {
+	  D->block_pos = i;
+	  rec_level_update (samples[i] / 16384.0f, D);
+	  process_sample (chan, subchan, samples[i], D);
+	}
+}
 
 static const int phase_to_gray_v26[4] = {0, 1, 3, 2};	
 static const int phase_to_gray_v27[8] = {1, 0, 2, 3, 7, 6, 4, 5};	
@@ -758,7 +784,7 @@ static const int phase_to_gray_v27[8] = {1, 0, 2, 3, 7, 6, 4, 5};
 
 
 __attribute__((hot))
-inline static void nudge_pll (int chan, int subchan, int slice, int demod_bits, struct demodulator_state_s *D)
+inline static void nudge_pll (int chan, int subchan, int slice, int demod_bits, int conf, struct demodulator_state_s *D)
 {
 
 /*
@@ -814,15 +840,15 @@ inline static void nudge_pll (int chan, int subchan, int slice, int demod_bits,
 
 	    //dw_printf ("phaseshift=%d, bits= %d %d \n", demod_bits, (gray >> 1) & 1, gray & 1);
 #endif
-	    hdlc_rec_bit (chan, subchan, slice, (gray >> 1) & 1, 0, -1);
-	    hdlc_rec_bit (chan, subchan, slice, gray & 1, 0, -1);
+	    hdlc_rec_bit (chan, subchan, slice, (gray >> 1) & 1, 0, conf);
+	    hdlc_rec_bit (chan, subchan, slice, gray & 1, 0, conf);
 	  }
 	  else {
 	    int gray = phase_to_gray_v27[ demod_bits ];
 
-	    hdlc_rec_bit (chan, subchan, slice, (gray >> 2) & 1, 0, -1);
-	    hdlc_rec_bit (chan, subchan, slice, (gray >> 1) & 1, 0, -1);
-	    hdlc_rec_bit (chan, subchan, slice, gray & 1, 0, -1);
+	    hdlc_rec_bit (chan, subchan, slice, (gray >> 2) & 1, 0, conf);
+	    hdlc_rec_bit (chan, subchan, slice, (gray >> 1) & 1, 0, conf);
+	    hdlc_rec_bit (chan, subchan, slice, gray & 1, 0, conf);
 	  }
 	}
 
@@ -853,5 +879,20 @@ inline static void nudge_pll (int chan, int subchan, int slice, int demod_bits,
 } /* end nudge_pll */
 
 
+/*
+ * Version 1.5:  How sure are we about the symbol?
+ * p is the phase, 0 to width-1, within the range for the symbol.
+ * Nearer the middle is better.  0 for a coin toss up to 255.
+ */
+
+static int sector_confidence (int p, int width)
+{
+	int half = width / 2;
+	int conf = ((half - abs(p - half)) * 256) / half;
+
+	return (conf > 255 ? 255 : conf);
+}
+
+
 
 /* end demod_psk.c */
@@ -118,6 +118,8 @@
 #include "mheard.h"
 #include "ax25_link.h"
 #include "dtime_now.h"
+#include "fsk_demod_state.h"
+#include "dsp.h"
 
 
 //static int idx_decoded = 0;
@@ -281,6 +283,12 @@ int main (int argc, char *argv[])
 	dw_printf ("\n");
 #endif
 
+/*
+ * Version 1.5:  The filter kernels are selected at run time.
+ * Show which ones we got so we know what to expect for performance.
+ */
+	dw_printf ("Using %s FIR filter kernels.\n", dsp_kernel_name());
+
 
 #if __WIN32__
 	SetConsoleCtrlHandler ((PHANDLER_ROUTINE)cleanup_win, TRUE);
@@ -853,6 +861,11 @@ int main (int argc, char *argv[])
  * Description:	Print decoded packet.
  *		Optionally send to another application.
  *
+ *		Version 1.5:  The packet is frozen first so the same one
+ *		can be shared by everything it is passed to here.
+ *		Any of them that want to keep it use ax25_ref.
+ *		Any that want to change it must make a copy.
+ *
  *--------------------------------------------------------------------*/
 
 // TODO:  Use only one printf per line so output doesn't get jumbled up with stuff from other threads.
@@ -872,6 +885,8 @@ void app_process_rec_packet (int chan, int subchan, int slice, packet_t pp, alev
 	assert (subchan >= -1 && subchan < MAX_SUBCHANS);
 	assert (slice >= 0 && slice < MAX_SLICERS);
 	assert (pp != NULL);	// 1.1J+
+
+	ax25_freeze (pp);
      
 	strlcpy (display_retries, "", sizeof(display_retries));
 	if (audio_config.achan[chan].fix_bits != RETRY_NONE || audio_config.achan[chan].passall) {
@@ -1084,18 +1099,19 @@ void app_process_rec_packet (int chan, int subchan, int slice, packet_t pp, alev
 
 	if (ax25_is_aprs(pp)) {
 
-	  decode_aprs_t A;
+	  decode_aprs_t *A;
 
 	  // we still want to decode it for logging and other processing.
 	  // Just be quiet about errors if "-qd" is set.
+	  // Version 1.5:  The result stays with the packet for the filters to use.
 
-	  decode_aprs (&A, pp, q_d_opt);
+	  A = decode_aprs_cached (pp, q_d_opt);
 
 	  if ( ! q_d_opt ) {
 
 	    // Print it all out in human readable format unless "-q d" option used.
 
-	    decode_aprs_print (&A);
+	    decode_aprs_print (A);
 	  }
 
 	  /*
@@ -1106,23 +1122,23 @@ void app_process_rec_packet (int chan, int subchan, int slice, packet_t pp, alev
 
 	  // Send to log file.
 
-	  log_write (chan, &A, pp, alevel, retries);
+	  log_write (chan, A, pp, alevel, retries);
 
 	  // temp experiment.
-	  //log_rr_bits (&A, pp);
+	  //log_rr_bits (A, pp);
 
 	  // Add to list of stations heard over the radio.
 
-	  mheard_save_rf (chan, &A, pp, alevel, retries);
+	  mheard_save_rf (chan, A, pp, alevel, retries);
 
 
 	  // Convert to NMEA waypoint sentence if we have a location.
 
- 	  if (A.g_lat != G_UNKNOWN && A.g_lon != G_UNKNOWN) {
-	    waypoint_send_sentence (strlen(A.g_name) > 0 ? A.g_name : A.g_src, 
-		A.g_lat, A.g_lon, A.g_symbol_table, A.g_symbol_code, 
-		DW_FEET_TO_METERS(A.g_altitude_ft), A.g_course, DW_MPH_TO_KNOTS(A.g_speed_mph), 
-		A.g_comment);
+ 	  if (A->g_lat != G_UNKNOWN && A->g_lon != G_UNKNOWN) {
+	    waypoint_send_sentence (strlen(A->g_name) > 0 ? A->g_name : A->g_src, 
+		A->g_lat, A->g_lon, A->g_symbol_table, A->g_symbol_code, 
+		DW_FEET_TO_METERS(A->g_altitude_ft), A->g_course, DW_MPH_TO_KNOTS(A->g_speed_mph), 
+		A->g_comment);
 	  }
 	}
 
@@ -1132,9 +1148,10 @@ void app_process_rec_packet (int chan, int subchan, int slice, packet_t pp, alev
 // We see the same sequence in tt_user.c.
 
 	int flen;
-	unsigned char fbuf[AX25_MAX_PACKET_LEN];
+	unsigned char *fbuf;
 
-	flen = ax25_pack(pp, fbuf);
+	flen = ax25_get_frame_len (pp);
+	fbuf = ax25_get_frame_data_ptr (pp);
 
 	server_send_rec_packet (chan, pp, fbuf, flen);				// AGW net protocol
 	kissnet_send_rec_packet (chan, KISS_CMD_DATA_FRAME, fbuf, flen, -1);	// KISS TCP
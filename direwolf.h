@@ -98,6 +98,15 @@
 
 #define MAX_SLICERS 9
 
+/*
+ * Version 1.5:  Threads for fixing frames with a bad FCS
+ * and the most bits to consider, in order of confidence.
+ */
+
+#define MAX_FIX_THREADS 16
+
+#define MAX_FIX_BUDGET 256
+
 
 #if __WIN32__
 #define SLEEP_SEC(n) Sleep((n)*1000)
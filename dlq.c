@@ -35,6 +35,9 @@
  *		In version 1.4, other types of events also go into this
  *		queue and we use it to drive the data link state machine.
  *
+ *		In version 1.5, the queue is a fixed size ring which
+ *		can be added to without a lock.  See below.
+ *
  *---------------------------------------------------------------*/
 
 #include "direwolf.h"
@@ -57,34 +60,89 @@
 #include "dtime_now.h"
 
 
-/* The queue is a linked list of these. */
+/*
+ * Version 1.5:  The queue is a ring of pointers to items.
+ *
+ * It used to be a linked list, protected by a mutex, with a new item
+ * allocated for every event.  Adding to the end walked the whole list.
+ * With several audio receive threads, and the KISS and AGW network
+ * threads, all adding events, this was our busiest lock.
+ *
+ * Now any number of threads can add, and the one receive processing
+ * thread can remove, without a lock.  Each slot of the ring has a
+ * sequence number telling whether it is ready to be filled or emptied,
+ * for which trip around the ring.  Adding or removing is one compare
+ * and swap of the position to claim the slot.  (This is Dmitry Vyukov's
+ * bounded queue.)  The items come from a preallocated pool which is
+ * kept in a second ring of the same kind.
+ *
+ * The receive processing thread is woken up only when it is waiting.
+ *
+ * Received frames are discarded if the ring is full.  Everything else,
+ * such as requests from client applications and notifications from the
+ * transmit process, must never be lost or the connected mode data link
+ * state machine could get stuck.  Those go into an overflow list, 
+ * protected by a mutex, when the ring is full.  After that, they keep
+ * going there until it is empty so they stay in order.
+ */
 
-static struct dlq_item_s *queue_head = NULL;	/* Head of linked list for queue. */
+#define DLQ_RING_SIZE 1024		/* Most events waiting.  Must be power of 2. */
 
-#if __WIN32__
+#define DLQ_POOL_SIZE 256		/* Preallocated items.  More are allocated */
+					/* if these are all in use.  Power of 2. */
+
+struct dlq_ring_s {
+
+	struct dlq_slot_s {
+	  unsigned int seq;		/* Position, when ready to be filled, or */
+	  struct dlq_item_s *item;	/* position + 1, when ready to be emptied. */
+	} *slot;
+
+	unsigned int mask;		/* Size - 1. */
+
+	unsigned int in __attribute__((aligned(64)));		/* Next position to fill. */
+
+	unsigned int out __attribute__((aligned(64)));		/* Next position to empty. */
+};
+
+static struct dlq_ring_s queue;		/* Events waiting to be processed. */
+
+static struct dlq_ring_s pool;		/* Preallocated items not in use. */
+
+static struct dlq_item_s *pool_items;	/* Storage for them. */
+
+static volatile int queue_peak = 0;	/* Most waiting since last dlq_get_stats. */
 
-// TODO1.2: use dw_mutex_t
+static volatile int queue_overflow = 0;	/* Received frames discarded because the queue was full. */
 
-static CRITICAL_SECTION dlq_cs;			/* Critical section for updating queues. */
+static struct dlq_item_s *overflow_head;	/* Events that must not be lost, */
+static struct dlq_item_s *overflow_tail;	/* when the ring was full. */
+
+static volatile int overflow_count = 0;		/* Number in overflow list. */
+
+static dw_mutex_t overflow_mutex;		/* Protects overflow list. */
+
+
+#if __WIN32__
 
 static HANDLE wake_up_event;			/* Notify received packet processing thread when queue not empty. */
 
 #else
 
-static pthread_mutex_t dlq_mutex;		/* Critical section for updating queues. */
-
 static pthread_cond_t wake_up_cond;		/* Notify received packet processing thread when queue not empty. */
 
 static pthread_mutex_t wake_up_mutex;		/* Required by cond_wait. */
 
-static volatile int recv_thread_is_waiting = 0;
-
 #endif
 
+static volatile int recv_thread_is_waiting = 0;
+
 static int was_init = 0;			/* was initialization performed? */
 
 static void append_to_queue (struct dlq_item_s *pnew);
 
+static struct dlq_item_s *dlq_item_new (void);
+
 static volatile int s_new_count = 0;		/* To detect memory leak for queue items. */
 static volatile int s_delete_count = 0;		// TODO:  need to test.
 
@@ -94,6 +152,116 @@ static volatile int s_cdata_delete_count = 0;		// TODO:  need to test.
 
 
 
+/*-------------------------------------------------------------------
+ *
+ * Name:        ring_init, ring_put, ring_take, ring_is_empty
+ *
+ * Purpose:     Version 1.5:  Lock free ring of item pointers.
+ *
+ * Description:	ring_put can be called by any number of threads at once,
+ *		and so can ring_take.  ring_put returns 0, without waiting,
+ *		if the ring is full.  ring_take returns NULL if it is empty.
+ *
+ *--------------------------------------------------------------------*/
+
+static void ring_init (struct dlq_ring_s *r, int size)
+{
+	int n;
+
+	assert ((size & (size - 1)) == 0);
+
+	r->slot = calloc (size, sizeof(struct dlq_slot_s));
+	if (r->slot == NULL) {
+	  text_color_set(DW_COLOR_ERROR);
+	  dw_printf ("FATAL: Out of memory for received frame queue.\n");
+	  exit (1);
+	}
+	for (n = 0; n < size; n++) {
+	  r->slot[n].seq = n;
+	}
+	r->mask = size - 1;
+	r->in = 0;
+	r->out = 0;
+}
+
+
+static int ring_put (struct dlq_ring_s *r, struct dlq_item_s *item)
+{
+	unsigned int pos = __atomic_load_n (&(r->in), __ATOMIC_RELAXED);
+
+	while (1) {
+	  struct dlq_slot_s *sp = &(r->slot[pos & r->mask]);
+	  int dif = (int)(__atomic_load_n (&(sp->seq), __ATOMIC_ACQUIRE) - pos);
+
+	  if (dif == 0) {
+	    /* Slot is empty.  Claim it unless someone else got there first. */
+	    /* If they did, pos is updated to the current position. */
+	    if (__atomic_compare_exchange_n (&(r->in), &pos, pos + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+	      sp->item = item;
+	      __atomic_store_n (&(sp->seq), pos + 1, __ATOMIC_RELEASE);
+	      return (1);
+	    }
+	  }
+	  else if (dif < 0) {
+	    return (0);		/* Not emptied since last trip around.  Full. */
+	  }
+	  else {
+	    pos = __atomic_load_n (&(r->in), __ATOMIC_RELAXED);
+	  }
+	}
+}
+
+
+static struct dlq_item_s *ring_take (struct dlq_ring_s *r)
+{
+	unsigned int pos = __atomic_load_n (&(r->out), __ATOMIC_RELAXED);
+
+	while (1) {
+	  struct dlq_slot_s *sp = &(r->slot[pos & r->mask]);
+	  int dif = (int)(__atomic_load_n (&(sp->seq), __ATOMIC_ACQUIRE) - (pos + 1));
+
+	  if (dif == 0) {
+	    if (__atomic_compare_exchange_n (&(r->out), &pos, pos + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+	      struct dlq_item_s *item = sp->item;
+	      __atomic_store_n (&(sp->seq), pos + r->mask + 1, __ATOMIC_RELEASE);
+	      return (item);
+	    }
+	  }
+	  else if (dif < 0) {
+	    return (NULL);	/* Not filled yet.  Empty. */
+	  }
+	  else {
+	    pos = __atomic_load_n (&(r->out), __ATOMIC_RELAXED);
+	  }
+	}
+}
+
+
+static int ring_is_empty (struct dlq_ring_s *r)
+{
+	unsigned int pos = __atomic_load_n (&(r->out), __ATOMIC_RELAXED);
+
+	return (__atomic_load_n (&(r->slot[pos & r->mask].seq), __ATOMIC_ACQUIRE) != pos + 1);
+}
+
+
+static int ring_depth (struct dlq_ring_s *r)
+{
+	return ((int)(__atomic_load_n (&(r->in), __ATOMIC_RELAXED) - __atomic_load_n (&(r->out), __ATOMIC_RELAXED)));
+}
+
+
+/*
+ * Nothing in the ring or the overflow list.
+ */
+
+static int queue_is_empty (void)
+{
+	return (ring_is_empty (&queue) && __atomic_load_n (&overflow_count, __ATOMIC_ACQUIRE) == 0);
+}
+
+
+
 /*-------------------------------------------------------------------
  *
  * Name:        dlq_init
@@ -117,7 +285,25 @@ void dlq_init (void)
 	dw_printf ("dlq_init ( )\n");
 #endif
 
-	queue_head = NULL;
+	int n;
+
+	ring_init (&queue, DLQ_RING_SIZE);
+	ring_init (&pool, DLQ_POOL_SIZE);
+
+	pool_items = calloc (DLQ_POOL_SIZE, sizeof(struct dlq_item_s));
+	if (pool_items == NULL) {
+	  text_color_set(DW_COLOR_ERROR);
+	  dw_printf ("FATAL: Out of memory for received frame queue.\n");
+	  exit (1);
+	}
+	for (n = 0; n < DLQ_POOL_SIZE; n++) {
+	  ring_put (&pool, &(pool_items[n]));
+	}
+
+	overflow_head = NULL;
+	overflow_tail = NULL;
+	overflow_count = 0;
+	dw_mutex_init (&overflow_mutex);
 
 
 #if DEBUG
@@ -126,11 +312,9 @@ void dlq_init (void)
 #endif
 
 #if __WIN32__
-	InitializeCriticalSection (&dlq_cs);
 #else
 	int err;
 	err = pthread_mutex_init (&wake_up_mutex, NULL);
-	err = pthread_mutex_init (&dlq_mutex, NULL);
 	if (err != 0) {
 	  text_color_set(DW_COLOR_ERROR);
 	  dw_printf ("dlq_init: pthread_mutex_init err=%d", err);
@@ -172,9 +356,9 @@ void dlq_init (void)
 	  perror ("");
 	  exit (1);
 	}
+#endif
 
 	recv_thread_is_waiting = 0;
-#endif
 
 	was_init = 1;
 
@@ -249,15 +433,13 @@ void dlq_rec_frame (int chan, int subchan, int slice, packet_t pp, alevel_t alev
 
 /* Allocate a new queue item. */
 
-	pnew = (struct dlq_item_s *) calloc (sizeof(struct dlq_item_s), 1);
-	s_new_count++;
+	pnew = dlq_item_new ();
 
 	if (s_new_count > s_delete_count + 50) {
 	  text_color_set(DW_COLOR_ERROR);
 	  dw_printf ("INTERNAL ERROR:  DLQ memory leak, new=%d, delete=%d\n", s_new_count, s_delete_count);
 	}
 
-	pnew->nextp = NULL;
 	pnew->type = DLQ_REC_FRAME;
 	pnew->chan = chan;
 	pnew->slice = slice;
@@ -278,6 +460,47 @@ void dlq_rec_frame (int chan, int subchan, int slice, packet_t pp, alevel_t alev
 
 
 
+/*-------------------------------------------------------------------
+ *
+ * Name:        dlq_item_new
+ *
+ * Purpose:     Version 1.5:  Get an empty queue item.
+ *
+ * Returns:	Pointer to item with all fields zero.
+ *
+ * Description:	Normally from the preallocated pool.  If those are all in
+ *		use, allocate another which will be freed by dlq_delete.
+ *
+ *--------------------------------------------------------------------*/
+
+static struct dlq_item_s *dlq_item_new (void)
+{
+	struct dlq_item_s *pnew;
+
+	if ( ! was_init) {
+	  dlq_init ();
+	}
+
+	pnew = ring_take (&pool);
+	if (pnew != NULL) {
+	  memset (pnew, 0, sizeof(struct dlq_item_s));
+	}
+	else {
+	  pnew = (struct dlq_item_s *) calloc (sizeof(struct dlq_item_s), 1);
+	  if (pnew == NULL) {
+	    text_color_set(DW_COLOR_ERROR);
+	    dw_printf ("FATAL: Out of memory for received frame queue.\n");
+	    exit (1);
+	  }
+	}
+
+	__atomic_add_fetch (&s_new_count, 1, __ATOMIC_RELAXED);
+
+	return (pnew);
+}
+
+
+
 /*-------------------------------------------------------------------
  *
  * Name:        append_to_queue
@@ -292,68 +515,64 @@ void dlq_rec_frame (int chan, int subchan, int slice, packet_t pp, alevel_t alev
  *
  * Outputs:	Information is appended to queue.
  *
- * Description:	Add item to end of linked list.
- *		Signal the receive processing thread if the queue was formerly empty.
+ * Description:	Add item to end of queue.
+ *		Signal the receive processing thread if it is waiting.
+ *
+ *		Version 1.5:  If the queue is full, a received frame is
+ *		discarded.  That means the receive processing thread has
+ *		been stuck for a long time.  See below.
+ *		Other events go into the overflow list and are never lost.
+ *		While anything is in the overflow list, received frames
+ *		are also discarded so they can't get ahead of those events.
  *
  *--------------------------------------------------------------------*/
 
 static void append_to_queue (struct dlq_item_s *pnew)
 {
-	struct dlq_item_s *plast;
-	int queue_length = 0;
+	int queue_length;
 
 	if ( ! was_init) {
 	  dlq_init ();
 	}
 
-	pnew->nextp = NULL;
+	if (pnew->type == DLQ_REC_FRAME) {
 
-#if DEBUG1
-	text_color_set(DW_COLOR_DEBUG);
-	dw_printf ("dlq append_to_queue: enter critical section\n");
-#endif
-#if __WIN32__
-	EnterCriticalSection (&dlq_cs);
-#else
-	int err;
-	err = pthread_mutex_lock (&dlq_mutex);
-	if (err != 0) {
-	  text_color_set(DW_COLOR_ERROR);
-	  dw_printf ("dlq append_to_queue: pthread_mutex_lock err=%d", err);
-	  perror ("");
-	  exit (1);
-	}
-#endif
+	  if (__atomic_load_n (&overflow_count, __ATOMIC_ACQUIRE) > 0 || ! ring_put (&queue, pnew)) {
+	    int n = __atomic_add_fetch (&queue_overflow, 1, __ATOMIC_RELAXED);
 
-	if (queue_head == NULL) {
-	  queue_head = pnew;
-	  queue_length = 1;
+	    if (n == 1 || n % 100 == 0) {
+	      text_color_set(DW_COLOR_ERROR);
+	      dw_printf ("Received frame queue is full.  %d frames discarded so far.\n", n);
+	    }
+	    dlq_delete (pnew);
+	    return;
+	  }
 	}
 	else {
-	  queue_length = 2;	/* head + new one */
-	  plast = queue_head;
-	  while (plast->nextp != NULL) {
-	    plast = plast->nextp;
-	    queue_length++;
+	  dw_mutex_lock (&overflow_mutex);
+
+	  if (overflow_head != NULL || ! ring_put (&queue, pnew)) {
+	    pnew->nextp = NULL;
+	    if (overflow_head == NULL) {
+	      overflow_head = pnew;
+	    }
+	    else {
+	      overflow_tail->nextp = pnew;
+	    }
+	    overflow_tail = pnew;
+	    __atomic_add_fetch (&overflow_count, 1, __ATOMIC_RELEASE);
 	  }
-	  plast->nextp = pnew;
-	}
 
+	  dw_mutex_unlock (&overflow_mutex);
+	}
 
-#if __WIN32__ 
-	LeaveCriticalSection (&dlq_cs);
-#else
-	err = pthread_mutex_unlock (&dlq_mutex);
-	if (err != 0) {
-	  text_color_set(DW_COLOR_ERROR);
-	  dw_printf ("dlq append_to_queue: pthread_mutex_unlock err=%d", err);
-	  perror ("");
-	  exit (1);
+	queue_length = ring_depth (&queue) + __atomic_load_n (&overflow_count, __ATOMIC_RELAXED);
+	if (queue_length > queue_peak) {
+	  queue_peak = queue_length;	/* Not exact with other threads but close enough. */
 	}
-#endif
+
 #if DEBUG1
 	text_color_set(DW_COLOR_DEBUG);
-	dw_printf ("dlq append_to_queue: left critical section\n");
 	dw_printf ("dlq append_to_queue (): about to wake up recv processing thread.\n");
 #endif
 
@@ -411,10 +630,19 @@ static void append_to_queue (struct dlq_item_s *pnew)
 
 
 
+/*
+ * Version 1.5:  Wake up the receive processing thread only if it is waiting.
+ * The fence pairs with the one in dlq_wait_while_empty.  Either it sees our
+ * new item or we see that it is waiting.
+ */
+
+	__atomic_thread_fence (__ATOMIC_SEQ_CST);
+
+	if (__atomic_load_n (&recv_thread_is_waiting, __ATOMIC_RELAXED)) {
 #if __WIN32__
-	SetEvent (wake_up_event);
+	  SetEvent (wake_up_event);
 #else
-	if (recv_thread_is_waiting) {
+	  int err;
 
 	  err = pthread_mutex_lock (&wake_up_mutex);
 	  if (err != 0) {
@@ -439,8 +667,8 @@ static void append_to_queue (struct dlq_item_s *pnew)
 	    perror ("");
 	    exit (1);
 	  }
-	}
 #endif
+	}
 
 } /* end append_to_queue */
 
@@ -487,8 +715,7 @@ void dlq_connect_request (char addrs[AX25_MAX_ADDRS][AX25_MAX_ADDR_LEN], int num
 
 /* Allocate a new queue item. */
 
-	pnew = (struct dlq_item_s *) calloc (sizeof(struct dlq_item_s), 1);
-	s_new_count++;
+	pnew = dlq_item_new ();
 
 	pnew->type = DLQ_CONNECT_REQUEST;
 	pnew->chan = chan;
@@ -540,8 +767,7 @@ void dlq_disconnect_request (char addrs[AX25_MAX_ADDRS][AX25_MAX_ADDR_LEN], int
 
 /* Allocate a new queue item. */
 
-	pnew = (struct dlq_item_s *) calloc (sizeof(struct dlq_item_s), 1);
-	s_new_count++;
+	pnew = dlq_item_new ();
 
 	pnew->type = DLQ_DISCONNECT_REQUEST;
 	pnew->chan = chan;
@@ -603,8 +829,7 @@ void dlq_xmit_data_request (char addrs[AX25_MAX_ADDRS][AX25_MAX_ADDR_LEN], int n
 
 /* Allocate a new queue item. */
 
-	pnew = (struct dlq_item_s *) calloc (sizeof(struct dlq_item_s), 1);
-	s_new_count++;
+	pnew = dlq_item_new ();
 
 	pnew->type = DLQ_XMIT_DATA_REQUEST;
 	pnew->chan = chan;
@@ -666,8 +891,7 @@ void dlq_register_callsign (char addr[AX25_MAX_ADDR_LEN], int chan, int client)
 
 /* Allocate a new queue item. */
 
-	pnew = (struct dlq_item_s *) calloc (sizeof(struct dlq_item_s), 1);
-	s_new_count++;
+	pnew = dlq_item_new ();
 
 	pnew->type = DLQ_REGISTER_CALLSIGN;
 	pnew->chan = chan;
@@ -696,8 +920,7 @@ void dlq_unregister_callsign (char addr[AX25_MAX_ADDR_LEN], int chan, int client
 
 /* Allocate a new queue item. */
 
-	pnew = (struct dlq_item_s *) calloc (sizeof(struct dlq_item_s), 1);
-	s_new_count++;
+	pnew = dlq_item_new ();
 
 	pnew->type = DLQ_UNREGISTER_CALLSIGN;
 	pnew->chan = chan;
@@ -750,8 +973,7 @@ void dlq_channel_busy (int chan, int activity, int status)
 
 /* Allocate a new queue item. */
 
-	  pnew = (struct dlq_item_s *) calloc (sizeof(struct dlq_item_s), 1);
-	  s_new_count++;
+	  pnew = dlq_item_new ();
 
 	  pnew->type = DLQ_CHANNEL_BUSY;
 	  pnew->chan = chan;
@@ -798,8 +1020,7 @@ void dlq_seize_confirm (int chan)
 
 /* Allocate a new queue item. */
 
-	pnew = (struct dlq_item_s *) calloc (sizeof(struct dlq_item_s), 1);
-	s_new_count++;
+	pnew = dlq_item_new ();
 
 	pnew->type = DLQ_SEIZE_CONFIRM;
 	pnew->chan = chan;
@@ -843,8 +1064,7 @@ void dlq_client_cleanup (int client)
 
 /* Allocate a new queue item. */
 
-	pnew = (struct dlq_item_s *) calloc (sizeof(struct dlq_item_s), 1);
-	s_new_count++;
+	pnew = dlq_item_new ();
 
 	// All we care about is the client number.
 
@@ -891,17 +1111,28 @@ int dlq_wait_while_empty (double timeout)
 	}
 
 
-	if (queue_head == NULL) {
+	if (queue_is_empty ()) {
 
 #if DEBUG
 	  text_color_set(DW_COLOR_DEBUG);
 	  dw_printf ("dlq_wait_while_empty (): prepare to SLEEP...\n");
 #endif
 
+/*
+ * Version 1.5:  Producers signal only if we are waiting.  Let them know
+ * and then look again in case something was added in the meantime.
+ * See append_to_queue.
+ */
 
 #if __WIN32__
 
-	  if (timeout != 0.0) {
+	  __atomic_store_n (&recv_thread_is_waiting, 1, __ATOMIC_SEQ_CST);
+	  __atomic_thread_fence (__ATOMIC_SEQ_CST);
+
+	  if ( ! queue_is_empty ()) {
+	    ;
+	  }
+	  else if (timeout != 0.0) {
 
 	    DWORD ms = (timeout - dtime_now()) * 1000;
 	    if (ms <= 0) ms = 1;
@@ -917,6 +1148,8 @@ int dlq_wait_while_empty (double timeout)
 	    WaitForSingleObject (wake_up_event, INFINITE);
 	  }
 
+	  __atomic_store_n (&recv_thread_is_waiting, 0, __ATOMIC_RELAXED);
+
 #else
 	  int err;
 
@@ -928,8 +1161,13 @@ int dlq_wait_while_empty (double timeout)
 	    exit (1);
 	  }
 
-	  recv_thread_is_waiting = 1;
-	  if (timeout != 0.0) {
+	  __atomic_store_n (&recv_thread_is_waiting, 1, __ATOMIC_SEQ_CST);
+	  __atomic_thread_fence (__ATOMIC_SEQ_CST);
+
+	  if ( ! queue_is_empty ()) {
+	    ;
+	  }
+	  else if (timeout != 0.0) {
 	    struct timespec abstime;
 
 	    abstime.tv_sec = (time_t)(long)timeout;
@@ -943,7 +1181,7 @@ int dlq_wait_while_empty (double timeout)
 	  else {
 	    err = pthread_cond_wait (&wake_up_cond, &wake_up_mutex);
 	  }
-	  recv_thread_is_waiting = 0;
+	  __atomic_store_n (&recv_thread_is_waiting, 0, __ATOMIC_RELAXED);
 
 	  err = pthread_mutex_unlock (&wake_up_mutex);
 	  if (err != 0) {
@@ -984,47 +1222,30 @@ struct dlq_item_s *dlq_remove (void)
 {
 
 	struct dlq_item_s *result = NULL;
-	//int err;
-
-#if DEBUG1
-	text_color_set(DW_COLOR_DEBUG);
-	dw_printf ("dlq_remove() enter critical section\n");
-#endif
 
 	if ( ! was_init) {
 	  dlq_init ();
 	}
 
-#if __WIN32__
-	EnterCriticalSection (&dlq_cs);
-#else
-	int err;
+/* Version 1.5:  No lock needed.  See ring_take. */
+/* Nothing goes into the ring while the overflow list has anything, */
+/* so everything in the ring is older.  Take from the list only after the ring is empty. */
 
-	err = pthread_mutex_lock (&dlq_mutex);
-	if (err != 0) {
-	  text_color_set(DW_COLOR_ERROR);
-	  dw_printf ("dlq_remove: pthread_mutex_lock err=%d", err);
-	  perror ("");
-	  exit (1);
-	}
-#endif
+	result = ring_take (&queue);
 
-	if (queue_head != NULL) {
-	  result = queue_head;
-	  queue_head = queue_head->nextp;
-	}
-	 
-#if __WIN32__
-	LeaveCriticalSection (&dlq_cs);
-#else
-	err = pthread_mutex_unlock (&dlq_mutex);
-	if (err != 0) {
-	  text_color_set(DW_COLOR_ERROR);
-	  dw_printf ("dlq_remove: pthread_mutex_unlock err=%d", err);
-	  perror ("");
-	  exit (1);
+	if (result == NULL && __atomic_load_n (&overflow_count, __ATOMIC_ACQUIRE) > 0) {
+
+	  dw_mutex_lock (&overflow_mutex);
+
+	  result = overflow_head;
+	  if (result != NULL) {
+	    overflow_head = result->nextp;
+	    result->nextp = NULL;
+	    __atomic_sub_fetch (&overflow_count, 1, __ATOMIC_RELEASE);
+	  }
+
+	  dw_mutex_unlock (&overflow_mutex);
 	}
-#endif
 
 #if DEBUG
 	text_color_set(DW_COLOR_DEBUG);
@@ -1068,7 +1289,7 @@ void dlq_delete (struct dlq_item_s *pitem)
 	  return;
 	}
 
-	s_delete_count++;
+	__atomic_add_fetch (&s_delete_count, 1, __ATOMIC_RELAXED);
 
 	if (pitem->pp != NULL) {
 	  ax25_delete (pitem->pp);
@@ -1080,12 +1301,49 @@ void dlq_delete (struct dlq_item_s *pitem)
 	  pitem->txdata = NULL;
 	}
 
-	free (pitem);
+	/* Version 1.5:  Back to the pool unless it was allocated separately. */
+
+	if (pitem >= pool_items && pitem < pool_items + DLQ_POOL_SIZE) {
+	  ring_put (&pool, pitem);
+	}
+	else {
+	  free (pitem);
+	}
 
 } /* end dlq_delete */
 
 
 
+/*-------------------------------------------------------------------
+ *
+ * Name:        dlq_get_stats
+ *
+ * Purpose:     Version 1.5:  Find out how the queue is doing.
+ *
+ * Outputs:	depth		- Number of events waiting now.
+ *
+ *		peak		- Most waiting since the previous call.
+ *
+ *		overflow	- Total number of received frames discarded because
+ *				  the queue was full.
+ *
+ *--------------------------------------------------------------------*/
+
+void dlq_get_stats (int *depth, int *peak, int *overflow)
+{
+	if ( ! was_init) {
+	  dlq_init ();
+	}
+
+	*depth = ring_depth (&queue) + __atomic_load_n (&overflow_count, __ATOMIC_RELAXED);
+	*peak = queue_peak;
+	*overflow = __atomic_load_n (&queue_overflow, __ATOMIC_RELAXED);
+
+	queue_peak = *depth;
+}
+
+
+
 
 /*-------------------------------------------------------------------
  *
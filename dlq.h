@@ -41,11 +41,11 @@ typedef enum dlq_type_e {DLQ_REC_FRAME, DLQ_CONNECT_REQUEST, DLQ_DISCONNECT_REQU
 /* A queue item. */
 
 // TODO: call this event rather than item.
-// TODO: should add fences.
 
 typedef struct dlq_item_s {
 
-	struct dlq_item_s *nextp;	/* Next item in queue. */
+	struct dlq_item_s *nextp;	/* Version 1.5:  Only for events waiting */
+					/* in the overflow list.  See dlq.c. */
 
 	dlq_type_t type;		/* Type of item. */
 					/* See enum definition above. */
@@ -128,6 +128,8 @@ struct dlq_item_s *dlq_remove (void);
 
 void dlq_delete (struct dlq_item_s *pitem);
 
+void dlq_get_stats (int *depth, int *peak, int *overflow);
+
 
 
 cdata_t *cdata_new (int pid, char *data, int len);
@@ -24,6 +24,11 @@
  *
  * Purpose:     Generate the filters used by the demodulators.
  *
+ *		Version 1.5: Also the FIR filter kernels, with versions
+ *		for different instruction sets selected at run time,
+ *		and fixed point versions for processors without
+ *		floating point hardware.
+ *
  *----------------------------------------------------------------*/
 
 #include "direwolf.h"
@@ -36,6 +41,10 @@
 #include <ctype.h>
 #include <assert.h>
 
+#if defined(__arm__) && defined(__linux__)
+#include <sys/auxv.h>
+#endif
+
 #include "audio.h"
 #include "fsk_demod_state.h"
 #include "fsk_gen_filter.h"
@@ -251,4 +260,487 @@ void gen_bandpass (float f1, float f2, float *bp_filter, int filter_size, bp_win
 	}
 }
 
+
+
+/*------------------------------------------------------------------
+ *
+ * Name:        dsp_kernel_init
+ *
+ * Purpose:     Select the FIR filter kernels best suited to the
+ *		processor we are actually running on.
+ *
+ * Description:	Makefile.linux picks the instruction set at build
+ *		time by looking at the build machine.  That is fine
+ *		when building for your own use but binary distributions
+ *		must be built for the lowest common denominator.
+ *
+ *		Here we have several versions of the filter kernels,
+ *		each compiled for a specific instruction set, regardless
+ *		of the compiler options.  The best one supported by the
+ *		processor (CPUID on x86, HWCAP on ARM) is picked at
+ *		start up time and used thru the function pointers:
+ *
+ *			dsp_convolve	- One FIR filter.
+ *			dsp_convolve4	- Four filters on the same data,
+ *					  i.e. the mark/space correlators.
+ *
+ *		The generic versions are the original simple loops
+ *		and are always available.  Wider versions can add
+ *		things up in a different order so the last few bits
+ *		of the results might not be exactly the same.
+ *
+ *----------------------------------------------------------------*/
+
+
+/* Generic version, for any processor, compiled with the usual options. */
+
+static float convolve_generic (const float *__restrict__ data, const float *__restrict__ filter, int filter_size)
+{
+	float sum = 0.0f;
+	int j;
+
+	for (j=0; j<filter_size; j++) {
+	    sum += filter[j] * data[j];
+	}
+	return (sum);
+}
+
+static void convolve4_generic (const float *__restrict__ data, const float *__restrict__ f0, const float *__restrict__ f1,
+				const float *__restrict__ f2, const float *__restrict__ f3, int filter_size, float sum[4])
+{
+	sum[0] = convolve_generic (data, f0, filter_size);
+	sum[1] = convolve_generic (data, f1, filter_size);
+	sum[2] = convolve_generic (data, f2, filter_size);
+	sum[3] = convolve_generic (data, f3, filter_size);
+}
+
+
+float (*dsp_convolve) (const float *data, const float *filter, int filter_size) = convolve_generic;
+
+void (*dsp_convolve4) (const float *data, const float *f0, const float *f1,
+			const float *f2, const float *f3, int filter_size, float sum[4]) = convolve4_generic;
+
+static const char *kernel_name = "generic";
+
+
+/*
+ * The wider versions use the gcc vector extensions (also understood by clang)
+ * rather than intrinsics so the same code works for each instruction set.
+ * The target attribute makes the compiler generate the specific instructions
+ * for just that function.  memcpy is the portable way to do an unaligned load.
+ *
+ * Filter sizes are not necessarily a multiple of the vector size so
+ * the last few are done the old fashioned way.
+ */
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && (__GNUC__ >= 5 || defined(__clang__))
+#define DSP_X86 1
+#endif
+
+#if defined(__GNUC__) && defined(__aarch64__)
+#define DSP_NEON 1
+#define NEON_TARGET		/* Always available on 64 bit ARM. */
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 6 && defined(__arm__) && defined(__linux__) && !defined(__SOFTFP__)
+#define DSP_NEON 1
+#define NEON_TARGET __attribute__((target("fpu=neon")))
+#ifndef HWCAP_NEON
+#define HWCAP_NEON (1 << 12)
+#endif
+#endif
+
+
+#if DSP_X86
+
+typedef float v8sf __attribute__((vector_size(32)));
+typedef float v16sf __attribute__((vector_size(64)));
+
+__attribute__((target("avx2,fma")))
+static float convolve_avx2 (const float *__restrict__ data, const float *__restrict__ filter, int filter_size)
+{
+	v8sf acc0 = { 0 }, acc1 = { 0 };
+	v8sf d, f;
+	float sum = 0.0f;
+	int j, k;
+
+	for (j = 0; j + 16 <= filter_size; j += 16) {
+	  memcpy (&d, data + j, sizeof(d));
+	  memcpy (&f, filter + j, sizeof(f));
+	  acc0 += d * f;
+	  memcpy (&d, data + j + 8, sizeof(d));
+	  memcpy (&f, filter + j + 8, sizeof(f));
+	  acc1 += d * f;
+	}
+	if (j + 8 <= filter_size) {
+	  memcpy (&d, data + j, sizeof(d));
+	  memcpy (&f, filter + j, sizeof(f));
+	  acc0 += d * f;
+	  j += 8;
+	}
+	acc0 += acc1;
+	for (k = 0; k < 8; k++) {
+	  sum += acc0[k];
+	}
+	for ( ; j < filter_size; j++) {
+	  sum += filter[j] * data[j];
+	}
+	return (sum);
+}
+
+__attribute__((target("avx2,fma")))
+static void convolve4_avx2 (const float *__restrict__ data, const float *__restrict__ f0, const float *__restrict__ f1,
+				const float *__restrict__ f2, const float *__restrict__ f3, int filter_size, float sum[4])
+{
+	v8sf acc0 = { 0 }, acc1 = { 0 }, acc2 = { 0 }, acc3 = { 0 };
+	v8sf d, f;
+	int j, k;
+
+	for (j = 0; j + 8 <= filter_size; j += 8) {
+	  memcpy (&d, data + j, sizeof(d));
+	  memcpy (&f, f0 + j, sizeof(f));
+	  acc0 += d * f;
+	  memcpy (&f, f1 + j, sizeof(f));
+	  acc1 += d * f;
+	  memcpy (&f, f2 + j, sizeof(f));
+	  acc2 += d * f;
+	  memcpy (&f, f3 + j, sizeof(f));
+	  acc3 += d * f;
+	}
+	sum[0] = sum[1] = sum[2] = sum[3] = 0.0f;
+	for (k = 0; k < 8; k++) {
+	  sum[0] += acc0[k];
+	  sum[1] += acc1[k];
+	  sum[2] += acc2[k];
+	  sum[3] += acc3[k];
+	}
+	for ( ; j < filter_size; j++) {
+	  sum[0] += f0[j] * data[j];
+	  sum[1] += f1[j] * data[j];
+	  sum[2] += f2[j] * data[j];
+	  sum[3] += f3[j] * data[j];
+	}
+}
+
+__attribute__((target("avx512f")))
+static float convolve_avx512 (const float *__restrict__ data, const float *__restrict__ filter, int filter_size)
+{
+	v16sf acc = { 0 };
+	v16sf d, f;
+	float sum = 0.0f;
+	int j, k;
+
+	for (j = 0; j + 16 <= filter_size; j += 16) {
+	  memcpy (&d, data + j, sizeof(d));
+	  memcpy (&f, filter + j, sizeof(f));
+	  acc += d * f;
+	}
+	for (k = 0; k < 16; k++) {
+	  sum += acc[k];
+	}
+	for ( ; j < filter_size; j++) {
+	  sum += filter[j] * data[j];
+	}
+	return (sum);
+}
+
+__attribute__((target("avx512f")))
+static void convolve4_avx512 (const float *__restrict__ data, const float *__restrict__ f0, const float *__restrict__ f1,
+				const float *__restrict__ f2, const float *__restrict__ f3, int filter_size, float sum[4])
+{
+	v16sf acc0 = { 0 }, acc1 = { 0 }, acc2 = { 0 }, acc3 = { 0 };
+	v16sf d, f;
+	int j, k;
+
+	for (j = 0; j + 16 <= filter_size; j += 16) {
+	  memcpy (&d, data + j, sizeof(d));
+	  memcpy (&f, f0 + j, sizeof(f));
+	  acc0 += d * f;
+	  memcpy (&f, f1 + j, sizeof(f));
+	  acc1 += d * f;
+	  memcpy (&f, f2 + j, sizeof(f));
+	  acc2 += d * f;
+	  memcpy (&f, f3 + j, sizeof(f));
+	  acc3 += d * f;
+	}
+	sum[0] = sum[1] = sum[2] = sum[3] = 0.0f;
+	for (k = 0; k < 16; k++) {
+	  sum[0] += acc0[k];
+	  sum[1] += acc1[k];
+	  sum[2] += acc2[k];
+	  sum[3] += acc3[k];
+	}
+	for ( ; j < filter_size; j++) {
+	  sum[0] += f0[j] * data[j];
+	  sum[1] += f1[j] * data[j];
+	  sum[2] += f2[j] * data[j];
+	  sum[3] += f3[j] * data[j];
+	}
+}
+
+#endif	/* DSP_X86 */
+
+
+#if DSP_NEON
+
+typedef float v4sf __attribute__((vector_size(16)));
+
+NEON_TARGET
+static float convolve_neon (const float *__restrict__ data, const float *__restrict__ filter, int filter_size)
+{
+	v4sf acc0 = { 0 }, acc1 = { 0 };
+	v4sf d, f;
+	float sum = 0.0f;
+	int j, k;
+
+	for (j = 0; j + 8 <= filter_size; j += 8) {
+	  memcpy (&d, data + j, sizeof(d));
+	  memcpy (&f, filter + j, sizeof(f));
+	  acc0 += d * f;
+	  memcpy (&d, data + j + 4, sizeof(d));
+	  memcpy (&f, filter + j + 4, sizeof(f));
+	  acc1 += d * f;
+	}
+	acc0 += acc1;
+	for (k = 0; k < 4; k++) {
+	  sum += acc0[k];
+	}
+	for ( ; j < filter_size; j++) {
+	  sum += filter[j] * data[j];
+	}
+	return (sum);
+}
+
+NEON_TARGET
+static void convolve4_neon (const float *__restrict__ data, const float *__restrict__ f0, const float *__restrict__ f1,
+				const float *__restrict__ f2, const float *__restrict__ f3, int filter_size, float sum[4])
+{
+	v4sf acc0 = { 0 }, acc1 = { 0 }, acc2 = { 0 }, acc3 = { 0 };
+	v4sf d, f;
+	int j, k;
+
+	for (j = 0; j + 4 <= filter_size; j += 4) {
+	  memcpy (&d, data + j, sizeof(d));
+	  memcpy (&f, f0 + j, sizeof(f));
+	  acc0 += d * f;
+	  memcpy (&f, f1 + j, sizeof(f));
+	  acc1 += d * f;
+	  memcpy (&f, f2 + j, sizeof(f));
+	  acc2 += d * f;
+	  memcpy (&f, f3 + j, sizeof(f));
+	  acc3 += d * f;
+	}
+	sum[0] = sum[1] = sum[2] = sum[3] = 0.0f;
+	for (k = 0; k < 4; k++) {
+	  sum[0] += acc0[k];
+	  sum[1] += acc1[k];
+	  sum[2] += acc2[k];
+	  sum[3] += acc3[k];
+	}
+	for ( ; j < filter_size; j++) {
+	  sum[0] += f0[j] * data[j];
+	  sum[1] += f1[j] * data[j];
+	  sum[2] += f2[j] * data[j];
+	  sum[3] += f3[j] * data[j];
+	}
+}
+
+#endif	/* DSP_NEON */
+
+
+void dsp_kernel_init (void)
+{
+	static int done = 0;
+
+	if (done) return;
+	done = 1;
+
+#if DSP_X86
+	__builtin_cpu_init ();
+
+	if (__builtin_cpu_supports ("avx512f")) {
+	  dsp_convolve = convolve_avx512;
+	  dsp_convolve4 = convolve4_avx512;
+	  kernel_name = "AVX-512";
+	}
+	else if (__builtin_cpu_supports ("avx2") && __builtin_cpu_supports ("fma")) {
+	  dsp_convolve = convolve_avx2;
+	  dsp_convolve4 = convolve4_avx2;
+	  kernel_name = "AVX2";
+	}
+#elif DSP_NEON && defined(__aarch64__)
+	dsp_convolve = convolve_neon;
+	dsp_convolve4 = convolve4_neon;
+	kernel_name = "NEON";
+#elif DSP_NEON
+	if (getauxval (AT_HWCAP) & HWCAP_NEON) {
+	  dsp_convolve = convolve_neon;
+	  dsp_convolve4 = convolve4_neon;
+	  kernel_name = "NEON";
+	}
+#endif
+}
+
+
+/*------------------------------------------------------------------
+ *
+ * Name:        dsp_kernel_name
+ *
+ * Purpose:     Name of the FIR filter kernels selected by dsp_kernel_init
+ *		for display at start up time.
+ *
+ *----------------------------------------------------------------*/
+
+const char * dsp_kernel_name (void)
+{
+	dsp_kernel_init ();
+	return (kernel_name);
+}
+
+
+
+
+/*------------------------------------------------------------------
+ *
+ * Name:        dsp_q15_shift
+ *
+ * Purpose:     Version 1.5:  Pick scaling for converting filter
+ *		kernels to fixed point.
+ *
+ * Inputs:	filter	- Array of pointers to filter kernels.  They are
+ *			  used together so they must all have the same scale.
+ *		count	- Number of kernels.
+ *		filter_size - Number of taps in each.
+ *
+ * Returns:	Number of fraction bits, k, so that a kernel tap c becomes
+ *		the integer c * 2**k.
+ *
+ * Description:	If the sum of the absolute values of the taps, times 2**k,
+ *		is not over 32767, each tap fits in 16 bits and the sum of
+ *		products, with any 16 bit data, can't overflow 32 bits.
+ *		Use the largest k that meets this for the best precision.
+ *
+ *----------------------------------------------------------------*/
+
+int dsp_q15_shift (const float *filter[], int count, int filter_size)
+{
+	float most = 0;
+	int k, j;
+
+	for (k = 0; k < count; k++) {
+	  float total = 0;
+	  for (j = 0; j < filter_size; j++) {
+	    total += fabsf(filter[k][j]);
+	  }
+	  if (total > most) most = total;
+	}
+
+	for (k = 15; k > 0; k--) {
+	  if (most * (1 << k) <= 32767.0f) break;
+	}
+	return (k);
+}
+
+
+/*------------------------------------------------------------------
+ *
+ * Name:        dsp_to_q15
+ *
+ * Purpose:     Convert filter kernel to fixed point with given scaling.
+ *
+ * Inputs:	filter	- Floating point taps.
+ *		filter_size - Number of taps.
+ *		shift	- From dsp_q15_shift.
+ *
+ * Outputs:	q	- Integer taps.
+ *
+ *----------------------------------------------------------------*/
+
+void dsp_to_q15 (const float *filter, int filter_size, int shift, int16_t *q)
+{
+	int j;
+
+	for (j = 0; j < filter_size; j++) {
+	  q[j] = (int16_t) lrintf (filter[j] * (1 << shift));
+	}
+}
+
+
+/*------------------------------------------------------------------
+ *
+ * Name:        dsp_convolve_q15
+ *
+ * Purpose:     Fixed point version of dsp_convolve.
+ *
+ * Inputs:	data	- 16 bit samples from delay_line_q15.
+ *		filter	- Taps from dsp_to_q15.
+ *		filter_size - Number of taps.
+ *
+ * Returns:	Sum of products.  Shift right by the number of fraction
+ *		bits in the kernel to get the same scale as the data.
+ *
+ * Description:	The simple loop lets the compiler use whatever the
+ *		processor has, e.g. SMLABB on ARMv6 or SIMD instructions.
+ *		Overflow is not possible with taps from dsp_to_q15.
+ *
+ *----------------------------------------------------------------*/
+
+int32_t dsp_convolve_q15 (const int16_t *__restrict__ data, const int16_t *__restrict__ filter, int filter_size)
+{
+	int32_t sum = 0;
+	int j;
+
+	for (j = 0; j < filter_size; j++) {
+	  sum += (int32_t)filter[j] * data[j];
+	}
+	return (sum);
+}
+
+void dsp_convolve4_q15 (const int16_t *__restrict__ data, const int16_t *__restrict__ f0, const int16_t *__restrict__ f1,
+				const int16_t *__restrict__ f2, const int16_t *__restrict__ f3, int filter_size, int32_t sum[4])
+{
+	int32_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+	int j;
+
+	for (j = 0; j < filter_size; j++) {
+	  s0 += (int32_t)f0[j] * data[j];
+	  s1 += (int32_t)f1[j] * data[j];
+	  s2 += (int32_t)f2[j] * data[j];
+	  s3 += (int32_t)f3[j] * data[j];
+	}
+	sum[0] = s0;
+	sum[1] = s1;
+	sum[2] = s2;
+	sum[3] = s3;
+}
+
+
+/*------------------------------------------------------------------
+ *
+ * Name:        dsp_isqrt
+ *
+ * Purpose:     Integer square root, rounded down, without floating point.
+ *
+ *----------------------------------------------------------------*/
+
+uint32_t dsp_isqrt (uint32_t x)
+{
+	uint32_t root = 0;
+	uint32_t bit = 1u << 30;
+
+	while (bit > x) bit >>= 2;
+
+	while (bit != 0) {
+	  if (x >= root + bit) {
+	    x -= root + bit;
+	    root = (root >> 1) + bit;
+	  }
+	  else {
+	    root >>= 1;
+	  }
+	  bit >>= 2;
+	}
+	return (root);
+}
+
 /* end dsp.c */
\ No newline at end of file
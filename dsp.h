@@ -1,4 +1,3 @@
-
 /* dsp.h */
 
 // TODO:  put prefixes on these names.
@@ -7,4 +6,141 @@ float window (bp_window_t type, int size, int j);
 
 void gen_lowpass (float fc, float *lp_filter, int filter_size, bp_window_t wtype);
 
-void gen_bandpass (float f1, float f2, float *bp_filter, int filter_size, bp_window_t wtype);
\ No newline at end of file
+void gen_bandpass (float f1, float f2, float *bp_filter, int filter_size, bp_window_t wtype);
+
+
+/*
+ * FIR filter kernels.  
+ * dsp_kernel_init selects the best version for this processor.
+ * dsp_convolve4 applies four filters to the same data.
+ */
+
+void dsp_kernel_init (void);
+
+const char * dsp_kernel_name (void);
+
+extern float (*dsp_convolve) (const float *data, const float *filter, int filter_size);
+
+extern void (*dsp_convolve4) (const float *data, const float *f0, const float *f1,
+				const float *f2, const float *f3, int filter_size, float sum[4]);
+
+
+/*
+ * Version 1.5:  Fixed point kernels.  See FIXED_POINT in the
+ * configuration file and demod_afsk.c, demod_9600.c.
+ */
+
+int dsp_q15_shift (const float *filter[], int count, int filter_size);
+
+void dsp_to_q15 (const float *filter, int filter_size, int shift, int16_t *q);
+
+int32_t dsp_convolve_q15 (const int16_t *data, const int16_t *filter, int filter_size);
+
+void dsp_convolve4_q15 (const int16_t *data, const int16_t *f0, const int16_t *f1,
+				const int16_t *f2, const int16_t *f3, int filter_size, int32_t sum[4]);
+
+uint32_t dsp_isqrt (uint32_t x);
+
+
+/*
+ * Add sample to delay line.
+ * 'size' must be the same every time for a given delay line.
+ *
+ * The new sample is written in two places so the most recent 'size'
+ * samples are always contiguous.  Nothing needs to be shifted.
+ */
+
+__attribute__((hot)) __attribute__((always_inline))
+static inline void push_sample (float val, struct delay_line_s *dl, int size)
+{
+	dl->pos = (dl->pos > 0 ? dl->pos : size) - 1;
+	dl->buff[dl->pos] = val;
+	dl->buff[dl->pos + size] = val;
+}
+
+
+/*
+ * Most recent samples in delay line.
+ * [0] is the newest, [1] the one before that, and so on up to [size-1].
+ */
+
+__attribute__((hot)) __attribute__((always_inline))
+static inline const float * delay_line (const struct delay_line_s *dl)
+{
+	return (dl->buff + dl->pos);
+}
+
+
+/*
+ * Same for the fixed point delay lines.
+ */
+
+__attribute__((hot)) __attribute__((always_inline))
+static inline void push_sample_q15 (int val, struct delay_line_q15_s *dl, int size)
+{
+	if (val > 32767) val = 32767;
+	else if (val < -32768) val = -32768;
+
+	dl->pos = (dl->pos > 0 ? dl->pos : size) - 1;
+	dl->buff[dl->pos] = val;
+	dl->buff[dl->pos + size] = val;
+}
+
+__attribute__((hot)) __attribute__((always_inline))
+static inline const int16_t * delay_line_q15 (const struct delay_line_q15_s *dl)
+{
+	return (dl->buff + dl->pos);
+}
+
+
+/*
+ * Fixed point version of   x = in * k + x * (1 - k)   which is  x += (in - x) * k.
+ * x has AGC_FRAC fraction bits, in has none, k is Q31.
+ */
+
+#define AGC_FRAC 12
+
+__attribute__((hot)) __attribute__((always_inline))
+static inline void smooth_q (int in, int k, int *x)
+{
+	*x += (int) (((int64_t)(in * (1 << AGC_FRAC) - *x) * k) >> 31);
+}
+
+
+/*
+ * Version 1.2: Capture the received audio amplitude.
+ * This is same as the AGC without the normalization step.
+ * We want decay to be substantially slower to get a longer
+ * range idea of the received audio.
+ *
+ * Version 1.5: Moved here from demod.c so the demodulators can 
+ * do this as they go thru a block of samples.  That way, the
+ * level is up to date when a frame is received.
+ */
+
+__attribute__((hot)) __attribute__((always_inline))
+static inline void rec_level_update (float fsam, struct demodulator_state_s *D)
+{
+	if (fsam >= D->alevel_rec_peak) {
+	  D->alevel_rec_peak = fsam * D->quick_attack + D->alevel_rec_peak * (1.0f - D->quick_attack);
+	}
+	else {
+	  D->alevel_rec_peak = fsam * D->sluggish_decay + D->alevel_rec_peak * (1.0f - D->sluggish_decay);
+	}
+
+	if (fsam <= D->alevel_rec_valley) {
+	  D->alevel_rec_valley = fsam * D->quick_attack + D->alevel_rec_valley * (1.0f - D->quick_attack);
+	}
+	else  {   
+	  D->alevel_rec_valley = fsam * D->sluggish_decay + D->alevel_rec_valley * (1.0f - D->sluggish_decay);
+	}
+}
+
+__attribute__((hot)) __attribute__((always_inline))
+static inline void rec_level_update_q (int sam, struct demodulator_state_s *D)
+{
+	int x = sam * (1 << AGC_FRAC);
+
+	smooth_q (sam, x >= D->q.alevel_rec_peak ? D->qp.quick_attack : D->qp.sluggish_decay, &(D->q.alevel_rec_peak));
+	smooth_q (sam, x <= D->q.alevel_rec_valley ? D->qp.quick_attack : D->qp.sluggish_decay, &(D->q.alevel_rec_valley));
+}
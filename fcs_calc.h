@@ -6,6 +6,18 @@ unsigned short fcs_calc (unsigned char *data, int len);
 
 unsigned short crc16 (unsigned char *data, int len, unsigned short seed);
 
+/*
+ * Version 1.5:  FCS calculated along the way as a frame is received,
+ * with fcs_update.
+ * Start with FCS_INIT.  After the FCS itself is included, a good frame
+ * always ends up with FCS_GOOD.
+ */
+
+#define FCS_INIT 0xffff
+#define FCS_GOOD 0xf0b8
+
+unsigned short fcs_update (unsigned short fcs, const unsigned char *data, int len);
+
 /* end fcs_calc.h */
 
 
@@ -2,6 +2,8 @@
 
 #ifndef FSK_DEMOD_STATE_H
 
+#include <stdint.h>		// for int16_t
+
 #include "rpack.h"
 
 #include "audio.h"		// for enum modem_t
@@ -21,6 +23,38 @@ typedef enum bp_window_e { BP_WINDOW_TRUNCATED,
 				BP_WINDOW_FLATTOP } bp_window_t;
 
 
+#define MAX_FILTER_SIZE 320		/* 304 is needed for profile C, 300 baud & 44100. */
+
+/*
+ * Delay line for the FIR filters.
+ *
+ * Originally the most recent sample was put at the beginning of an
+ * array and all of the older samples were shifted down for every
+ * new audio sample.  That memory traffic cost more than the filter
+ * arithmetic when running many demodulators.
+ *
+ * Now we have a "mirrored" circular buffer.  Each sample is stored twice,
+ * 'size' positions apart, so the most recent 'size' samples are always
+ * available as a contiguous array, newest first, starting at buff[pos].
+ * See push_sample() and delay_line() in dsp.h.
+ */
+
+struct delay_line_s {
+	int pos;			/* Index of most recent sample.  0 .. size-1. */
+	float buff[2 * MAX_FILTER_SIZE] __attribute__((aligned(16)));
+};
+
+
+/*
+ * Version 1.5:  Same for fixed point.
+ */
+
+struct delay_line_q15_s {
+	int pos;
+	int16_t buff[2 * MAX_FILTER_SIZE] __attribute__((aligned(16)));
+};
+
+
 struct demodulator_state_s
 {
 /*
@@ -42,8 +76,6 @@ struct demodulator_state_s
 					/* but somewhat longer turned out to be better. */
 					/* Currently using same size for any prefilter. */
 
-#define MAX_FILTER_SIZE 320		/* 304 is needed for profile C, 300 baud & 44100. */
-
 /*
  * Filter length for Mark & Space in bit times.
  * e.g.  1 means 1/1200 second for 1200 baud.
@@ -97,6 +129,9 @@ struct demodulator_state_s
  */
 	float hysteresis;
 	int num_slicers;		/* >1 for multiple slicers. */
+	int slicers_off;		/* Version 1.5:  This many at each end aren't used */
+					/* now, leaving the middle ones.  Set by the */
+					/* governor in multi_modem.c when falling behind. */
 
 /* 
  * Phase Locked Loop (PLL) inertia.
@@ -123,17 +158,31 @@ struct demodulator_state_s
 
 	int pre_filter_size;	/* Size of pre filter, in audio samples. */									
 
-	float pre_filter[MAX_FILTER_SIZE] __attribute__((aligned(16)));
-
 /*
- * Kernel for the mark and space detection filters.
+ * Version 1.5:  Alternative to the mark and space filters above.
+ * A sliding DFT takes the same amount of computation for each sample
+ * regardless of the filter length.  See profile 'H' in demod_afsk.c.
+ *
+ * The window shape is applied by combining several neighboring 
+ * frequency bins so we need up to 9 for each tone.
  */
-					
-	float m_sin_table[MAX_FILTER_SIZE] __attribute__((aligned(16)));
-	float m_cos_table[MAX_FILTER_SIZE] __attribute__((aligned(16)));
+	int use_sdft;			/* True to use sliding DFT rather than FIR filters. */
+
+#define MAX_SDFT_BINS 9
+
+	int sdft_bins;			/* Number of bins used for each tone. */
+
+	float sdft_mix_re[MAX_SDFT_BINS];	/* How to combine the bins to get the */
+	float sdft_mix_im[MAX_SDFT_BINS];	/* effect of the window shape. */
 
-	float s_sin_table[MAX_FILTER_SIZE] __attribute__((aligned(16)));
-	float s_cos_table[MAX_FILTER_SIZE] __attribute__((aligned(16)));
+	float sdft_gain;		/* Normalize for unity gain. */
+
+/*
+ * Version 1.5:  Mark/space correlator specialized, at build time, for
+ * this profile, sample rate, baud, and tones.  See gen_fff in demod_afsk.c.
+ * NULL to use the general purpose dsp_convolve4.
+ */
+	void (*ms_calc) (const float *x, float *sums);
 
 /*
  * These are for PSK only.
@@ -150,17 +199,103 @@ struct demodulator_state_s
 	int psk_use_lo;		/* Use local oscillator rather than self correlation. */
 
 
+/*
+ * Version 1.5:  Fixed point arithmetic for processors without
+ * floating point hardware.  Only the AFSK FIR filter profiles
+ * and 9600 baud have it.
+ *
+ * The settings above are converted to integers with the indicated
+ * number of fraction bits.  Filter kernels have a different
+ * number depending on their gain.  See dsp_q15_shift.
+ */
+	int use_fixed;
+
+	struct {
+	  int pre_shift;		/* Fraction bits of kernels. */
+	  int ms_shift;
+	  int lp_shift;
+
+	  int lpf_iir;			/* Q15 */
+
+	  int agc_fast_attack;		/* Q31 */
+	  int agc_slow_decay;
+	  int quick_attack;
+	  int sluggish_decay;
+
+	  int hysteresis;		/* Q16 */
+
+	  int pll_locked_inertia;	/* Q16 */
+	  int pll_searching_inertia;
+	} qp;
+
+
+/*
+ * Version 1.5:  Filter kernels.
+ * These are read for every audio sample but never change after
+ * initialization.  They are kept together, and apart from the
+ * state below, so the cache lines holding them are never written.
+ */
+
+	float pre_filter[MAX_FILTER_SIZE] __attribute__((aligned(64)));
+
+/*
+ * Kernel for the mark and space detection filters.
+ */
+					
+	float m_sin_table[MAX_FILTER_SIZE] __attribute__((aligned(64)));
+	float m_cos_table[MAX_FILTER_SIZE] __attribute__((aligned(64)));
+
+	float s_sin_table[MAX_FILTER_SIZE] __attribute__((aligned(64)));
+	float s_cos_table[MAX_FILTER_SIZE] __attribute__((aligned(64)));
+
+/*
+ * Kernel for the lowpass filters.
+ */
+
+	float lp_filter[MAX_FILTER_SIZE] __attribute__((aligned(64)));
+
+/*
+ * Same kernels for fixed point.
+ */
+
+	int16_t pre_filter_q15[MAX_FILTER_SIZE] __attribute__((aligned(64)));
+	int16_t m_sin_q15[MAX_FILTER_SIZE] __attribute__((aligned(64)));
+	int16_t m_cos_q15[MAX_FILTER_SIZE] __attribute__((aligned(64)));
+	int16_t s_sin_q15[MAX_FILTER_SIZE] __attribute__((aligned(64)));
+	int16_t s_cos_q15[MAX_FILTER_SIZE] __attribute__((aligned(64)));
+	int16_t lp_filter_q15[MAX_FILTER_SIZE] __attribute__((aligned(64)));
+
+
 /*
  * The rest are continuously updated.
+ *
+ * Version 1.5:  Small items used for every sample come first, starting
+ * on a new cache line, so they occupy only a few lines.
+ * The large delay lines follow.
  */
 
-	unsigned int lo_phase;	/* Local oscillator for PSK. */
+	unsigned int lo_phase __attribute__((aligned(64)));
+				/* Local oscillator for PSK. */
 
+	int block_pos;		/* Index of audio sample currently being processed */
+				/* within the block given to demod_process_block. */
+				/* Used to determine when, within the block, a */
+				/* frame was received.  See multi_modem.c. */
 
 /*
- * Most recent raw audio samples, before/after prefiltering.
+ * Version 1.5:  Subchannels with identical tones and filters
+ * share the mark and space amplitudes rather than all computing
+ * the same thing.  See demod_init.
+ *
+ * ms_source is the demodulator which computes them for us
+ * or NULL if we do our own.
+ * m_amp_share and s_amp_share, indexed by block_pos, are where
+ * we save ours for others to use.  NULL if nobody else needs them.
  */
-	float raw_cb[MAX_FILTER_SIZE] __attribute__((aligned(16)));
+	struct demodulator_state_s *ms_source;
+	float *m_amp_share;
+	float *s_amp_share;
+
 
 /*
  * Use half of the AGC code to get a measure of input audio amplitude.
@@ -173,27 +308,34 @@ struct demodulator_state_s
 	float alevel_mark_peak;
 	float alevel_space_peak;
 
-/*
- * Input to the mark/space detector.
- * Could be prefiltered or raw audio.
- */
-	float ms_in_cb[MAX_FILTER_SIZE] __attribute__((aligned(16)));
+	float m_peak, s_peak;
+	float m_valley, s_valley;
+	float m_amp_prev, s_amp_prev;
 
 /*
- * Outputs from the mark and space amplitude detection, 
- * used as inputs to the FIR lowpass filters.
- * Kernel for the lowpass filters.
+ * Version 1.5:  Same for fixed point.
+ * In units of audio samples with AGC_FRAC fraction bits.  See dsp.h.
  */
+	struct {
+	  int alevel_rec_peak;
+	  int alevel_rec_valley;
+	  int alevel_mark_peak;
+	  int alevel_space_peak;
 
-	float m_amp_cb[MAX_FILTER_SIZE] __attribute__((aligned(16)));
-	float s_amp_cb[MAX_FILTER_SIZE] __attribute__((aligned(16)));
-
-	float lp_filter[MAX_FILTER_SIZE] __attribute__((aligned(16)));
-
+	  int m_peak, s_peak;
+	  int m_valley, s_valley;
+	  int m_amp_prev, s_amp_prev;
+	} q;
 
-	float m_peak, s_peak;
-	float m_valley, s_valley;
-	float m_amp_prev, s_amp_prev;
+/*
+ * Version 1.5:  Latest output from the filters, kept so we can tell how
+ * sure we are about a data bit when it is sampled.  For AFSK, the mark
+ * and space amplitudes.  Normalized by the AGC if only one slicer.
+ * For fixed point with one slicer, the difference and its scale.
+ * For 9600 baud fixed point, soft_s_q is the AGC range.
+ */
+	float soft_m, soft_s;
+	int64_t soft_m_q, soft_s_q;
 
 /*
  * For the PLL and data bit timing.
@@ -235,6 +377,7 @@ struct demodulator_state_s
 		int prev_demod_data;			// Previous data bit detected.
 							// Used to look for transitions.
 		float prev_demod_out_f;
+		int prev_demod_out_q;			// Same for fixed point.
 
 		/* This is used only for "9600" baud data. */
 
@@ -243,6 +386,46 @@ struct demodulator_state_s
 	} slicer [MAX_SLICERS];				// Actual number in use is num_slicers.
 							// Should be in range 1 .. MAX_SLICERS,
 
+/*
+ * Version 1.5:  Running sums for the sliding DFT.  See use_sdft above.
+ */
+
+	struct sdft_tone_s {
+	  float rot_re[MAX_SDFT_BINS];	/* Rotate previous sum by one sample, with */
+	  float rot_im[MAX_SDFT_BINS];	/* a little damping to keep it stable. */
+	  float old_re[MAX_SDFT_BINS];	/* Same for removing the sample leaving */
+	  float old_im[MAX_SDFT_BINS];	/* the window, filter size ago. */
+	  float acc_re[MAX_SDFT_BINS];	/* Running sums, continuously updated. */
+	  float acc_im[MAX_SDFT_BINS];
+	} sdft[2];			/* [0] for mark, [1] for space. */
+
+/*
+ * Most recent raw audio samples, before/after prefiltering.
+ */
+	struct delay_line_s raw_cb;
+
+/*
+ * Input to the mark/space detector.
+ * Could be prefiltered or raw audio.
+ */
+	struct delay_line_s ms_in_cb;
+
+/*
+ * Outputs from the mark and space amplitude detection, 
+ * used as inputs to the FIR lowpass filters.
+ */
+
+	struct delay_line_s m_amp_cb;
+	struct delay_line_s s_amp_cb;
+
+/*
+ * Same delay lines for fixed point.
+ */
+	struct delay_line_q15_s raw_q15;
+	struct delay_line_q15_s ms_in_q15;
+	struct delay_line_q15_s m_amp_q15;
+	struct delay_line_q15_s s_amp_q15;
+
 /* 
  * Special for Rino decoder only.
  * One for each possible signal polarity.
@@ -0,0 +1,1867 @@
+/* This is an automatically generated file.  Do not edit. */
+
+
+/* A, 1200 baud, 1200 & 2200 Hz, 44100 samples per second. */
+
+static const float fff_A_1200_44100[52][4] = {
+	{ 3.82993557e-02f, -1.25603303e-02f, -3.68112661e-02f, -5.51749859e-03f },
+	{ 3.53429243e-02f, -1.81841329e-02f, -3.66046354e-02f, 6.91933697e-03f },
+	{ 3.13558951e-02f, -2.32776888e-02f, -3.28309834e-02f, 1.86819006e-02f },
+	{ 2.64545232e-02f, -2.76924726e-02f, -2.58580390e-02f, 2.86239665e-02f },
+	{ 2.07817443e-02f, -3.12997401e-02f, -1.63653195e-02f, 3.57766971e-02f },
+	{ 1.45029640e-02f, -3.39943133e-02f, -5.27782971e-03f, 3.94431017e-02f },
+	{ 7.80128594e-03f, -3.56976092e-02f, 6.32396946e-03f, 3.92658822e-02f },
+	{ 8.72113102e-04f, -3.63599695e-02f, 1.73095148e-02f, 3.52623127e-02f },
+	{ -6.08248077e-03f, -3.59620713e-02f, 2.66082846e-02f, 2.78225392e-02f },
+	{ -1.28597189e-02f, -3.45155187e-02f, 3.33141647e-02f, 1.76715273e-02f },
+	{ -1.92619599e-02f, -3.20625007e-02f, 3.67736705e-02f, 5.79847535e-03f },
+	{ -2.51025297e-02f, -2.86745355e-02f, 3.66496854e-02f, -6.63962215e-03f },
+	{ -3.02111041e-02f, -2.44504269e-02f, 3.29542980e-02f, -1.84306893e-02f },
+	{ -3.44387330e-02f, -1.95133388e-02f, 2.60475986e-02f, -2.84257568e-02f },
+	{ -3.76621224e-02f, -1.40072498e-02f, 1.66026354e-02f, -3.56508121e-02f },
+	{ -3.97872888e-02f, -8.09270237e-03f, 5.53979957e-03f, -3.94017920e-02f },
+	{ -4.07522544e-02f, -1.94218068e-03f, -6.06288249e-03f, -3.93131822e-02f },
+	{ -4.05288935e-02f, 4.26498381e-03f, -1.70747451e-02f, -3.53936106e-02f },
+	{ -3.91237065e-02f, 1.03477733e-02f, -2.64227316e-02f, -2.80250330e-02f },
+	{ -3.65776755e-02f, 1.61288306e-02f, -3.31958905e-02f, -1.79254990e-02f },
+	{ -3.29650417e-02f, 2.14395653e-02f, -3.67342085e-02f, -6.07916806e-03f },
+	{ -2.83911489e-02f, 2.61251256e-02f, -3.66928764e-02f, 6.35955203e-03f },
+	{ -2.29893699e-02f, 3.00488770e-02f, -3.30759324e-02f, 1.81785598e-02f },
+	{ -1.69172231e-02f, 3.30964066e-02f, -2.62358282e-02f, 2.82261111e-02f },
+	{ -1.03517687e-02f, 3.51788439e-02f, -1.68391205e-02f, 3.55231129e-02f },
+	{ -3.48445866e-03f, 3.62354666e-02f, -5.80148632e-03f, 3.93584855e-02f },
+	{ 3.48445866e-03f, 3.62354666e-02f, 5.80148632e-03f, 3.93584855e-02f },
+	{ 1.03517687e-02f, 3.51788439e-02f, 1.68391205e-02f, 3.55231129e-02f },
+	{ 1.69172231e-02f, 3.30964066e-02f, 2.62358282e-02f, 2.82261111e-02f },
+	{ 2.29893699e-02f, 3.00488770e-02f, 3.30759324e-02f, 1.81785598e-02f },
+	{ 2.83911489e-02f, 2.61251256e-02f, 3.66928764e-02f, 6.35955203e-03f },
+	{ 3.29650417e-02f, 2.14395653e-02f, 3.67342085e-02f, -6.07916806e-03f },
+	{ 3.65776755e-02f, 1.61288306e-02f, 3.31958905e-02f, -1.79254990e-02f },
+	{ 3.91237065e-02f, 1.03477733e-02f, 2.64227316e-02f, -2.80250330e-02f },
+	{ 4.05288935e-02f, 4.26498381e-03f, 1.70747451e-02f, -3.53936106e-02f },
+	{ 4.07522544e-02f, -1.94218068e-03f, 6.06288249e-03f, -3.93131822e-02f },
+	{ 3.97872888e-02f, -8.09270237e-03f, -5.53979957e-03f, -3.94017920e-02f },
+	{ 3.76621224e-02f, -1.40072498e-02f, -1.66026354e-02f, -3.56508121e-02f },
+	{ 3.44387330e-02f, -1.95133388e-02f, -2.60475986e-02f, -2.84257568e-02f },
+	{ 3.02111041e-02f, -2.44504269e-02f, -3.29542980e-02f, -1.84306893e-02f },
+	{ 2.51025297e-02f, -2.86745355e-02f, -3.66496854e-02f, -6.63962215e-03f },
+	{ 1.92619599e-02f, -3.20625007e-02f, -3.67736705e-02f, 5.79847535e-03f },
+	{ 1.28597189e-02f, -3.45155187e-02f, -3.33141647e-02f, 1.76715273e-02f },
+	{ 6.08248077e-03f, -3.59620713e-02f, -2.66082846e-02f, 2.78225392e-02f },
+	{ -8.72113102e-04f, -3.63599695e-02f, -1.73095148e-02f, 3.52623127e-02f },
+	{ -7.80128594e-03f, -3.56976092e-02f, -6.32396946e-03f, 3.92658822e-02f },
+	{ -1.45029640e-02f, -3.39943133e-02f, 5.27782971e-03f, 3.94431017e-02f },
+	{ -2.07817443e-02f, -3.12997401e-02f, 1.63653195e-02f, 3.57766971e-02f },
+	{ -2.64545232e-02f, -2.76924726e-02f, 2.58580390e-02f, 2.86239665e-02f },
+	{ -3.13558951e-02f, -2.32776888e-02f, 3.28309834e-02f, 1.86819006e-02f },
+	{ -3.53429243e-02f, -1.81841329e-02f, 3.66046354e-02f, 6.91933697e-03f },
+	{ -3.82993557e-02f, -1.25603303e-02f, 3.68112661e-02f, -5.51749859e-03f },
+};
+
+static void fff_A_1200_44100_calc (const float *x, float *sums)
+{
+	fff_calc (x, fff_A_1200_44100, 52, sums);
+}
+
+/* B, 1200 baud, 1200 & 2200 Hz, 44100 samples per second. */
+
+static const float fff_B_1200_44100[52][4] = {
+	{ 3.82993557e-02f, -1.25603303e-02f, -3.68112661e-02f, -5.51749859e-03f },
+	{ 3.53429243e-02f, -1.81841329e-02f, -3.66046354e-02f, 6.91933697e-03f },
+	{ 3.13558951e-02f, -2.32776888e-02f, -3.28309834e-02f, 1.86819006e-02f },
+	{ 2.64545232e-02f, -2.76924726e-02f, -2.58580390e-02f, 2.86239665e-02f },
+	{ 2.07817443e-02f, -3.12997401e-02f, -1.63653195e-02f, 3.57766971e-02f },
+	{ 1.45029640e-02f, -3.39943133e-02f, -5.27782971e-03f, 3.94431017e-02f },
+	{ 7.80128594e-03f, -3.56976092e-02f, 6.32396946e-03f, 3.92658822e-02f },
+	{ 8.72113102e-04f, -3.63599695e-02f, 1.73095148e-02f, 3.52623127e-02f },
+	{ -6.08248077e-03f, -3.59620713e-02f, 2.66082846e-02f, 2.78225392e-02f },
+	{ -1.28597189e-02f, -3.45155187e-02f, 3.33141647e-02f, 1.76715273e-02f },
+	{ -1.92619599e-02f, -3.20625007e-02f, 3.67736705e-02f, 5.79847535e-03f },
+	{ -2.51025297e-02f, -2.86745355e-02f, 3.66496854e-02f, -6.63962215e-03f },
+	{ -3.02111041e-02f, -2.44504269e-02f, 3.29542980e-02f, -1.84306893e-02f },
+	{ -3.44387330e-02f, -1.95133388e-02f, 2.60475986e-02f, -2.84257568e-02f },
+	{ -3.76621224e-02f, -1.40072498e-02f, 1.66026354e-02f, -3.56508121e-02f },
+	{ -3.97872888e-02f, -8.09270237e-03f, 5.53979957e-03f, -3.94017920e-02f },
+	{ -4.07522544e-02f, -1.94218068e-03f, -6.06288249e-03f, -3.93131822e-02f },
+	{ -4.05288935e-02f, 4.26498381e-03f, -1.70747451e-02f, -3.53936106e-02f },
+	{ -3.91237065e-02f, 1.03477733e-02f, -2.64227316e-02f, -2.80250330e-02f },
+	{ -3.65776755e-02f, 1.61288306e-02f, -3.31958905e-02f, -1.79254990e-02f },
+	{ -3.29650417e-02f, 2.14395653e-02f, -3.67342085e-02f, -6.07916806e-03f },
+	{ -2.83911489e-02f, 2.61251256e-02f, -3.66928764e-02f, 6.35955203e-03f },
+	{ -2.29893699e-02f, 3.00488770e-02f, -3.30759324e-02f, 1.81785598e-02f },
+	{ -1.69172231e-02f, 3.30964066e-02f, -2.62358282e-02f, 2.82261111e-02f },
+	{ -1.03517687e-02f, 3.51788439e-02f, -1.68391205e-02f, 3.55231129e-02f },
+	{ -3.48445866e-03f, 3.62354666e-02f, -5.80148632e-03f, 3.93584855e-02f },
+	{ 3.48445866e-03f, 3.62354666e-02f, 5.80148632e-03f, 3.93584855e-02f },
+	{ 1.03517687e-02f, 3.51788439e-02f, 1.68391205e-02f, 3.55231129e-02f },
+	{ 1.69172231e-02f, 3.30964066e-02f, 2.62358282e-02f, 2.82261111e-02f },
+	{ 2.29893699e-02f, 3.00488770e-02f, 3.30759324e-02f, 1.81785598e-02f },
+	{ 2.83911489e-02f, 2.61251256e-02f, 3.66928764e-02f, 6.35955203e-03f },
+	{ 3.29650417e-02f, 2.14395653e-02f, 3.67342085e-02f, -6.07916806e-03f },
+	{ 3.65776755e-02f, 1.61288306e-02f, 3.31958905e-02f, -1.79254990e-02f },
+	{ 3.91237065e-02f, 1.03477733e-02f, 2.64227316e-02f, -2.80250330e-02f },
+	{ 4.05288935e-02f, 4.26498381e-03f, 1.70747451e-02f, -3.53936106e-02f },
+	{ 4.07522544e-02f, -1.94218068e-03f, 6.06288249e-03f, -3.93131822e-02f },
+	{ 3.97872888e-02f, -8.09270237e-03f, -5.53979957e-03f, -3.94017920e-02f },
+	{ 3.76621224e-02f, -1.40072498e-02f, -1.66026354e-02f, -3.56508121e-02f },
+	{ 3.44387330e-02f, -1.95133388e-02f, -2.60475986e-02f, -2.84257568e-02f },
+	{ 3.02111041e-02f, -2.44504269e-02f, -3.29542980e-02f, -1.84306893e-02f },
+	{ 2.51025297e-02f, -2.86745355e-02f, -3.66496854e-02f, -6.63962215e-03f },
+	{ 1.92619599e-02f, -3.20625007e-02f, -3.67736705e-02f, 5.79847535e-03f },
+	{ 1.28597189e-02f, -3.45155187e-02f, -3.33141647e-02f, 1.76715273e-02f },
+	{ 6.08248077e-03f, -3.59620713e-02f, -2.66082846e-02f, 2.78225392e-02f },
+	{ -8.72113102e-04f, -3.63599695e-02f, -1.73095148e-02f, 3.52623127e-02f },
+	{ -7.80128594e-03f, -3.56976092e-02f, -6.32396946e-03f, 3.92658822e-02f },
+	{ -1.45029640e-02f, -3.39943133e-02f, 5.27782971e-03f, 3.94431017e-02f },
+	{ -2.07817443e-02f, -3.12997401e-02f, 1.63653195e-02f, 3.57766971e-02f },
+	{ -2.64545232e-02f, -2.76924726e-02f, 2.58580390e-02f, 2.86239665e-02f },
+	{ -3.13558951e-02f, -2.32776888e-02f, 3.28309834e-02f, 1.86819006e-02f },
+	{ -3.53429243e-02f, -1.81841329e-02f, 3.66046354e-02f, 6.91933697e-03f },
+	{ -3.82993557e-02f, -1.25603303e-02f, 3.68112661e-02f, -5.51749859e-03f },
+};
+
+static void fff_B_1200_44100_calc (const float *x, float *sums)
+{
+	fff_calc (x, fff_B_1200_44100, 52, sums);
+}
+
+/* C, 1200 baud, 1200 & 2200 Hz, 44100 samples per second. */
+
+static const float fff_C_1200_44100[76][4] = {
+	{ -1.07790504e-04f, 8.58762243e-04f, 6.19275961e-04f, 5.88339753e-04f },
+	{ 1.07991436e-04f, 2.59376271e-03f, 2.30901712e-03f, 1.10428419e-03f },
+	{ 8.92350334e-04f, 4.22363309e-03f, 4.22227662e-03f, 5.60934423e-04f },
+	{ 2.20668176e-03f, 5.59894927e-03f, 5.85475797e-03f, -1.07779074e-03f },
+	{ 3.97901796e-03f, 6.58279518e-03f, 6.71909051e-03f, -3.63607449e-03f },
+	{ 6.10746536e-03f, 7.05818692e-03f, 6.42644241e-03f, -6.74600992e-03f },
+	{ 8.46517831e-03f, 6.93455385e-03f, 4.75566508e-03f, -9.89705976e-03f },
+	{ 1.09065576e-02f, 6.15294604e-03f, 1.69974042e-03f, -1.25087146e-02f },
+	{ 1.32744648e-02f, 4.68977634e-03f, -2.51745339e-03f, -1.40166106e-02f },
+	{ 1.54080745e-02f, 2.55888142e-03f, -7.45752547e-03f, -1.39604453e-02f },
+	{ 1.71510149e-02f, -1.88262755e-04f, -1.25157777e-02f, -1.20613528e-02f },
+	{ 1.83593929e-02f, -3.46408971e-03f, -1.69957336e-02f, -8.27766489e-03f },
+	{ 1.89093798e-02f, -7.14828726e-03f, -2.02007927e-02f, -2.83060526e-03f },
+	{ 1.87039189e-02f, -1.10927140e-02f, -2.15311889e-02f, 3.80492280e-03f },
+	{ 1.76782962e-02f, -1.51278134e-02f, -2.05734409e-02f, 1.09444400e-02f },
+	{ 1.58043094e-02f, -1.90700777e-02f, -1.71701089e-02f, 1.77687444e-02f },
+	{ 1.30927684e-02f, -2.27303095e-02f, -1.14597678e-02f, 2.34207623e-02f },
+	{ 9.59422160e-03f, -2.59223487e-02f, -3.88070103e-03f, 2.71128584e-02f },
+	{ 5.39792283e-03f, -2.84717847e-02f, 4.86353505e-03f, 2.82310527e-02f },
+	{ 6.28913171e-04f, -3.02243195e-02f, 1.38740940e-02f, 2.64228676e-02f },
+	{ -4.55647800e-03f, -3.10533401e-02f, 2.21547708e-02f, 2.16569137e-02f },
+	{ -9.97673720e-03f, -3.08664460e-02f, 2.87268367e-02f, 1.42456554e-02f },
+	{ -1.54324044e-02f, -2.96104923e-02f, 3.27470340e-02f, 4.82723257e-03f },
+	{ -2.07143389e-02f, -2.72750203e-02f, 3.36144231e-02f, -5.69309248e-03f },
+	{ -2.56124660e-02f, -2.38938630e-02f, 3.10526527e-02f, -1.62359495e-02f },
+	{ -2.99248006e-02f, -1.95447821e-02f, 2.51567010e-02f, -2.56653633e-02f },
+	{ -3.34661677e-02f, -1.43472683e-02f, 1.63975935e-02f, -3.29171270e-02f },
+	{ -3.60764191e-02f, -8.45839176e-03f, 5.58309536e-03f, -3.71232815e-02f },
+	{ -3.76276150e-02f, -2.06709211e-03f, -6.22208742e-03f, -3.77176404e-02f },
+	{ -3.80299725e-02f, 4.61310940e-03f, -1.78080909e-02f, -3.45094018e-02f },
+	{ -3.72361913e-02f, 1.13523901e-02f, -2.79514827e-02f, -2.77154967e-02f },
+	{ -3.52441370e-02f, 1.79138407e-02f, -3.55514139e-02f, -1.79470591e-02f },
+	{ -3.20974998e-02f, 2.40629390e-02f, -3.97548489e-02f, -6.15053670e-03f },
+	{ -2.78846584e-02f, 2.95771156e-02f, -4.00558524e-02f, 6.49023103e-03f },
+	{ -2.27355566e-02f, 3.42548341e-02f, -3.63573693e-02f, 1.86805334e-02f },
+	{ -1.68168880e-02f, 3.79238576e-02f, -2.89876629e-02f, 2.91553922e-02f },
+	{ -1.03256861e-02f, 4.04483713e-02f, -1.86691955e-02f, 3.68185453e-02f },
+	{ -3.48162744e-03f, 4.17345725e-02f, -6.44299947e-03f, 4.08635996e-02f },
+	{ 3.48162744e-03f, 4.17345725e-02f, 6.44299947e-03f, 4.08635996e-02f },
+	{ 1.03256861e-02f, 4.04483713e-02f, 1.86691955e-02f, 3.68185453e-02f },
+	{ 1.68168880e-02f, 3.79238576e-02f, 2.89876629e-02f, 2.91553922e-02f },
+	{ 2.27355566e-02f, 3.42548341e-02f, 3.63573693e-02f, 1.86805334e-02f },
+	{ 2.78846584e-02f, 2.95771156e-02f, 4.00558524e-02f, 6.49023103e-03f },
+	{ 3.20974998e-02f, 2.40629390e-02f, 3.97548489e-02f, -6.15053670e-03f },
+	{ 3.52441370e-02f, 1.79138407e-02f, 3.55514139e-02f, -1.79470591e-02f },
+	{ 3.72361913e-02f, 1.13523901e-02f, 2.79514827e-02f, -2.77154967e-02f },
+	{ 3.80299725e-02f, 4.61310940e-03f, 1.78080909e-02f, -3.45094018e-02f },
+	{ 3.76276150e-02f, -2.06709211e-03f, 6.22208742e-03f, -3.77176404e-02f },
+	{ 3.60764191e-02f, -8.45839176e-03f, -5.58309536e-03f, -3.71232815e-02f },
+	{ 3.34661677e-02f, -1.43472683e-02f, -1.63975935e-02f, -3.29171270e-02f },
+	{ 2.99248006e-02f, -1.95447821e-02f, -2.51567010e-02f, -2.56653633e-02f },
+	{ 2.56124660e-02f, -2.38938630e-02f, -3.10526527e-02f, -1.62359495e-02f },
+	{ 2.07143389e-02f, -2.72750203e-02f, -3.36144231e-02f, -5.69309248e-03f },
+	{ 1.54324044e-02f, -2.96104923e-02f, -3.27470340e-02f, 4.82723257e-03f },
+	{ 9.97673720e-03f, -3.08664460e-02f, -2.87268367e-02f, 1.42456554e-02f },
+	{ 4.55647800e-03f, -3.10533401e-02f, -2.21547708e-02f, 2.16569137e-02f },
+	{ -6.28913171e-04f, -3.02243195e-02f, -1.38740940e-02f, 2.64228676e-02f },
+	{ -5.39792283e-03f, -2.84717847e-02f, -4.86353505e-03f, 2.82310527e-02f },
+	{ -9.59422160e-03f, -2.59223487e-02f, 3.88070103e-03f, 2.71128584e-02f },
+	{ -1.30927684e-02f, -2.27303095e-02f, 1.14597678e-02f, 2.34207623e-02f },
+	{ -1.58043094e-02f, -1.90700777e-02f, 1.71701089e-02f, 1.77687444e-02f },
+	{ -1.76782962e-02f, -1.51278134e-02f, 2.05734409e-02f, 1.09444400e-02f },
+	{ -1.87039189e-02f, -1.10927140e-02f, 2.15311889e-02f, 3.80492280e-03f },
+	{ -1.89093798e-02f, -7.14828726e-03f, 2.02007927e-02f, -2.83060526e-03f },
+	{ -1.83593929e-02f, -3.46408971e-03f, 1.69957336e-02f, -8.27766489e-03f },
+	{ -1.71510149e-02f, -1.88262755e-04f, 1.25157777e-02f, -1.20613528e-02f },
+	{ -1.54080745e-02f, 2.55888142e-03f, 7.45752547e-03f, -1.39604453e-02f },
+	{ -1.32744648e-02f, 4.68977634e-03f, 2.51745339e-03f, -1.40166106e-02f },
+	{ -1.09065576e-02f, 6.15294604e-03f, -1.69974042e-03f, -1.25087146e-02f },
+	{ -8.46517831e-03f, 6.93455385e-03f, -4.75566508e-03f, -9.89705976e-03f },
+	{ -6.10746536e-03f, 7.05818692e-03f, -6.42644241e-03f, -6.74600992e-03f },
+	{ -3.97901796e-03f, 6.58279518e-03f, -6.71909051e-03f, -3.63607449e-03f },
+	{ -2.20668176e-03f, 5.59894927e-03f, -5.85475797e-03f, -1.07779074e-03f },
+	{ -8.92350334e-04f, 4.22363309e-03f, -4.22227662e-03f, 5.60934423e-04f },
+	{ -1.07991436e-04f, 2.59376271e-03f, -2.30901712e-03f, 1.10428419e-03f },
+	{ 1.07790504e-04f, 8.58762243e-04f, -6.19275961e-04f, 5.88339753e-04f },
+};
+
+static void fff_C_1200_44100_calc (const float *x, float *sums)
+{
+	fff_calc (x, fff_C_1200_44100, 76, sums);
+}
+
+/* F, 1200 baud, 1200 & 2200 Hz, 44100 samples per second. */
+
+static const float fff_F_1200_44100[52][4] = {
+	{ 3.82993557e-02f, -1.25603303e-02f, -3.68112661e-02f, -5.51749859e-03f },
+	{ 3.53429243e-02f, -1.81841329e-02f, -3.66046354e-02f, 6.91933697e-03f },
+	{ 3.13558951e-02f, -2.32776888e-02f, -3.28309834e-02f, 1.86819006e-02f },
+	{ 2.64545232e-02f, -2.76924726e-02f, -2.58580390e-02f, 2.86239665e-02f },
+	{ 2.07817443e-02f, -3.12997401e-02f, -1.63653195e-02f, 3.57766971e-02f },
+	{ 1.45029640e-02f, -3.39943133e-02f, -5.27782971e-03f, 3.94431017e-02f },
+	{ 7.80128594e-03f, -3.56976092e-02f, 6.32396946e-03f, 3.92658822e-02f },
+	{ 8.72113102e-04f, -3.63599695e-02f, 1.73095148e-02f, 3.52623127e-02f },
+	{ -6.08248077e-03f, -3.59620713e-02f, 2.66082846e-02f, 2.78225392e-02f },
+	{ -1.28597189e-02f, -3.45155187e-02f, 3.33141647e-02f, 1.76715273e-02f },
+	{ -1.92619599e-02f, -3.20625007e-02f, 3.67736705e-02f, 5.79847535e-03f },
+	{ -2.51025297e-02f, -2.86745355e-02f, 3.66496854e-02f, -6.63962215e-03f },
+	{ -3.02111041e-02f, -2.44504269e-02f, 3.29542980e-02f, -1.84306893e-02f },
+	{ -3.44387330e-02f, -1.95133388e-02f, 2.60475986e-02f, -2.84257568e-02f },
+	{ -3.76621224e-02f, -1.40072498e-02f, 1.66026354e-02f, -3.56508121e-02f },
+	{ -3.97872888e-02f, -8.09270237e-03f, 5.53979957e-03f, -3.94017920e-02f },
+	{ -4.07522544e-02f, -1.94218068e-03f, -6.06288249e-03f, -3.93131822e-02f },
+	{ -4.05288935e-02f, 4.26498381e-03f, -1.70747451e-02f, -3.53936106e-02f },
+	{ -3.91237065e-02f, 1.03477733e-02f, -2.64227316e-02f, -2.80250330e-02f },
+	{ -3.65776755e-02f, 1.61288306e-02f, -3.31958905e-02f, -1.79254990e-02f },
+	{ -3.29650417e-02f, 2.14395653e-02f, -3.67342085e-02f, -6.07916806e-03f },
+	{ -2.83911489e-02f, 2.61251256e-02f, -3.66928764e-02f, 6.35955203e-03f },
+	{ -2.29893699e-02f, 3.00488770e-02f, -3.30759324e-02f, 1.81785598e-02f },
+	{ -1.69172231e-02f, 3.30964066e-02f, -2.62358282e-02f, 2.82261111e-02f },
+	{ -1.03517687e-02f, 3.51788439e-02f, -1.68391205e-02f, 3.55231129e-02f },
+	{ -3.48445866e-03f, 3.62354666e-02f, -5.80148632e-03f, 3.93584855e-02f },
+	{ 3.48445866e-03f, 3.62354666e-02f, 5.80148632e-03f, 3.93584855e-02f },
+	{ 1.03517687e-02f, 3.51788439e-02f, 1.68391205e-02f, 3.55231129e-02f },
+	{ 1.69172231e-02f, 3.30964066e-02f, 2.62358282e-02f, 2.82261111e-02f },
+	{ 2.29893699e-02f, 3.00488770e-02f, 3.30759324e-02f, 1.81785598e-02f },
+	{ 2.83911489e-02f, 2.61251256e-02f, 3.66928764e-02f, 6.35955203e-03f },
+	{ 3.29650417e-02f, 2.14395653e-02f, 3.67342085e-02f, -6.07916806e-03f },
+	{ 3.65776755e-02f, 1.61288306e-02f, 3.31958905e-02f, -1.79254990e-02f },
+	{ 3.91237065e-02f, 1.03477733e-02f, 2.64227316e-02f, -2.80250330e-02f },
+	{ 4.05288935e-02f, 4.26498381e-03f, 1.70747451e-02f, -3.53936106e-02f },
+	{ 4.07522544e-02f, -1.94218068e-03f, 6.06288249e-03f, -3.93131822e-02f },
+	{ 3.97872888e-02f, -8.09270237e-03f, -5.53979957e-03f, -3.94017920e-02f },
+	{ 3.76621224e-02f, -1.40072498e-02f, -1.66026354e-02f, -3.56508121e-02f },
+	{ 3.44387330e-02f, -1.95133388e-02f, -2.60475986e-02f, -2.84257568e-02f },
+	{ 3.02111041e-02f, -2.44504269e-02f, -3.29542980e-02f, -1.84306893e-02f },
+	{ 2.51025297e-02f, -2.86745355e-02f, -3.66496854e-02f, -6.63962215e-03f },
+	{ 1.92619599e-02f, -3.20625007e-02f, -3.67736705e-02f, 5.79847535e-03f },
+	{ 1.28597189e-02f, -3.45155187e-02f, -3.33141647e-02f, 1.76715273e-02f },
+	{ 6.08248077e-03f, -3.59620713e-02f, -2.66082846e-02f, 2.78225392e-02f },
+	{ -8.72113102e-04f, -3.63599695e-02f, -1.73095148e-02f, 3.52623127e-02f },
+	{ -7.80128594e-03f, -3.56976092e-02f, -6.32396946e-03f, 3.92658822e-02f },
+	{ -1.45029640e-02f, -3.39943133e-02f, 5.27782971e-03f, 3.94431017e-02f },
+	{ -2.07817443e-02f, -3.12997401e-02f, 1.63653195e-02f, 3.57766971e-02f },
+	{ -2.64545232e-02f, -2.76924726e-02f, 2.58580390e-02f, 2.86239665e-02f },
+	{ -3.13558951e-02f, -2.32776888e-02f, 3.28309834e-02f, 1.86819006e-02f },
+	{ -3.53429243e-02f, -1.81841329e-02f, 3.66046354e-02f, 6.91933697e-03f },
+	{ -3.82993557e-02f, -1.25603303e-02f, 3.68112661e-02f, -5.51749859e-03f },
+};
+
+static void fff_F_1200_44100_calc (const float *x, float *sums)
+{
+	fff_calc_sparse (x, fff_F_1200_44100, 52, sums);
+}
+
+/* A, 1200 baud, 1200 & 2200 Hz, 48000 samples per second. */
+
+static const float fff_A_1200_48000[57][4] = {
+	{ 3.51605751e-02f, -1.03174029e-02f, -3.29972133e-02f, -7.60004204e-03f },
+	{ 3.29405330e-02f, -1.51577378e-02f, -3.36304009e-02f, 2.86799576e-03f },
+	{ 2.99093779e-02f, -1.96248535e-02f, -3.14937681e-02f, 1.30998399e-02f },
+	{ 2.61417553e-02f, -2.36087404e-02f, -2.67632976e-02f, 2.22527590e-02f },
+	{ 2.17304360e-02f, -2.70113014e-02f, -1.98285785e-02f, 2.95729414e-02f },
+	{ 1.67840403e-02f, -2.97487527e-02f, -1.12607758e-02f, 3.44574712e-02f },
+	{ 1.14243636e-02f, -3.17536928e-02f, -1.76553358e-03f, 3.65040675e-02f },
+	{ 5.78339072e-03f, -3.29767466e-02f, 7.87513517e-03f, 3.55441719e-02f },
+	{ 3.23202176e-09f, -3.33878063e-02f, 1.68671887e-02f, 3.16568427e-02f },
+	{ -5.78338467e-03f, -3.29767466e-02f, 2.44700629e-02f, 2.51622256e-02f },
+	{ -1.14243571e-02f, -3.17536928e-02f, 3.00575607e-02f, 1.65952500e-02f },
+	{ -1.67840328e-02f, -2.97487546e-02f, 3.31695080e-02f, 6.66146493e-03f },
+	{ -2.17304304e-02f, -2.70113051e-02f, 3.35495919e-02f, -3.82094621e-03f },
+	{ -2.61417516e-02f, -2.36087441e-02f, 3.11665200e-02f, -1.39886625e-02f },
+	{ -2.99093742e-02f, -1.96248572e-02f, 2.62165479e-02f, -2.30042785e-02f },
+	{ -3.29405256e-02f, -1.51577508e-02f, 1.91073716e-02f, -3.01252455e-02f },
+	{ -3.51605751e-02f, -1.03174010e-02f, 1.04244994e-02f, -3.47650796e-02f },
+	{ -3.65148596e-02f, -5.22300322e-03f, 8.83069413e-04f, -3.65416408e-02f },
+	{ -3.69700193e-02f, -1.45942736e-09f, -8.73109885e-03f, -3.53086144e-02f },
+	{ -3.65148596e-02f, 5.22300042e-03f, -1.76261682e-02f, -3.11675519e-02f },
+	{ -3.51605788e-02f, 1.03173992e-02f, -2.50695385e-02f, -2.44595129e-02f },
+	{ -3.29405293e-02f, 1.51577471e-02f, -3.04481648e-02f, -1.57369748e-02f },
+	{ -2.99093742e-02f, 1.96248591e-02f, -3.33190672e-02f, -5.71833039e-03f },
+	{ -2.61417516e-02f, 2.36087441e-02f, -3.34457904e-02f, 4.77127358e-03f },
+	{ -2.17304323e-02f, 2.70113032e-02f, -3.08179017e-02f, 1.48679176e-02f },
+	{ -1.67840384e-02f, 2.97487527e-02f, -2.56518330e-02f, 2.37400308e-02f },
+	{ -1.14243645e-02f, 3.17536928e-02f, -1.83730666e-02f, 3.06569021e-02f },
+	{ -5.78338560e-03f, 3.29767466e-02f, -9.58108529e-03f, 3.50488536e-02f },
+	{ 0.00000000e+00f, 3.33878063e-02f, 0.00000000e+00f, 3.65541652e-02f },
+	{ 5.78338560e-03f, 3.29767466e-02f, 9.58108529e-03f, 3.50488536e-02f },
+	{ 1.14243645e-02f, 3.17536928e-02f, 1.83730666e-02f, 3.06569021e-02f },
+	{ 1.67840384e-02f, 2.97487527e-02f, 2.56518330e-02f, 2.37400308e-02f },
+	{ 2.17304323e-02f, 2.70113032e-02f, 3.08179017e-02f, 1.48679176e-02f },
+	{ 2.61417516e-02f, 2.36087441e-02f, 3.34457904e-02f, 4.77127358e-03f },
+	{ 2.99093742e-02f, 1.96248591e-02f, 3.33190672e-02f, -5.71833039e-03f },
+	{ 3.29405293e-02f, 1.51577471e-02f, 3.04481648e-02f, -1.57369748e-02f },
+	{ 3.51605788e-02f, 1.03173992e-02f, 2.50695385e-02f, -2.44595129e-02f },
+	{ 3.65148596e-02f, 5.22300042e-03f, 1.76261682e-02f, -3.11675519e-02f },
+	{ 3.69700193e-02f, -1.45942736e-09f, 8.73109885e-03f, -3.53086144e-02f },
+	{ 3.65148596e-02f, -5.22300322e-03f, -8.83069413e-04f, -3.65416408e-02f },
+	{ 3.51605751e-02f, -1.03174010e-02f, -1.04244994e-02f, -3.47650796e-02f },
+	{ 3.29405256e-02f, -1.51577508e-02f, -1.91073716e-02f, -3.01252455e-02f },
+	{ 2.99093742e-02f, -1.96248572e-02f, -2.62165479e-02f, -2.30042785e-02f },
+	{ 2.61417516e-02f, -2.36087441e-02f, -3.11665200e-02f, -1.39886625e-02f },
+	{ 2.17304304e-02f, -2.70113051e-02f, -3.35495919e-02f, -3.82094621e-03f },
+	{ 1.67840328e-02f, -2.97487546e-02f, -3.31695080e-02f, 6.66146493e-03f },
+	{ 1.14243571e-02f, -3.17536928e-02f, -3.00575607e-02f, 1.65952500e-02f },
+	{ 5.78338467e-03f, -3.29767466e-02f, -2.44700629e-02f, 2.51622256e-02f },
+	{ -3.23202176e-09f, -3.33878063e-02f, -1.68671887e-02f, 3.16568427e-02f },
+	{ -5.78339072e-03f, -3.29767466e-02f, -7.87513517e-03f, 3.55441719e-02f },
+	{ -1.14243636e-02f, -3.17536928e-02f, 1.76553358e-03f, 3.65040675e-02f },
+	{ -1.67840403e-02f, -2.97487527e-02f, 1.12607758e-02f, 3.44574712e-02f },
+	{ -2.17304360e-02f, -2.70113014e-02f, 1.98285785e-02f, 2.95729414e-02f },
+	{ -2.61417553e-02f, -2.36087404e-02f, 2.67632976e-02f, 2.22527590e-02f },
+	{ -2.99093779e-02f, -1.96248535e-02f, 3.14937681e-02f, 1.30998399e-02f },
+	{ -3.29405330e-02f, -1.51577378e-02f, 3.36304009e-02f, 2.86799576e-03f },
+	{ -3.51605751e-02f, -1.03174029e-02f, 3.29972133e-02f, -7.60004204e-03f },
+};
+
+static void fff_A_1200_48000_calc (const float *x, float *sums)
+{
+	fff_calc (x, fff_A_1200_48000, 57, sums);
+}
+
+/* B, 1200 baud, 1200 & 2200 Hz, 48000 samples per second. */
+
+static const float fff_B_1200_48000[57][4] = {
+	{ 3.51605751e-02f, -1.03174029e-02f, -3.29972133e-02f, -7.60004204e-03f },
+	{ 3.29405330e-02f, -1.51577378e-02f, -3.36304009e-02f, 2.86799576e-03f },
+	{ 2.99093779e-02f, -1.96248535e-02f, -3.14937681e-02f, 1.30998399e-02f },
+	{ 2.61417553e-02f, -2.36087404e-02f, -2.67632976e-02f, 2.22527590e-02f },
+	{ 2.17304360e-02f, -2.70113014e-02f, -1.98285785e-02f, 2.95729414e-02f },
+	{ 1.67840403e-02f, -2.97487527e-02f, -1.12607758e-02f, 3.44574712e-02f },
+	{ 1.14243636e-02f, -3.17536928e-02f, -1.76553358e-03f, 3.65040675e-02f },
+	{ 5.78339072e-03f, -3.29767466e-02f, 7.87513517e-03f, 3.55441719e-02f },
+	{ 3.23202176e-09f, -3.33878063e-02f, 1.68671887e-02f, 3.16568427e-02f },
+	{ -5.78338467e-03f, -3.29767466e-02f, 2.44700629e-02f, 2.51622256e-02f },
+	{ -1.14243571e-02f, -3.17536928e-02f, 3.00575607e-02f, 1.65952500e-02f },
+	{ -1.67840328e-02f, -2.97487546e-02f, 3.31695080e-02f, 6.66146493e-03f },
+	{ -2.17304304e-02f, -2.70113051e-02f, 3.35495919e-02f, -3.82094621e-03f },
+	{ -2.61417516e-02f, -2.36087441e-02f, 3.11665200e-02f, -1.39886625e-02f },
+	{ -2.99093742e-02f, -1.96248572e-02f, 2.62165479e-02f, -2.30042785e-02f },
+	{ -3.29405256e-02f, -1.51577508e-02f, 1.91073716e-02f, -3.01252455e-02f },
+	{ -3.51605751e-02f, -1.03174010e-02f, 1.04244994e-02f, -3.47650796e-02f },
+	{ -3.65148596e-02f, -5.22300322e-03f, 8.83069413e-04f, -3.65416408e-02f },
+	{ -3.69700193e-02f, -1.45942736e-09f, -8.73109885e-03f, -3.53086144e-02f },
+	{ -3.65148596e-02f, 5.22300042e-03f, -1.76261682e-02f, -3.11675519e-02f },
+	{ -3.51605788e-02f, 1.03173992e-02f, -2.50695385e-02f, -2.44595129e-02f },
+	{ -3.29405293e-02f, 1.51577471e-02f, -3.04481648e-02f, -1.57369748e-02f },
+	{ -2.99093742e-02f, 1.96248591e-02f, -3.33190672e-02f, -5.71833039e-03f },
+	{ -2.61417516e-02f, 2.36087441e-02f, -3.34457904e-02f, 4.77127358e-03f },
+	{ -2.17304323e-02f, 2.70113032e-02f, -3.08179017e-02f, 1.48679176e-02f },
+	{ -1.67840384e-02f, 2.97487527e-02f, -2.56518330e-02f, 2.37400308e-02f },
+	{ -1.14243645e-02f, 3.17536928e-02f, -1.83730666e-02f, 3.06569021e-02f },
+	{ -5.78338560e-03f, 3.29767466e-02f, -9.58108529e-03f, 3.50488536e-02f },
+	{ 0.00000000e+00f, 3.33878063e-02f, 0.00000000e+00f, 3.65541652e-02f },
+	{ 5.78338560e-03f, 3.29767466e-02f, 9.58108529e-03f, 3.50488536e-02f },
+	{ 1.14243645e-02f, 3.17536928e-02f, 1.83730666e-02f, 3.06569021e-02f },
+	{ 1.67840384e-02f, 2.97487527e-02f, 2.56518330e-02f, 2.37400308e-02f },
+	{ 2.17304323e-02f, 2.70113032e-02f, 3.08179017e-02f, 1.48679176e-02f },
+	{ 2.61417516e-02f, 2.36087441e-02f, 3.34457904e-02f, 4.77127358e-03f },
+	{ 2.99093742e-02f, 1.96248591e-02f, 3.33190672e-02f, -5.71833039e-03f },
+	{ 3.29405293e-02f, 1.51577471e-02f, 3.04481648e-02f, -1.57369748e-02f },
+	{ 3.51605788e-02f, 1.03173992e-02f, 2.50695385e-02f, -2.44595129e-02f },
+	{ 3.65148596e-02f, 5.22300042e-03f, 1.76261682e-02f, -3.11675519e-02f },
+	{ 3.69700193e-02f, -1.45942736e-09f, 8.73109885e-03f, -3.53086144e-02f },
+	{ 3.65148596e-02f, -5.22300322e-03f, -8.83069413e-04f, -3.65416408e-02f },
+	{ 3.51605751e-02f, -1.03174010e-02f, -1.04244994e-02f, -3.47650796e-02f },
+	{ 3.29405256e-02f, -1.51577508e-02f, -1.91073716e-02f, -3.01252455e-02f },
+	{ 2.99093742e-02f, -1.96248572e-02f, -2.62165479e-02f, -2.30042785e-02f },
+	{ 2.61417516e-02f, -2.36087441e-02f, -3.11665200e-02f, -1.39886625e-02f },
+	{ 2.17304304e-02f, -2.70113051e-02f, -3.35495919e-02f, -3.82094621e-03f },
+	{ 1.67840328e-02f, -2.97487546e-02f, -3.31695080e-02f, 6.66146493e-03f },
+	{ 1.14243571e-02f, -3.17536928e-02f, -3.00575607e-02f, 1.65952500e-02f },
+	{ 5.78338467e-03f, -3.29767466e-02f, -2.44700629e-02f, 2.51622256e-02f },
+	{ -3.23202176e-09f, -3.33878063e-02f, -1.68671887e-02f, 3.16568427e-02f },
+	{ -5.78339072e-03f, -3.29767466e-02f, -7.87513517e-03f, 3.55441719e-02f },
+	{ -1.14243636e-02f, -3.17536928e-02f, 1.76553358e-03f, 3.65040675e-02f },
+	{ -1.67840403e-02f, -2.97487527e-02f, 1.12607758e-02f, 3.44574712e-02f },
+	{ -2.17304360e-02f, -2.70113014e-02f, 1.98285785e-02f, 2.95729414e-02f },
+	{ -2.61417553e-02f, -2.36087404e-02f, 2.67632976e-02f, 2.22527590e-02f },
+	{ -2.99093779e-02f, -1.96248535e-02f, 3.14937681e-02f, 1.30998399e-02f },
+	{ -3.29405330e-02f, -1.51577378e-02f, 3.36304009e-02f, 2.86799576e-03f },
+	{ -3.51605751e-02f, -1.03174029e-02f, 3.29972133e-02f, -7.60004204e-03f },
+};
+
+static void fff_B_1200_48000_calc (const float *x, float *sums)
+{
+	fff_calc (x, fff_B_1200_48000, 57, sums);
+}
+
+/* C, 1200 baud, 1200 & 2200 Hz, 48000 samples per second. */
+
+static const float fff_C_1200_48000[83][4] = {
+	{ -1.10600020e-04f, 7.16794922e-04f, 4.92327381e-04f, 5.20288304e-04f },
+	{ -3.70672631e-10f, 2.17614975e-03f, 1.85731810e-03f, 1.07538991e-03f },
+	{ 5.52207523e-04f, 3.57884541e-03f, 3.47233354e-03f, 8.36019462e-04f },
+	{ 1.52495701e-03f, 4.81764134e-03f, 4.98539442e-03f, -2.62020330e-04f },
+	{ 2.87498510e-03f, 5.79192024e-03f, 6.03886414e-03f, -2.14458560e-03f },
+	{ 4.53855842e-03f, 6.41224487e-03f, 6.31941808e-03f, -4.60444717e-03f },
+	{ 6.43407879e-03f, 6.60449360e-03f, 5.60362218e-03f, -7.32364925e-03f },
+	{ 8.46541580e-03f, 6.31338777e-03f, 3.79349547e-03f, -9.91064869e-03f },
+	{ 1.05259120e-02f, 5.50527126e-03f, 9.37653414e-04f, -1.19480658e-02f },
+	{ 1.25028426e-02f, 4.17001685e-03f, -2.76503526e-03f, -1.30456705e-02f },
+	{ 1.42821604e-02f, 2.32198532e-03f, -6.98001543e-03f, -1.28923524e-02f },
+	{ 1.57533977e-02f, 1.92832889e-10f, -1.12688290e-02f, -1.13010574e-02f },
+	{ 1.68144442e-02f, -2.73368252e-03f, -1.51349492e-02f, -8.24109558e-03f },
+	{ 1.73760839e-02f, -5.79536753e-03f, -1.80788096e-02f, -3.85375693e-03f },
+	{ 1.73660591e-02f, -9.08279791e-03f, -1.96561888e-02f, 1.55139179e-03f },
+	{ 1.67325307e-02f, -1.24788722e-02f, -1.95332952e-02f, 7.51956319e-03f },
+	{ 1.54468054e-02f, -1.58559177e-02f, -1.75323524e-02f, 1.34914983e-02f },
+	{ 1.35051478e-02f, -1.90805569e-02f, -1.36621520e-02f, 1.88580938e-02f },
+	{ 1.09296655e-02f, -2.20188070e-02f, -8.12971592e-03f, 2.30232254e-02f },
+	{ 7.76822213e-03f, -2.45413519e-02f, -1.33095146e-03f, 2.54684947e-02f },
+	{ 4.09331964e-03f, -2.65286751e-02f, 6.17942074e-03f, 2.58127283e-02f },
+	{ 2.37411246e-09f, -2.78759394e-02f, 1.37361903e-02f, 2.38598101e-02f },
+	{ -4.39707981e-03f, -2.84973662e-02f, 2.06259508e-02f, 1.96292512e-02f },
+	{ -8.96745455e-03f, -2.83299834e-02f, 2.61569917e-02f, 1.33657586e-02f },
+	{ -1.35692842e-02f, -2.73365751e-02f, 2.97300946e-02f, 5.52589679e-03f },
+	{ -1.80542488e-02f, -2.55076997e-02f, 3.09025962e-02f, -3.25727486e-03f },
+	{ -2.22728197e-02f, -2.28627268e-02f, 2.94391643e-02f, -1.22289481e-02f },
+	{ -2.60796342e-02f, -1.94498096e-02f, 2.53434833e-02f, -2.05814131e-02f },
+	{ -2.93387938e-02f, -1.53447948e-02f, 1.88672785e-02f, -2.75305361e-02f },
+	{ -3.19288969e-02f, -1.06490990e-02f, 1.04949363e-02f, -3.23924273e-02f },
+	{ -3.37475985e-02f, -5.48666250e-03f, 9.04825341e-04f, -3.46524306e-02f },
+	{ -3.47155593e-02f, -1.55765634e-09f, -9.08950064e-03f, -3.40194702e-02f },
+	{ -3.47795933e-02f, 5.65443980e-03f, -1.86127033e-02f, -3.04600038e-02f },
+	{ -3.39149088e-02f, 1.13114826e-02f, -2.68088151e-02f, -2.42077727e-02f },
+	{ -3.21263820e-02f, 1.68027580e-02f, -3.29222120e-02f, -1.57479811e-02f },
+	{ -2.94487607e-02f, 2.19624564e-02f, -3.63704897e-02f, -5.77698648e-03f },
+	{ -2.59458087e-02f, 2.66329981e-02f, -3.68019342e-02f, 4.85891430e-03f },
+	{ -2.17084344e-02f, 3.06704622e-02f, -3.41318510e-02f, 1.52399195e-02f },
+	{ -1.68518424e-02f, 3.39495763e-02f, -2.85539348e-02f, 2.44570803e-02f },
+	{ -1.15118027e-02f, 3.63680609e-02f, -2.05253046e-02f, 3.16965468e-02f },
+	{ -5.84020186e-03f, 3.78501974e-02f, -1.07264752e-02f, 3.63154896e-02f },
+	{ 0.00000000e+00f, 3.83494720e-02f, 0.00000000e+00f, 3.79023477e-02f },
+	{ 5.84020186e-03f, 3.78501974e-02f, 1.07264752e-02f, 3.63154896e-02f },
+	{ 1.15118027e-02f, 3.63680609e-02f, 2.05253046e-02f, 3.16965468e-02f },
+	{ 1.68518424e-02f, 3.39495763e-02f, 2.85539348e-02f, 2.44570803e-02f },
+	{ 2.17084344e-02f, 3.06704622e-02f, 3.41318510e-02f, 1.52399195e-02f },
+	{ 2.59458087e-02f, 2.66329981e-02f, 3.68019342e-02f, 4.85891430e-03f },
+	{ 2.94487607e-02f, 2.19624564e-02f, 3.63704897e-02f, -5.77698648e-03f },
+	{ 3.21263820e-02f, 1.68027580e-02f, 3.29222120e-02f, -1.57479811e-02f },
+	{ 3.39149088e-02f, 1.13114826e-02f, 2.68088151e-02f, -2.42077727e-02f },
+	{ 3.47795933e-02f, 5.65443980e-03f, 1.86127033e-02f, -3.04600038e-02f },
+	{ 3.47155593e-02f, -1.55765634e-09f, 9.08950064e-03f, -3.40194702e-02f },
+	{ 3.37475985e-02f, -5.48666250e-03f, -9.04825341e-04f, -3.46524306e-02f },
+	{ 3.19288969e-02f, -1.06490990e-02f, -1.04949363e-02f, -3.23924273e-02f },
+	{ 2.93387938e-02f, -1.53447948e-02f, -1.88672785e-02f, -2.75305361e-02f },
+	{ 2.60796342e-02f, -1.94498096e-02f, -2.53434833e-02f, -2.05814131e-02f },
+	{ 2.22728197e-02f, -2.28627268e-02f, -2.94391643e-02f, -1.22289481e-02f },
+	{ 1.80542488e-02f, -2.55076997e-02f, -3.09025962e-02f, -3.25727486e-03f },
+	{ 1.35692842e-02f, -2.73365751e-02f, -2.97300946e-02f, 5.52589679e-03f },
+	{ 8.96745455e-03f, -2.83299834e-02f, -2.61569917e-02f, 1.33657586e-02f },
+	{ 4.39707981e-03f, -2.84973662e-02f, -2.06259508e-02f, 1.96292512e-02f },
+	{ -2.37411246e-09f, -2.78759394e-02f, -1.37361903e-02f, 2.38598101e-02f },
+	{ -4.09331964e-03f, -2.65286751e-02f, -6.17942074e-03f, 2.58127283e-02f },
+	{ -7.76822213e-03f, -2.45413519e-02f, 1.33095146e-03f, 2.54684947e-02f },
+	{ -1.09296655e-02f, -2.20188070e-02f, 8.12971592e-03f, 2.30232254e-02f },
+	{ -1.35051478e-02f, -1.90805569e-02f, 1.36621520e-02f, 1.88580938e-02f },
+	{ -1.54468054e-02f, -1.58559177e-02f, 1.75323524e-02f, 1.34914983e-02f },
+	{ -1.67325307e-02f, -1.24788722e-02f, 1.95332952e-02f, 7.51956319e-03f },
+	{ -1.73660591e-02f, -9.08279791e-03f, 1.96561888e-02f, 1.55139179e-03f },
+	{ -1.73760839e-02f, -5.79536753e-03f, 1.80788096e-02f, -3.85375693e-03f },
+	{ -1.68144442e-02f, -2.73368252e-03f, 1.51349492e-02f, -8.24109558e-03f },
+	{ -1.57533977e-02f, 1.92832889e-10f, 1.12688290e-02f, -1.13010574e-02f },
+	{ -1.42821604e-02f, 2.32198532e-03f, 6.98001543e-03f, -1.28923524e-02f },
+	{ -1.25028426e-02f, 4.17001685e-03f, 2.76503526e-03f, -1.30456705e-02f },
+	{ -1.05259120e-02f, 5.50527126e-03f, -9.37653414e-04f, -1.19480658e-02f },
+	{ -8.46541580e-03f, 6.31338777e-03f, -3.79349547e-03f, -9.91064869e-03f },
+	{ -6.43407879e-03f, 6.60449360e-03f, -5.60362218e-03f, -7.32364925e-03f },
+	{ -4.53855842e-03f, 6.41224487e-03f, -6.31941808e-03f, -4.60444717e-03f },
+	{ -2.87498510e-03f, 5.79192024e-03f, -6.03886414e-03f, -2.14458560e-03f },
+	{ -1.52495701e-03f, 4.81764134e-03f, -4.98539442e-03f, -2.62020330e-04f },
+	{ -5.52207523e-04f, 3.57884541e-03f, -3.47233354e-03f, 8.36019462e-04f },
+	{ 3.70672631e-10f, 2.17614975e-03f, -1.85731810e-03f, 1.07538991e-03f },
+	{ 1.10600020e-04f, 7.16794922e-04f, -4.92327381e-04f, 5.20288304e-04f },
+};
+
+static void fff_C_1200_48000_calc (const float *x, float *sums)
+{
+	fff_calc (x, fff_C_1200_48000, 83, sums);
+}
+
+/* F, 1200 baud, 1200 & 2200 Hz, 48000 samples per second. */
+
+static const float fff_F_1200_48000[57][4] = {
+	{ 3.51605751e-02f, -1.03174029e-02f, -3.29972133e-02f, -7.60004204e-03f },
+	{ 3.29405330e-02f, -1.51577378e-02f, -3.36304009e-02f, 2.86799576e-03f },
+	{ 2.99093779e-02f, -1.96248535e-02f, -3.14937681e-02f, 1.30998399e-02f },
+	{ 2.61417553e-02f, -2.36087404e-02f, -2.67632976e-02f, 2.22527590e-02f },
+	{ 2.17304360e-02f, -2.70113014e-02f, -1.98285785e-02f, 2.95729414e-02f },
+	{ 1.67840403e-02f, -2.97487527e-02f, -1.12607758e-02f, 3.44574712e-02f },
+	{ 1.14243636e-02f, -3.17536928e-02f, -1.76553358e-03f, 3.65040675e-02f },
+	{ 5.78339072e-03f, -3.29767466e-02f, 7.87513517e-03f, 3.55441719e-02f },
+	{ 3.23202176e-09f, -3.33878063e-02f, 1.68671887e-02f, 3.16568427e-02f },
+	{ -5.78338467e-03f, -3.29767466e-02f, 2.44700629e-02f, 2.51622256e-02f },
+	{ -1.14243571e-02f, -3.17536928e-02f, 3.00575607e-02f, 1.65952500e-02f },
+	{ -1.67840328e-02f, -2.97487546e-02f, 3.31695080e-02f, 6.66146493e-03f },
+	{ -2.17304304e-02f, -2.70113051e-02f, 3.35495919e-02f, -3.82094621e-03f },
+	{ -2.61417516e-02f, -2.36087441e-02f, 3.11665200e-02f, -1.39886625e-02f },
+	{ -2.99093742e-02f, -1.96248572e-02f, 2.62165479e-02f, -2.30042785e-02f },
+	{ -3.29405256e-02f, -1.51577508e-02f, 1.91073716e-02f, -3.01252455e-02f },
+	{ -3.51605751e-02f, -1.03174010e-02f, 1.04244994e-02f, -3.47650796e-02f },
+	{ -3.65148596e-02f, -5.22300322e-03f, 8.83069413e-04f, -3.65416408e-02f },
+	{ -3.69700193e-02f, -1.45942736e-09f, -8.73109885e-03f, -3.53086144e-02f },
+	{ -3.65148596e-02f, 5.22300042e-03f, -1.76261682e-02f, -3.11675519e-02f },
+	{ -3.51605788e-02f, 1.03173992e-02f, -2.50695385e-02f, -2.44595129e-02f },
+	{ -3.29405293e-02f, 1.51577471e-02f, -3.04481648e-02f, -1.57369748e-02f },
+	{ -2.99093742e-02f, 1.96248591e-02f, -3.33190672e-02f, -5.71833039e-03f },
+	{ -2.61417516e-02f, 2.36087441e-02f, -3.34457904e-02f, 4.77127358e-03f },
+	{ -2.17304323e-02f, 2.70113032e-02f, -3.08179017e-02f, 1.48679176e-02f },
+	{ -1.67840384e-02f, 2.97487527e-02f, -2.56518330e-02f, 2.37400308e-02f },
+	{ -1.14243645e-02f, 3.17536928e-02f, -1.83730666e-02f, 3.06569021e-02f },
+	{ -5.78338560e-03f, 3.29767466e-02f, -9.58108529e-03f, 3.50488536e-02f },
+	{ 0.00000000e+00f, 3.33878063e-02f, 0.00000000e+00f, 3.65541652e-02f },
+	{ 5.78338560e-03f, 3.29767466e-02f, 9.58108529e-03f, 3.50488536e-02f },
+	{ 1.14243645e-02f, 3.17536928e-02f, 1.83730666e-02f, 3.06569021e-02f },
+	{ 1.67840384e-02f, 2.97487527e-02f, 2.56518330e-02f, 2.37400308e-02f },
+	{ 2.17304323e-02f, 2.70113032e-02f, 3.08179017e-02f, 1.48679176e-02f },
+	{ 2.61417516e-02f, 2.36087441e-02f, 3.34457904e-02f, 4.77127358e-03f },
+	{ 2.99093742e-02f, 1.96248591e-02f, 3.33190672e-02f, -5.71833039e-03f },
+	{ 3.29405293e-02f, 1.51577471e-02f, 3.04481648e-02f, -1.57369748e-02f },
+	{ 3.51605788e-02f, 1.03173992e-02f, 2.50695385e-02f, -2.44595129e-02f },
+	{ 3.65148596e-02f, 5.22300042e-03f, 1.76261682e-02f, -3.11675519e-02f },
+	{ 3.69700193e-02f, -1.45942736e-09f, 8.73109885e-03f, -3.53086144e-02f },
+	{ 3.65148596e-02f, -5.22300322e-03f, -8.83069413e-04f, -3.65416408e-02f },
+	{ 3.51605751e-02f, -1.03174010e-02f, -1.04244994e-02f, -3.47650796e-02f },
+	{ 3.29405256e-02f, -1.51577508e-02f, -1.91073716e-02f, -3.01252455e-02f },
+	{ 2.99093742e-02f, -1.96248572e-02f, -2.62165479e-02f, -2.30042785e-02f },
+	{ 2.61417516e-02f, -2.36087441e-02f, -3.11665200e-02f, -1.39886625e-02f },
+	{ 2.17304304e-02f, -2.70113051e-02f, -3.35495919e-02f, -3.82094621e-03f },
+	{ 1.67840328e-02f, -2.97487546e-02f, -3.31695080e-02f, 6.66146493e-03f },
+	{ 1.14243571e-02f, -3.17536928e-02f, -3.00575607e-02f, 1.65952500e-02f },
+	{ 5.78338467e-03f, -3.29767466e-02f, -2.44700629e-02f, 2.51622256e-02f },
+	{ -3.23202176e-09f, -3.33878063e-02f, -1.68671887e-02f, 3.16568427e-02f },
+	{ -5.78339072e-03f, -3.29767466e-02f, -7.87513517e-03f, 3.55441719e-02f },
+	{ -1.14243636e-02f, -3.17536928e-02f, 1.76553358e-03f, 3.65040675e-02f },
+	{ -1.67840403e-02f, -2.97487527e-02f, 1.12607758e-02f, 3.44574712e-02f },
+	{ -2.17304360e-02f, -2.70113014e-02f, 1.98285785e-02f, 2.95729414e-02f },
+	{ -2.61417553e-02f, -2.36087404e-02f, 2.67632976e-02f, 2.22527590e-02f },
+	{ -2.99093779e-02f, -1.96248535e-02f, 3.14937681e-02f, 1.30998399e-02f },
+	{ -3.29405330e-02f, -1.51577378e-02f, 3.36304009e-02f, 2.86799576e-03f },
+	{ -3.51605751e-02f, -1.03174029e-02f, 3.29972133e-02f, -7.60004204e-03f },
+};
+
+static void fff_F_1200_48000_calc (const float *x, float *sums)
+{
+	fff_calc_sparse (x, fff_F_1200_48000, 57, sums);
+}
+
+/* A, 1200 baud, 1200 & 2200 Hz, 96000 samples per second. */
+
+static const float fff_A_1200_96000[113][4] = {
+	{ 1.78870019e-02f, -5.16494084e-03f, -1.67607591e-02f, -3.80507740e-03f },
+	{ 1.73758753e-02f, -6.39620190e-03f, -1.70985162e-02f, -1.19697279e-03f },
+	{ 1.67576149e-02f, -7.58803543e-03f, -1.70823839e-02f, 1.43590604e-03f },
+	{ 1.60360392e-02f, -8.73308629e-03f, -1.67126916e-02f, 4.03906545e-03f },
+	{ 1.52155962e-02f, -9.82429460e-03f, -1.59970932e-02f, 6.55863574e-03f },
+	{ 1.43013438e-02f, -1.08549334e-02f, -1.49503984e-02f, 8.94245226e-03f },
+	{ 1.32989185e-02f, -1.18186474e-02f, -1.35942744e-02f, 1.11411847e-02f },
+	{ 1.22145014e-02f, -1.27094956e-02f, -1.19567858e-02f, 1.31093273e-02f },
+	{ 1.10547775e-02f, -1.35219852e-02f, -1.00718206e-02f, 1.48061467e-02f },
+	{ 9.82689671e-03f, -1.42511083e-02f, -7.97840115e-03f, 1.61965154e-02f },
+	{ 8.53843056e-03f, -1.48923667e-02f, -5.71985124e-03f, 1.72516610e-02f },
+	{ 7.19732139e-03f, -1.54418088e-02f, -3.34291696e-03f, 1.79497469e-02f },
+	{ 5.81183936e-03f, -1.58960484e-02f, -8.96793383e-04f, 1.82763208e-02f },
+	{ 4.39052889e-03f, -1.62522811e-02f, 1.56789925e-03f, 1.82246268e-02f },
+	{ 2.94214510e-03f, -1.65083148e-02f, 4.00013290e-03f, 1.77957341e-02f },
+	{ 1.47562241e-03f, -1.66625697e-02f, 6.34957477e-03f, 1.69985201e-02f },
+	{ 1.64420455e-09f, -1.67140942e-02f, 8.56759865e-03f, 1.58494823e-02f },
+	{ -1.47561904e-03f, -1.66625716e-02f, 1.06082968e-02f, 1.43724065e-02f },
+	{ -2.94214208e-03f, -1.65083166e-02f, 1.24294376e-02f, 1.25978542e-02f },
+	{ -4.39052563e-03f, -1.62522830e-02f, 1.39933191e-02f, 1.05625680e-02f },
+	{ -5.81183564e-03f, -1.58960503e-02f, 1.52675770e-02f, 8.30866583e-03f },
+	{ -7.19731860e-03f, -1.54418107e-02f, 1.62258409e-02f, 5.88279823e-03f },
+	{ -8.53842776e-03f, -1.48923676e-02f, 1.68482736e-02f, 3.33516439e-03f },
+	{ -9.82689485e-03f, -1.42511092e-02f, 1.71219930e-02f, 7.18510244e-04f },
+	{ -1.10547747e-02f, -1.35219870e-02f, 1.70413367e-02f, -1.91301527e-03f },
+	{ -1.22144995e-02f, -1.27094975e-02f, 1.66079700e-02f, -4.50494653e-03f },
+	{ -1.32989166e-02f, -1.18186492e-02f, 1.58308670e-02f, -7.00363843e-03f },
+	{ -1.43013410e-02f, -1.08549353e-02f, 1.47261051e-02f, -9.35738161e-03f },
+	{ -1.52155934e-02f, -9.82429739e-03f, 1.33165559e-02f, -1.15174446e-02f },
+	{ -1.60360355e-02f, -8.73309188e-03f, 1.16313919e-02f, -1.34391310e-02f },
+	{ -1.67576112e-02f, -7.58804195e-03f, 9.70548671e-03f, -1.50826657e-02f },
+	{ -1.73758715e-02f, -6.39620842e-03f, 7.57870870e-03f, -1.64140295e-02f },
+	{ -1.78870019e-02f, -5.16493991e-03f, 5.29506896e-03f, -1.74056683e-02f },
+	{ -1.82878543e-02f, -3.90182831e-03f, 2.90183979e-03f, -1.80370584e-02f },
+	{ -1.85759570e-02f, -2.61466019e-03f, 4.48550389e-04f, -1.82951316e-02f },
+	{ -1.87495295e-02f, -1.31137401e-03f, -2.01402674e-03f, -1.81745458e-02f },
+	{ -1.88075081e-02f, -7.30596250e-10f, -4.43491526e-03f, -1.76777989e-02f },
+	{ -1.87495295e-02f, 1.31137250e-03f, -6.76401705e-03f, -1.68151688e-02f },
+	{ -1.85759570e-02f, 2.61465879e-03f, -8.95311870e-03f, -1.56045118e-02f },
+	{ -1.82878543e-02f, 3.90182668e-03f, -1.09569188e-02f, -1.40708834e-02f },
+	{ -1.78870037e-02f, 5.16493898e-03f, -1.27339382e-02f, -1.22460304e-02f },
+	{ -1.73758715e-02f, 6.39620703e-03f, -1.42474007e-02f, -1.01677170e-02f },
+	{ -1.67576130e-02f, 7.58804008e-03f, -1.54659832e-02f, -7.87895732e-03f },
+	{ -1.60360374e-02f, 8.73308908e-03f, -1.63644627e-02f, -5.42712677e-03f },
+	{ -1.52155934e-02f, 9.82429832e-03f, -1.69242416e-02f, -2.86296988e-03f },
+	{ -1.43013410e-02f, 1.08549353e-02f, -1.71337370e-02f, -2.39559595e-04f },
+	{ -1.32989166e-02f, 1.18186492e-02f, -1.69886108e-02f, 2.38881120e-03f },
+	{ -1.22145005e-02f, 1.27094965e-02f, -1.64918676e-02f, 4.96774027e-03f },
+	{ -1.10547757e-02f, 1.35219861e-02f, -1.56537890e-02f, 7.44385086e-03f },
+	{ -9.82689578e-03f, 1.42511083e-02f, -1.44917192e-02f, 9.76589415e-03f },
+	{ -8.53843056e-03f, 1.48923667e-02f, -1.30297113e-02f, 1.18858106e-02f },
+	{ -7.19732232e-03f, 1.54418088e-02f, -1.12980260e-02f, 1.37597229e-02f },
+	{ -5.81183983e-03f, 1.58960484e-02f, -9.33250133e-03f, 1.53488480e-02f },
+	{ -4.39052563e-03f, 1.62522830e-02f, -7.17382040e-03f, 1.66202933e-02f },
+	{ -2.94214278e-03f, 1.65083166e-02f, -4.86666150e-03f, 1.75477471e-02f },
+	{ -1.47562008e-03f, 1.66625697e-02f, -2.45877542e-03f, 1.81120094e-02f },
+	{ 0.00000000e+00f, 1.67140942e-02f, 0.00000000e+00f, 1.83014031e-02f },
+	{ 1.47562008e-03f, 1.66625697e-02f, 2.45877542e-03f, 1.81120094e-02f },
+	{ 2.94214278e-03f, 1.65083166e-02f, 4.86666150e-03f, 1.75477471e-02f },
+	{ 4.39052563e-03f, 1.62522830e-02f, 7.17382040e-03f, 1.66202933e-02f },
+	{ 5.81183983e-03f, 1.58960484e-02f, 9.33250133e-03f, 1.53488480e-02f },
+	{ 7.19732232e-03f, 1.54418088e-02f, 1.12980260e-02f, 1.37597229e-02f },
+	{ 8.53843056e-03f, 1.48923667e-02f, 1.30297113e-02f, 1.18858106e-02f },
+	{ 9.82689578e-03f, 1.42511083e-02f, 1.44917192e-02f, 9.76589415e-03f },
+	{ 1.10547757e-02f, 1.35219861e-02f, 1.56537890e-02f, 7.44385086e-03f },
+	{ 1.22145005e-02f, 1.27094965e-02f, 1.64918676e-02f, 4.96774027e-03f },
+	{ 1.32989166e-02f, 1.18186492e-02f, 1.69886108e-02f, 2.38881120e-03f },
+	{ 1.43013410e-02f, 1.08549353e-02f, 1.71337370e-02f, -2.39559595e-04f },
+	{ 1.52155934e-02f, 9.82429832e-03f, 1.69242416e-02f, -2.86296988e-03f },
+	{ 1.60360374e-02f, 8.73308908e-03f, 1.63644627e-02f, -5.42712677e-03f },
+	{ 1.67576130e-02f, 7.58804008e-03f, 1.54659832e-02f, -7.87895732e-03f },
+	{ 1.73758715e-02f, 6.39620703e-03f, 1.42474007e-02f, -1.01677170e-02f },
+	{ 1.78870037e-02f, 5.16493898e-03f, 1.27339382e-02f, -1.22460304e-02f },
+	{ 1.82878543e-02f, 3.90182668e-03f, 1.09569188e-02f, -1.40708834e-02f },
+	{ 1.85759570e-02f, 2.61465879e-03f, 8.95311870e-03f, -1.56045118e-02f },
+	{ 1.87495295e-02f, 1.31137250e-03f, 6.76401705e-03f, -1.68151688e-02f },
+	{ 1.88075081e-02f, -7.30596250e-10f, 4.43491526e-03f, -1.76777989e-02f },
+	{ 1.87495295e-02f, -1.31137401e-03f, 2.01402674e-03f, -1.81745458e-02f },
+	{ 1.85759570e-02f, -2.61466019e-03f, -4.48550389e-04f, -1.82951316e-02f },
+	{ 1.82878543e-02f, -3.90182831e-03f, -2.90183979e-03f, -1.80370584e-02f },
+	{ 1.78870019e-02f, -5.16493991e-03f, -5.29506896e-03f, -1.74056683e-02f },
+	{ 1.73758715e-02f, -6.39620842e-03f, -7.57870870e-03f, -1.64140295e-02f },
+	{ 1.67576112e-02f, -7.58804195e-03f, -9.70548671e-03f, -1.50826657e-02f },
+	{ 1.60360355e-02f, -8.73309188e-03f, -1.16313919e-02f, -1.34391310e-02f },
+	{ 1.52155934e-02f, -9.82429739e-03f, -1.33165559e-02f, -1.15174446e-02f },
+	{ 1.43013410e-02f, -1.08549353e-02f, -1.47261051e-02f, -9.35738161e-03f },
+	{ 1.32989166e-02f, -1.18186492e-02f, -1.58308670e-02f, -7.00363843e-03f },
+	{ 1.22144995e-02f, -1.27094975e-02f, -1.66079700e-02f, -4.50494653e-03f },
+	{ 1.10547747e-02f, -1.35219870e-02f, -1.70413367e-02f, -1.91301527e-03f },
+	{ 9.82689485e-03f, -1.42511092e-02f, -1.71219930e-02f, 7.18510244e-04f },
+	{ 8.53842776e-03f, -1.48923676e-02f, -1.68482736e-02f, 3.33516439e-03f },
+	{ 7.19731860e-03f, -1.54418107e-02f, -1.62258409e-02f, 5.88279823e-03f },
+	{ 5.81183564e-03f, -1.58960503e-02f, -1.52675770e-02f, 8.30866583e-03f },
+	{ 4.39052563e-03f, -1.62522830e-02f, -1.39933191e-02f, 1.05625680e-02f },
+	{ 2.94214208e-03f, -1.65083166e-02f, -1.24294376e-02f, 1.25978542e-02f },
+	{ 1.47561904e-03f, -1.66625716e-02f, -1.06082968e-02f, 1.43724065e-02f },
+	{ -1.64420455e-09f, -1.67140942e-02f, -8.56759865e-03f, 1.58494823e-02f },
+	{ -1.47562241e-03f, -1.66625697e-02f, -6.34957477e-03f, 1.69985201e-02f },
+	{ -2.94214510e-03f, -1.65083148e-02f, -4.00013290e-03f, 1.77957341e-02f },
+	{ -4.39052889e-03f, -1.62522811e-02f, -1.56789925e-03f, 1.82246268e-02f },
+	{ -5.81183936e-03f, -1.58960484e-02f, 8.96793383e-04f, 1.82763208e-02f },
+	{ -7.19732139e-03f, -1.54418088e-02f, 3.34291696e-03f, 1.79497469e-02f },
+	{ -8.53843056e-03f, -1.48923667e-02f, 5.71985124e-03f, 1.72516610e-02f },
+	{ -9.82689671e-03f, -1.42511083e-02f, 7.97840115e-03f, 1.61965154e-02f },
+	{ -1.10547775e-02f, -1.35219852e-02f, 1.00718206e-02f, 1.48061467e-02f },
+	{ -1.22145014e-02f, -1.27094956e-02f, 1.19567858e-02f, 1.31093273e-02f },
+	{ -1.32989185e-02f, -1.18186474e-02f, 1.35942744e-02f, 1.11411847e-02f },
+	{ -1.43013438e-02f, -1.08549334e-02f, 1.49503984e-02f, 8.94245226e-03f },
+	{ -1.52155962e-02f, -9.82429460e-03f, 1.59970932e-02f, 6.55863574e-03f },
+	{ -1.60360392e-02f, -8.73308629e-03f, 1.67126916e-02f, 4.03906545e-03f },
+	{ -1.67576149e-02f, -7.58803543e-03f, 1.70823839e-02f, 1.43590604e-03f },
+	{ -1.73758753e-02f, -6.39620190e-03f, 1.70985162e-02f, -1.19697279e-03f },
+	{ -1.78870019e-02f, -5.16494084e-03f, 1.67607591e-02f, -3.80507740e-03f },
+};
+
+static void fff_A_1200_96000_calc (const float *x, float *sums)
+{
+	fff_calc (x, fff_A_1200_96000, 113, sums);
+}
+
+/* B, 1200 baud, 1200 & 2200 Hz, 96000 samples per second. */
+
+static const float fff_B_1200_96000[113][4] = {
+	{ 1.78870019e-02f, -5.16494084e-03f, -1.67607591e-02f, -3.80507740e-03f },
+	{ 1.73758753e-02f, -6.39620190e-03f, -1.70985162e-02f, -1.19697279e-03f },
+	{ 1.67576149e-02f, -7.58803543e-03f, -1.70823839e-02f, 1.43590604e-03f },
+	{ 1.60360392e-02f, -8.73308629e-03f, -1.67126916e-02f, 4.03906545e-03f },
+	{ 1.52155962e-02f, -9.82429460e-03f, -1.59970932e-02f, 6.55863574e-03f },
+	{ 1.43013438e-02f, -1.08549334e-02f, -1.49503984e-02f, 8.94245226e-03f },
+	{ 1.32989185e-02f, -1.18186474e-02f, -1.35942744e-02f, 1.11411847e-02f },
+	{ 1.22145014e-02f, -1.27094956e-02f, -1.19567858e-02f, 1.31093273e-02f },
+	{ 1.10547775e-02f, -1.35219852e-02f, -1.00718206e-02f, 1.48061467e-02f },
+	{ 9.82689671e-03f, -1.42511083e-02f, -7.97840115e-03f, 1.61965154e-02f },
+	{ 8.53843056e-03f, -1.48923667e-02f, -5.71985124e-03f, 1.72516610e-02f },
+	{ 7.19732139e-03f, -1.54418088e-02f, -3.34291696e-03f, 1.79497469e-02f },
+	{ 5.81183936e-03f, -1.58960484e-02f, -8.96793383e-04f, 1.82763208e-02f },
+	{ 4.39052889e-03f, -1.62522811e-02f, 1.56789925e-03f, 1.82246268e-02f },
+	{ 2.94214510e-03f, -1.65083148e-02f, 4.00013290e-03f, 1.77957341e-02f },
+	{ 1.47562241e-03f, -1.66625697e-02f, 6.34957477e-03f, 1.69985201e-02f },
+	{ 1.64420455e-09f, -1.67140942e-02f, 8.56759865e-03f, 1.58494823e-02f },
+	{ -1.47561904e-03f, -1.66625716e-02f, 1.06082968e-02f, 1.43724065e-02f },
+	{ -2.94214208e-03f, -1.65083166e-02f, 1.24294376e-02f, 1.25978542e-02f },
+	{ -4.39052563e-03f, -1.62522830e-02f, 1.39933191e-02f, 1.05625680e-02f },
+	{ -5.81183564e-03f, -1.58960503e-02f, 1.52675770e-02f, 8.30866583e-03f },
+	{ -7.19731860e-03f, -1.54418107e-02f, 1.62258409e-02f, 5.88279823e-03f },
+	{ -8.53842776e-03f, -1.48923676e-02f, 1.68482736e-02f, 3.33516439e-03f },
+	{ -9.82689485e-03f, -1.42511092e-02f, 1.71219930e-02f, 7.18510244e-04f },
+	{ -1.10547747e-02f, -1.35219870e-02f, 1.70413367e-02f, -1.91301527e-03f },
+	{ -1.22144995e-02f, -1.27094975e-02f, 1.66079700e-02f, -4.50494653e-03f },
+	{ -1.32989166e-02f, -1.18186492e-02f, 1.58308670e-02f, -7.00363843e-03f },
+	{ -1.43013410e-02f, -1.08549353e-02f, 1.47261051e-02f, -9.35738161e-03f },
+	{ -1.52155934e-02f, -9.82429739e-03f, 1.33165559e-02f, -1.15174446e-02f },
+	{ -1.60360355e-02f, -8.73309188e-03f, 1.16313919e-02f, -1.34391310e-02f },
+	{ -1.67576112e-02f, -7.58804195e-03f, 9.70548671e-03f, -1.50826657e-02f },
+	{ -1.73758715e-02f, -6.39620842e-03f, 7.57870870e-03f, -1.64140295e-02f },
+	{ -1.78870019e-02f, -5.16493991e-03f, 5.29506896e-03f, -1.74056683e-02f },
+	{ -1.82878543e-02f, -3.90182831e-03f, 2.90183979e-03f, -1.80370584e-02f },
+	{ -1.85759570e-02f, -2.61466019e-03f, 4.48550389e-04f, -1.82951316e-02f },
+	{ -1.87495295e-02f, -1.31137401e-03f, -2.01402674e-03f, -1.81745458e-02f },
+	{ -1.88075081e-02f, -7.30596250e-10f, -4.43491526e-03f, -1.76777989e-02f },
+	{ -1.87495295e-02f, 1.31137250e-03f, -6.76401705e-03f, -1.68151688e-02f },
+	{ -1.85759570e-02f, 2.61465879e-03f, -8.95311870e-03f, -1.56045118e-02f },
+	{ -1.82878543e-02f, 3.90182668e-03f, -1.09569188e-02f, -1.40708834e-02f },
+	{ -1.78870037e-02f, 5.16493898e-03f, -1.27339382e-02f, -1.22460304e-02f },
+	{ -1.73758715e-02f, 6.39620703e-03f, -1.42474007e-02f, -1.01677170e-02f },
+	{ -1.67576130e-02f, 7.58804008e-03f, -1.54659832e-02f, -7.87895732e-03f },
+	{ -1.60360374e-02f, 8.73308908e-03f, -1.63644627e-02f, -5.42712677e-03f },
+	{ -1.52155934e-02f, 9.82429832e-03f, -1.69242416e-02f, -2.86296988e-03f },
+	{ -1.43013410e-02f, 1.08549353e-02f, -1.71337370e-02f, -2.39559595e-04f },
+	{ -1.32989166e-02f, 1.18186492e-02f, -1.69886108e-02f, 2.38881120e-03f },
+	{ -1.22145005e-02f, 1.27094965e-02f, -1.64918676e-02f, 4.96774027e-03f },
+	{ -1.10547757e-02f, 1.35219861e-02f, -1.56537890e-02f, 7.44385086e-03f },
+	{ -9.82689578e-03f, 1.42511083e-02f, -1.44917192e-02f, 9.76589415e-03f },
+	{ -8.53843056e-03f, 1.48923667e-02f, -1.30297113e-02f, 1.18858106e-02f },
+	{ -7.19732232e-03f, 1.54418088e-02f, -1.12980260e-02f, 1.37597229e-02f },
+	{ -5.81183983e-03f, 1.58960484e-02f, -9.33250133e-03f, 1.53488480e-02f },
+	{ -4.39052563e-03f, 1.62522830e-02f, -7.17382040e-03f, 1.66202933e-02f },
+	{ -2.94214278e-03f, 1.65083166e-02f, -4.86666150e-03f, 1.75477471e-02f },
+	{ -1.47562008e-03f, 1.66625697e-02f, -2.45877542e-03f, 1.81120094e-02f },
+	{ 0.00000000e+00f, 1.67140942e-02f, 0.00000000e+00f, 1.83014031e-02f },
+	{ 1.47562008e-03f, 1.66625697e-02f, 2.45877542e-03f, 1.81120094e-02f },
+	{ 2.94214278e-03f, 1.65083166e-02f, 4.86666150e-03f, 1.75477471e-02f },
+	{ 4.39052563e-03f, 1.62522830e-02f, 7.17382040e-03f, 1.66202933e-02f },
+	{ 5.81183983e-03f, 1.58960484e-02f, 9.33250133e-03f, 1.53488480e-02f },
+	{ 7.19732232e-03f, 1.54418088e-02f, 1.12980260e-02f, 1.37597229e-02f },
+	{ 8.53843056e-03f, 1.48923667e-02f, 1.30297113e-02f, 1.18858106e-02f },
+	{ 9.82689578e-03f, 1.42511083e-02f, 1.44917192e-02f, 9.76589415e-03f },
+	{ 1.10547757e-02f, 1.35219861e-02f, 1.56537890e-02f, 7.44385086e-03f },
+	{ 1.22145005e-02f, 1.27094965e-02f, 1.64918676e-02f, 4.96774027e-03f },
+	{ 1.32989166e-02f, 1.18186492e-02f, 1.69886108e-02f, 2.38881120e-03f },
+	{ 1.43013410e-02f, 1.08549353e-02f, 1.71337370e-02f, -2.39559595e-04f },
+	{ 1.52155934e-02f, 9.82429832e-03f, 1.69242416e-02f, -2.86296988e-03f },
+	{ 1.60360374e-02f, 8.73308908e-03f, 1.63644627e-02f, -5.42712677e-03f },
+	{ 1.67576130e-02f, 7.58804008e-03f, 1.54659832e-02f, -7.87895732e-03f },
+	{ 1.73758715e-02f, 6.39620703e-03f, 1.42474007e-02f, -1.01677170e-02f },
+	{ 1.78870037e-02f, 5.16493898e-03f, 1.27339382e-02f, -1.22460304e-02f },
+	{ 1.82878543e-02f, 3.90182668e-03f, 1.09569188e-02f, -1.40708834e-02f },
+	{ 1.85759570e-02f, 2.61465879e-03f, 8.95311870e-03f, -1.56045118e-02f },
+	{ 1.87495295e-02f, 1.31137250e-03f, 6.76401705e-03f, -1.68151688e-02f },
+	{ 1.88075081e-02f, -7.30596250e-10f, 4.43491526e-03f, -1.76777989e-02f },
+	{ 1.87495295e-02f, -1.31137401e-03f, 2.01402674e-03f, -1.81745458e-02f },
+	{ 1.85759570e-02f, -2.61466019e-03f, -4.48550389e-04f, -1.82951316e-02f },
+	{ 1.82878543e-02f, -3.90182831e-03f, -2.90183979e-03f, -1.80370584e-02f },
+	{ 1.78870019e-02f, -5.16493991e-03f, -5.29506896e-03f, -1.74056683e-02f },
+	{ 1.73758715e-02f, -6.39620842e-03f, -7.57870870e-03f, -1.64140295e-02f },
+	{ 1.67576112e-02f, -7.58804195e-03f, -9.70548671e-03f, -1.50826657e-02f },
+	{ 1.60360355e-02f, -8.73309188e-03f, -1.16313919e-02f, -1.34391310e-02f },
+	{ 1.52155934e-02f, -9.82429739e-03f, -1.33165559e-02f, -1.15174446e-02f },
+	{ 1.43013410e-02f, -1.08549353e-02f, -1.47261051e-02f, -9.35738161e-03f },
+	{ 1.32989166e-02f, -1.18186492e-02f, -1.58308670e-02f, -7.00363843e-03f },
+	{ 1.22144995e-02f, -1.27094975e-02f, -1.66079700e-02f, -4.50494653e-03f },
+	{ 1.10547747e-02f, -1.35219870e-02f, -1.70413367e-02f, -1.91301527e-03f },
+	{ 9.82689485e-03f, -1.42511092e-02f, -1.71219930e-02f, 7.18510244e-04f },
+	{ 8.53842776e-03f, -1.48923676e-02f, -1.68482736e-02f, 3.33516439e-03f },
+	{ 7.19731860e-03f, -1.54418107e-02f, -1.62258409e-02f, 5.88279823e-03f },
+	{ 5.81183564e-03f, -1.58960503e-02f, -1.52675770e-02f, 8.30866583e-03f },
+	{ 4.39052563e-03f, -1.62522830e-02f, -1.39933191e-02f, 1.05625680e-02f },
+	{ 2.94214208e-03f, -1.65083166e-02f, -1.24294376e-02f, 1.25978542e-02f },
+	{ 1.47561904e-03f, -1.66625716e-02f, -1.06082968e-02f, 1.43724065e-02f },
+	{ -1.64420455e-09f, -1.67140942e-02f, -8.56759865e-03f, 1.58494823e-02f },
+	{ -1.47562241e-03f, -1.66625697e-02f, -6.34957477e-03f, 1.69985201e-02f },
+	{ -2.94214510e-03f, -1.65083148e-02f, -4.00013290e-03f, 1.77957341e-02f },
+	{ -4.39052889e-03f, -1.62522811e-02f, -1.56789925e-03f, 1.82246268e-02f },
+	{ -5.81183936e-03f, -1.58960484e-02f, 8.96793383e-04f, 1.82763208e-02f },
+	{ -7.19732139e-03f, -1.54418088e-02f, 3.34291696e-03f, 1.79497469e-02f },
+	{ -8.53843056e-03f, -1.48923667e-02f, 5.71985124e-03f, 1.72516610e-02f },
+	{ -9.82689671e-03f, -1.42511083e-02f, 7.97840115e-03f, 1.61965154e-02f },
+	{ -1.10547775e-02f, -1.35219852e-02f, 1.00718206e-02f, 1.48061467e-02f },
+	{ -1.22145014e-02f, -1.27094956e-02f, 1.19567858e-02f, 1.31093273e-02f },
+	{ -1.32989185e-02f, -1.18186474e-02f, 1.35942744e-02f, 1.11411847e-02f },
+	{ -1.43013438e-02f, -1.08549334e-02f, 1.49503984e-02f, 8.94245226e-03f },
+	{ -1.52155962e-02f, -9.82429460e-03f, 1.59970932e-02f, 6.55863574e-03f },
+	{ -1.60360392e-02f, -8.73308629e-03f, 1.67126916e-02f, 4.03906545e-03f },
+	{ -1.67576149e-02f, -7.58803543e-03f, 1.70823839e-02f, 1.43590604e-03f },
+	{ -1.73758753e-02f, -6.39620190e-03f, 1.70985162e-02f, -1.19697279e-03f },
+	{ -1.78870019e-02f, -5.16494084e-03f, 1.67607591e-02f, -3.80507740e-03f },
+};
+
+static void fff_B_1200_96000_calc (const float *x, float *sums)
+{
+	fff_calc (x, fff_B_1200_96000, 113, sums);
+}
+
+/* C, 1200 baud, 1200 & 2200 Hz, 96000 samples per second. */
+
+static const float fff_C_1200_96000[165][4] = {
+	{ -2.79695287e-05f, 1.81520940e-04f, 1.24660786e-04f, 1.31589593e-04f },
+	{ -4.20789875e-05f, 5.49584802e-04f, 4.26610321e-04f, 3.36887431e-04f },
+	{ -1.56249708e-10f, 9.18585050e-04f, 7.83900381e-04f, 4.53358924e-04f },
+	{ 9.81246922e-05f, 1.28159183e-03f, 1.17659802e-03f, 4.70217929e-04f },
+	{ 2.51421414e-04f, 1.63171685e-03f, 1.58295035e-03f, 3.80683370e-04f },
+	{ 4.58292518e-04f, 1.96220283e-03f, 1.98014802e-03f, 1.82260745e-04f },
+	{ 7.16432696e-04f, 2.26649176e-03f, 2.34511006e-03f, -1.23111997e-04f },
+	{ 1.02285203e-03f, 2.53830175e-03f, 2.65529542e-03f, -5.29073237e-04f },
+	{ 1.37390709e-03f, 2.77169957e-03f, 2.88950116e-03f, -1.02497358e-03f },
+	{ 1.76533475e-03f, 2.96116387e-03f, 3.02862097e-03f, -1.59615593e-03f },
+	{ 2.19230005e-03f, 3.10165854e-03f, 3.05636344e-03f, -2.22437037e-03f },
+	{ 2.64944742e-03f, 3.18868342e-03f, 2.95987329e-03f, -2.88830441e-03f },
+	{ 3.13094934e-03f, 3.21833394e-03f, 2.73026270e-03f, -3.56422225e-03f },
+	{ 3.63057526e-03f, 3.18734697e-03f, 2.36302707e-03f, -4.22669062e-03f },
+	{ 4.14174702e-03f, 3.09314043e-03f, 1.85832113e-03f, -4.84936591e-03f },
+	{ 4.65761824e-03f, 2.93385191e-03f, 1.22112781e-03f, -5.40582975e-03f },
+	{ 5.17114019e-03f, 2.70836451e-03f, 4.61227086e-04f, -5.87045448e-03f },
+	{ 5.67513797e-03f, 2.41632690e-03f, -4.06934356e-04f, -6.21924130e-03f },
+	{ 6.16238778e-03f, 2.05816422e-03f, -1.36454182e-03f, -6.43064128e-03f },
+	{ 6.62569096e-03f, 1.63508300e-03f, -2.38884473e-03f, -6.48631854e-03f },
+	{ 7.05795549e-03f, 1.14906963e-03f, -3.45372129e-03f, -6.37183804e-03f },
+	{ 7.45227141e-03f, 6.02875720e-04f, -4.53035068e-03f, -6.07724814e-03f },
+	{ 7.80198816e-03f, 9.56343824e-11f, -5.58799179e-03f, -5.59754670e-03f },
+	{ 8.10078438e-03f, -6.55339041e-04f, -6.59483299e-03f, -4.93300753e-03f },
+	{ 8.34273826e-03f, -1.35823851e-03f, -7.51887681e-03f, -4.08939132e-03f },
+	{ 8.52240250e-03f, -2.10315199e-03f, -8.32890067e-03f, -3.07794358e-03f },
+	{ 8.63485783e-03f, -2.88393931e-03f, -8.99536908e-03f, -1.91529258e-03f },
+	{ 8.67578015e-03f, -3.69391707e-03f, -9.49134957e-03f, -6.23160740e-04f },
+	{ 8.64148140e-03f, -4.52593667e-03f, -9.79336910e-03f, 7.72068743e-04f },
+	{ 8.52896739e-03f, -5.37242321e-03f, -9.88219585e-03f, 2.23992905e-03f },
+	{ 8.33597500e-03f, -6.22546719e-03f, -9.74352565e-03f, 3.74657917e-03f },
+	{ 8.06100108e-03f, -7.07689021e-03f, -9.36855469e-03f, 5.25560556e-03f },
+	{ 7.70333549e-03f, -7.91832618e-03f, -8.75439588e-03f, 6.72895834e-03f },
+	{ 7.26307323e-03f, -8.74130242e-03f, -7.90436193e-03f, 8.12791381e-03f },
+	{ 6.74113072e-03f, -9.53731965e-03f, -6.82807714e-03f, 9.41409916e-03f },
+	{ 6.13924302e-03f, -1.02979355e-02f, -5.54143079e-03f, 1.05505232e-02f },
+	{ 5.45996288e-03f, -1.10148471e-02f, -4.06634342e-03f, 1.15026133e-02f },
+	{ 4.70664818e-03f, -1.16799809e-02f, -2.43037962e-03f, 1.22392038e-02f },
+	{ 3.88343749e-03f, -1.22855622e-02f, -6.66197215e-04f, 1.27334334e-02f },
+	{ 2.99522746e-03f, -1.28242048e-02f, 1.18915597e-03f, 1.29636005e-02f },
+	{ 2.04762234e-03f, -1.32889794e-02f, 3.09505127e-03f, 1.29138464e-02f },
+	{ 1.04691053e-03f, -1.36734908e-02f, 5.00825746e-03f, 1.25747509e-02f },
+	{ 1.18830168e-09f, -1.39719443e-02f, 6.88394904e-03f, 1.19437296e-02f },
+	{ -1.08562794e-03f, -1.41792065e-02f, 8.67681112e-03f, 1.10252965e-02f },
+	{ -2.20199442e-03f, -1.42908646e-02f, 1.03421714e-02f, 9.83112399e-03f },
+	{ -3.34067759e-03f, -1.43032772e-02f, 1.18371323e-02f, 8.37995298e-03f },
+	{ -4.49288823e-03f, -1.42136179e-02f, 1.31216999e-02f, 6.69726683e-03f },
+	{ -5.64955780e-03f, -1.40199056e-02f, 1.41598489e-02f, 4.81483852e-03f },
+	{ -6.80139894e-03f, -1.37210470e-02f, 1.49205029e-02f, 2.77007557e-03f },
+	{ -7.93899968e-03f, -1.33168446e-02f, 1.53784137e-02f, 6.05252339e-04f },
+	{ -9.05290525e-03f, -1.28080118e-02f, 1.55149158e-02f, -1.63346750e-03f },
+	{ -1.01337032e-02f, -1.21961860e-02f, 1.53185185e-02f, -3.89705156e-03f },
+	{ -1.11721056e-02f, -1.14839096e-02f, 1.47853345e-02f, -6.13474427e-03f },
+	{ -1.21590421e-02f, -1.06746331e-02f, 1.39193246e-02f, -8.29527713e-03f },
+	{ -1.30857332e-02f, -9.77268163e-03f, 1.27323549e-02f, -1.03280721e-02f },
+	{ -1.39437756e-02f, -8.78323615e-03f, 1.12440502e-02f, -1.21845240e-02f },
+	{ -1.47252316e-02f, -7.71228131e-03f, 9.48145613e-03f, -1.38191739e-02f },
+	{ -1.54226786e-02f, -6.56657573e-03f, 7.47852866e-03f, -1.51908621e-02f },
+	{ -1.60293058e-02f, -5.35359560e-03f, 5.27541339e-03f, -1.62637960e-02f },
+	{ -1.65389664e-02f, -4.08147275e-03f, 2.91760615e-03f, -1.70084722e-02f },
+	{ -1.69462357e-02f, -2.75892811e-03f, 4.54926194e-04f, -1.74024962e-02f },
+	{ -1.72464699e-02f, -1.39520981e-03f, -2.05959915e-03f, -1.74312051e-02f },
+	{ -1.74358543e-02f, -7.83416221e-10f, -4.57093446e-03f, -1.70881152e-02f },
+	{ -1.75114404e-02f, 1.41664397e-03f, -7.02334289e-03f, -1.63752045e-02f },
+	{ -1.74711775e-02f, 2.84439023e-03f, -9.36166383e-03f, -1.53029505e-02f },
+	{ -1.73139367e-02f, 4.27271752e-03f, -1.15326513e-02f, -1.38901966e-02f },
+	{ -1.70395244e-02f, 5.69099467e-03f, -1.34862214e-02f, -1.21637983e-02f },
+	{ -1.66486967e-02f, 7.08858110e-03f, -1.51766874e-02f, -1.01580685e-02f },
+	{ -1.61431618e-02f, 8.45491420e-03f, -1.65638644e-02f, -7.91405793e-03f },
+	{ -1.55255543e-02f, 9.77959950e-03f, -1.76140610e-02f, -5.47865592e-03f },
+	{ -1.47994310e-02f, 1.10525070e-02f, -1.83009263e-02f, -2.90353387e-03f },
+	{ -1.39692482e-02f, 1.22638457e-02f, -1.86061300e-02f, -2.43985400e-04f },
+	{ -1.30403144e-02f, 1.34042585e-02f, -1.85198467e-02f, 2.44234852e-03f },
+	{ -1.20187625e-02f, 1.44649055e-02f, -1.80410426e-02f, 5.09679271e-03f },
+	{ -1.09114917e-02f, 1.54375294e-02f, -1.71775557e-02f, 7.66100688e-03f },
+	{ -9.72611550e-03f, 1.63145419e-02f, -1.59459617e-02f, 1.00783426e-02f },
+	{ -8.47090501e-03f, 1.70890782e-02f, -1.43712414e-02f, 1.22951707e-02f },
+	{ -7.15470640e-03f, 1.77550614e-02f, -1.24862250e-02f, 1.42621342e-02f },
+	{ -5.78688364e-03f, 1.83072630e-02f, -1.03308707e-02f, 1.59353241e-02f },
+	{ -4.37723147e-03f, 1.87413339e-02f, -7.95135554e-03f, 1.72772929e-02f },
+	{ -2.93589570e-03f, 1.90538540e-02f, -5.39902970e-03f, 1.82579607e-02f },
+	{ -1.47328817e-03f, 1.92423556e-02f, -2.72922753e-03f, 1.88553128e-02f },
+	{ 0.00000000e+00f, 1.93053577e-02f, 0.00000000e+00f, 1.90559346e-02f },
+	{ 1.47328817e-03f, 1.92423556e-02f, 2.72922753e-03f, 1.88553128e-02f },
+	{ 2.93589570e-03f, 1.90538540e-02f, 5.39902970e-03f, 1.82579607e-02f },
+	{ 4.37723147e-03f, 1.87413339e-02f, 7.95135554e-03f, 1.72772929e-02f },
+	{ 5.78688364e-03f, 1.83072630e-02f, 1.03308707e-02f, 1.59353241e-02f },
+	{ 7.15470640e-03f, 1.77550614e-02f, 1.24862250e-02f, 1.42621342e-02f },
+	{ 8.47090501e-03f, 1.70890782e-02f, 1.43712414e-02f, 1.22951707e-02f },
+	{ 9.72611550e-03f, 1.63145419e-02f, 1.59459617e-02f, 1.00783426e-02f },
+	{ 1.09114917e-02f, 1.54375294e-02f, 1.71775557e-02f, 7.66100688e-03f },
+	{ 1.20187625e-02f, 1.44649055e-02f, 1.80410426e-02f, 5.09679271e-03f },
+	{ 1.30403144e-02f, 1.34042585e-02f, 1.85198467e-02f, 2.44234852e-03f },
+	{ 1.39692482e-02f, 1.22638457e-02f, 1.86061300e-02f, -2.43985400e-04f },
+	{ 1.47994310e-02f, 1.10525070e-02f, 1.83009263e-02f, -2.90353387e-03f },
+	{ 1.55255543e-02f, 9.77959950e-03f, 1.76140610e-02f, -5.47865592e-03f },
+	{ 1.61431618e-02f, 8.45491420e-03f, 1.65638644e-02f, -7.91405793e-03f },
+	{ 1.66486967e-02f, 7.08858110e-03f, 1.51766874e-02f, -1.01580685e-02f },
+	{ 1.70395244e-02f, 5.69099467e-03f, 1.34862214e-02f, -1.21637983e-02f },
+	{ 1.73139367e-02f, 4.27271752e-03f, 1.15326513e-02f, -1.38901966e-02f },
+	{ 1.74711775e-02f, 2.84439023e-03f, 9.36166383e-03f, -1.53029505e-02f },
+	{ 1.75114404e-02f, 1.41664397e-03f, 7.02334289e-03f, -1.63752045e-02f },
+	{ 1.74358543e-02f, -7.83416221e-10f, 4.57093446e-03f, -1.70881152e-02f },
+	{ 1.72464699e-02f, -1.39520981e-03f, 2.05959915e-03f, -1.74312051e-02f },
+	{ 1.69462357e-02f, -2.75892811e-03f, -4.54926194e-04f, -1.74024962e-02f },
+	{ 1.65389664e-02f, -4.08147275e-03f, -2.91760615e-03f, -1.70084722e-02f },
+	{ 1.60293058e-02f, -5.35359560e-03f, -5.27541339e-03f, -1.62637960e-02f },
+	{ 1.54226786e-02f, -6.56657573e-03f, -7.47852866e-03f, -1.51908621e-02f },
+	{ 1.47252316e-02f, -7.71228131e-03f, -9.48145613e-03f, -1.38191739e-02f },
+	{ 1.39437756e-02f, -8.78323615e-03f, -1.12440502e-02f, -1.21845240e-02f },
+	{ 1.30857332e-02f, -9.77268163e-03f, -1.27323549e-02f, -1.03280721e-02f },
+	{ 1.21590421e-02f, -1.06746331e-02f, -1.39193246e-02f, -8.29527713e-03f },
+	{ 1.11721056e-02f, -1.14839096e-02f, -1.47853345e-02f, -6.13474427e-03f },
+	{ 1.01337032e-02f, -1.21961860e-02f, -1.53185185e-02f, -3.89705156e-03f },
+	{ 9.05290525e-03f, -1.28080118e-02f, -1.55149158e-02f, -1.63346750e-03f },
+	{ 7.93899968e-03f, -1.33168446e-02f, -1.53784137e-02f, 6.05252339e-04f },
+	{ 6.80139894e-03f, -1.37210470e-02f, -1.49205029e-02f, 2.77007557e-03f },
+	{ 5.64955780e-03f, -1.40199056e-02f, -1.41598489e-02f, 4.81483852e-03f },
+	{ 4.49288823e-03f, -1.42136179e-02f, -1.31216999e-02f, 6.69726683e-03f },
+	{ 3.34067759e-03f, -1.43032772e-02f, -1.18371323e-02f, 8.37995298e-03f },
+	{ 2.20199442e-03f, -1.42908646e-02f, -1.03421714e-02f, 9.83112399e-03f },
+	{ 1.08562794e-03f, -1.41792065e-02f, -8.67681112e-03f, 1.10252965e-02f },
+	{ -1.18830168e-09f, -1.39719443e-02f, -6.88394904e-03f, 1.19437296e-02f },
+	{ -1.04691053e-03f, -1.36734908e-02f, -5.00825746e-03f, 1.25747509e-02f },
+	{ -2.04762234e-03f, -1.32889794e-02f, -3.09505127e-03f, 1.29138464e-02f },
+	{ -2.99522746e-03f, -1.28242048e-02f, -1.18915597e-03f, 1.29636005e-02f },
+	{ -3.88343749e-03f, -1.22855622e-02f, 6.66197215e-04f, 1.27334334e-02f },
+	{ -4.70664818e-03f, -1.16799809e-02f, 2.43037962e-03f, 1.22392038e-02f },
+	{ -5.45996288e-03f, -1.10148471e-02f, 4.06634342e-03f, 1.15026133e-02f },
+	{ -6.13924302e-03f, -1.02979355e-02f, 5.54143079e-03f, 1.05505232e-02f },
+	{ -6.74113072e-03f, -9.53731965e-03f, 6.82807714e-03f, 9.41409916e-03f },
+	{ -7.26307323e-03f, -8.74130242e-03f, 7.90436193e-03f, 8.12791381e-03f },
+	{ -7.70333549e-03f, -7.91832618e-03f, 8.75439588e-03f, 6.72895834e-03f },
+	{ -8.06100108e-03f, -7.07689021e-03f, 9.36855469e-03f, 5.25560556e-03f },
+	{ -8.33597500e-03f, -6.22546719e-03f, 9.74352565e-03f, 3.74657917e-03f },
+	{ -8.52896739e-03f, -5.37242321e-03f, 9.88219585e-03f, 2.23992905e-03f },
+	{ -8.64148140e-03f, -4.52593667e-03f, 9.79336910e-03f, 7.72068743e-04f },
+	{ -8.67578015e-03f, -3.69391707e-03f, 9.49134957e-03f, -6.23160740e-04f },
+	{ -8.63485783e-03f, -2.88393931e-03f, 8.99536908e-03f, -1.91529258e-03f },
+	{ -8.52240250e-03f, -2.10315199e-03f, 8.32890067e-03f, -3.07794358e-03f },
+	{ -8.34273826e-03f, -1.35823851e-03f, 7.51887681e-03f, -4.08939132e-03f },
+	{ -8.10078438e-03f, -6.55339041e-04f, 6.59483299e-03f, -4.93300753e-03f },
+	{ -7.80198816e-03f, 9.56343824e-11f, 5.58799179e-03f, -5.59754670e-03f },
+	{ -7.45227141e-03f, 6.02875720e-04f, 4.53035068e-03f, -6.07724814e-03f },
+	{ -7.05795549e-03f, 1.14906963e-03f, 3.45372129e-03f, -6.37183804e-03f },
+	{ -6.62569096e-03f, 1.63508300e-03f, 2.38884473e-03f, -6.48631854e-03f },
+	{ -6.16238778e-03f, 2.05816422e-03f, 1.36454182e-03f, -6.43064128e-03f },
+	{ -5.67513797e-03f, 2.41632690e-03f, 4.06934356e-04f, -6.21924130e-03f },
+	{ -5.17114019e-03f, 2.70836451e-03f, -4.61227086e-04f, -5.87045448e-03f },
+	{ -4.65761824e-03f, 2.93385191e-03f, -1.22112781e-03f, -5.40582975e-03f },
+	{ -4.14174702e-03f, 3.09314043e-03f, -1.85832113e-03f, -4.84936591e-03f },
+	{ -3.63057526e-03f, 3.18734697e-03f, -2.36302707e-03f, -4.22669062e-03f },
+	{ -3.13094934e-03f, 3.21833394e-03f, -2.73026270e-03f, -3.56422225e-03f },
+	{ -2.64944742e-03f, 3.18868342e-03f, -2.95987329e-03f, -2.88830441e-03f },
+	{ -2.19230005e-03f, 3.10165854e-03f, -3.05636344e-03f, -2.22437037e-03f },
+	{ -1.76533475e-03f, 2.96116387e-03f, -3.02862097e-03f, -1.59615593e-03f },
+	{ -1.37390709e-03f, 2.77169957e-03f, -2.88950116e-03f, -1.02497358e-03f },
+	{ -1.02285203e-03f, 2.53830175e-03f, -2.65529542e-03f, -5.29073237e-04f },
+	{ -7.16432696e-04f, 2.26649176e-03f, -2.34511006e-03f, -1.23111997e-04f },
+	{ -4.58292518e-04f, 1.96220283e-03f, -1.98014802e-03f, 1.82260745e-04f },
+	{ -2.51421414e-04f, 1.63171685e-03f, -1.58295035e-03f, 3.80683370e-04f },
+	{ -9.81246922e-05f, 1.28159183e-03f, -1.17659802e-03f, 4.70217929e-04f },
+	{ 1.56249708e-10f, 9.18585050e-04f, -7.83900381e-04f, 4.53358924e-04f },
+	{ 4.20789875e-05f, 5.49584802e-04f, -4.26610321e-04f, 3.36887431e-04f },
+	{ 2.79695287e-05f, 1.81520940e-04f, -1.24660786e-04f, 1.31589593e-04f },
+};
+
+static void fff_C_1200_96000_calc (const float *x, float *sums)
+{
+	fff_calc (x, fff_C_1200_96000, 165, sums);
+}
+
+/* F, 1200 baud, 1200 & 2200 Hz, 96000 samples per second. */
+
+static const float fff_F_1200_96000[113][4] = {
+	{ 1.78870019e-02f, -5.16494084e-03f, -1.67607591e-02f, -3.80507740e-03f },
+	{ 1.73758753e-02f, -6.39620190e-03f, -1.70985162e-02f, -1.19697279e-03f },
+	{ 1.67576149e-02f, -7.58803543e-03f, -1.70823839e-02f, 1.43590604e-03f },
+	{ 1.60360392e-02f, -8.73308629e-03f, -1.67126916e-02f, 4.03906545e-03f },
+	{ 1.52155962e-02f, -9.82429460e-03f, -1.59970932e-02f, 6.55863574e-03f },
+	{ 1.43013438e-02f, -1.08549334e-02f, -1.49503984e-02f, 8.94245226e-03f },
+	{ 1.32989185e-02f, -1.18186474e-02f, -1.35942744e-02f, 1.11411847e-02f },
+	{ 1.22145014e-02f, -1.27094956e-02f, -1.19567858e-02f, 1.31093273e-02f },
+	{ 1.10547775e-02f, -1.35219852e-02f, -1.00718206e-02f, 1.48061467e-02f },
+	{ 9.82689671e-03f, -1.42511083e-02f, -7.97840115e-03f, 1.61965154e-02f },
+	{ 8.53843056e-03f, -1.48923667e-02f, -5.71985124e-03f, 1.72516610e-02f },
+	{ 7.19732139e-03f, -1.54418088e-02f, -3.34291696e-03f, 1.79497469e-02f },
+	{ 5.81183936e-03f, -1.58960484e-02f, -8.96793383e-04f, 1.82763208e-02f },
+	{ 4.39052889e-03f, -1.62522811e-02f, 1.56789925e-03f, 1.82246268e-02f },
+	{ 2.94214510e-03f, -1.65083148e-02f, 4.00013290e-03f, 1.77957341e-02f },
+	{ 1.47562241e-03f, -1.66625697e-02f, 6.34957477e-03f, 1.69985201e-02f },
+	{ 1.64420455e-09f, -1.67140942e-02f, 8.56759865e-03f, 1.58494823e-02f },
+	{ -1.47561904e-03f, -1.66625716e-02f, 1.06082968e-02f, 1.43724065e-02f },
+	{ -2.94214208e-03f, -1.65083166e-02f, 1.24294376e-02f, 1.25978542e-02f },
+	{ -4.39052563e-03f, -1.62522830e-02f, 1.39933191e-02f, 1.05625680e-02f },
+	{ -5.81183564e-03f, -1.58960503e-02f, 1.52675770e-02f, 8.30866583e-03f },
+	{ -7.19731860e-03f, -1.54418107e-02f, 1.62258409e-02f, 5.88279823e-03f },
+	{ -8.53842776e-03f, -1.48923676e-02f, 1.68482736e-02f, 3.33516439e-03f },
+	{ -9.82689485e-03f, -1.42511092e-02f, 1.71219930e-02f, 7.18510244e-04f },
+	{ -1.10547747e-02f, -1.35219870e-02f, 1.70413367e-02f, -1.91301527e-03f },
+	{ -1.22144995e-02f, -1.27094975e-02f, 1.66079700e-02f, -4.50494653e-03f },
+	{ -1.32989166e-02f, -1.18186492e-02f, 1.58308670e-02f, -7.00363843e-03f },
+	{ -1.43013410e-02f, -1.08549353e-02f, 1.47261051e-02f, -9.35738161e-03f },
+	{ -1.52155934e-02f, -9.82429739e-03f, 1.33165559e-02f, -1.15174446e-02f },
+	{ -1.60360355e-02f, -8.73309188e-03f, 1.16313919e-02f, -1.34391310e-02f },
+	{ -1.67576112e-02f, -7.58804195e-03f, 9.70548671e-03f, -1.50826657e-02f },
+	{ -1.73758715e-02f, -6.39620842e-03f, 7.57870870e-03f, -1.64140295e-02f },
+	{ -1.78870019e-02f, -5.16493991e-03f, 5.29506896e-03f, -1.74056683e-02f },
+	{ -1.82878543e-02f, -3.90182831e-03f, 2.90183979e-03f, -1.80370584e-02f },
+	{ -1.85759570e-02f, -2.61466019e-03f, 4.48550389e-04f, -1.82951316e-02f },
+	{ -1.87495295e-02f, -1.31137401e-03f, -2.01402674e-03f, -1.81745458e-02f },
+	{ -1.88075081e-02f, -7.30596250e-10f, -4.43491526e-03f, -1.76777989e-02f },
+	{ -1.87495295e-02f, 1.31137250e-03f, -6.76401705e-03f, -1.68151688e-02f },
+	{ -1.85759570e-02f, 2.61465879e-03f, -8.95311870e-03f, -1.56045118e-02f },
+	{ -1.82878543e-02f, 3.90182668e-03f, -1.09569188e-02f, -1.40708834e-02f },
+	{ -1.78870037e-02f, 5.16493898e-03f, -1.27339382e-02f, -1.22460304e-02f },
+	{ -1.73758715e-02f, 6.39620703e-03f, -1.42474007e-02f, -1.01677170e-02f },
+	{ -1.67576130e-02f, 7.58804008e-03f, -1.54659832e-02f, -7.87895732e-03f },
+	{ -1.60360374e-02f, 8.73308908e-03f, -1.63644627e-02f, -5.42712677e-03f },
+	{ -1.52155934e-02f, 9.82429832e-03f, -1.69242416e-02f, -2.86296988e-03f },
+	{ -1.43013410e-02f, 1.08549353e-02f, -1.71337370e-02f, -2.39559595e-04f },
+	{ -1.32989166e-02f, 1.18186492e-02f, -1.69886108e-02f, 2.38881120e-03f },
+	{ -1.22145005e-02f, 1.27094965e-02f, -1.64918676e-02f, 4.96774027e-03f },
+	{ -1.10547757e-02f, 1.35219861e-02f, -1.56537890e-02f, 7.44385086e-03f },
+	{ -9.82689578e-03f, 1.42511083e-02f, -1.44917192e-02f, 9.76589415e-03f },
+	{ -8.53843056e-03f, 1.48923667e-02f, -1.30297113e-02f, 1.18858106e-02f },
+	{ -7.19732232e-03f, 1.54418088e-02f, -1.12980260e-02f, 1.37597229e-02f },
+	{ -5.81183983e-03f, 1.58960484e-02f, -9.33250133e-03f, 1.53488480e-02f },
+	{ -4.39052563e-03f, 1.62522830e-02f, -7.17382040e-03f, 1.66202933e-02f },
+	{ -2.94214278e-03f, 1.65083166e-02f, -4.86666150e-03f, 1.75477471e-02f },
+	{ -1.47562008e-03f, 1.66625697e-02f, -2.45877542e-03f, 1.81120094e-02f },
+	{ 0.00000000e+00f, 1.67140942e-02f, 0.00000000e+00f, 1.83014031e-02f },
+	{ 1.47562008e-03f, 1.66625697e-02f, 2.45877542e-03f, 1.81120094e-02f },
+	{ 2.94214278e-03f, 1.65083166e-02f, 4.86666150e-03f, 1.75477471e-02f },
+	{ 4.39052563e-03f, 1.62522830e-02f, 7.17382040e-03f, 1.66202933e-02f },
+	{ 5.81183983e-03f, 1.58960484e-02f, 9.33250133e-03f, 1.53488480e-02f },
+	{ 7.19732232e-03f, 1.54418088e-02f, 1.12980260e-02f, 1.37597229e-02f },
+	{ 8.53843056e-03f, 1.48923667e-02f, 1.30297113e-02f, 1.18858106e-02f },
+	{ 9.82689578e-03f, 1.42511083e-02f, 1.44917192e-02f, 9.76589415e-03f },
+	{ 1.10547757e-02f, 1.35219861e-02f, 1.56537890e-02f, 7.44385086e-03f },
+	{ 1.22145005e-02f, 1.27094965e-02f, 1.64918676e-02f, 4.96774027e-03f },
+	{ 1.32989166e-02f, 1.18186492e-02f, 1.69886108e-02f, 2.38881120e-03f },
+	{ 1.43013410e-02f, 1.08549353e-02f, 1.71337370e-02f, -2.39559595e-04f },
+	{ 1.52155934e-02f, 9.82429832e-03f, 1.69242416e-02f, -2.86296988e-03f },
+	{ 1.60360374e-02f, 8.73308908e-03f, 1.63644627e-02f, -5.42712677e-03f },
+	{ 1.67576130e-02f, 7.58804008e-03f, 1.54659832e-02f, -7.87895732e-03f },
+	{ 1.73758715e-02f, 6.39620703e-03f, 1.42474007e-02f, -1.01677170e-02f },
+	{ 1.78870037e-02f, 5.16493898e-03f, 1.27339382e-02f, -1.22460304e-02f },
+	{ 1.82878543e-02f, 3.90182668e-03f, 1.09569188e-02f, -1.40708834e-02f },
+	{ 1.85759570e-02f, 2.61465879e-03f, 8.95311870e-03f, -1.56045118e-02f },
+	{ 1.87495295e-02f, 1.31137250e-03f, 6.76401705e-03f, -1.68151688e-02f },
+	{ 1.88075081e-02f, -7.30596250e-10f, 4.43491526e-03f, -1.76777989e-02f },
+	{ 1.87495295e-02f, -1.31137401e-03f, 2.01402674e-03f, -1.81745458e-02f },
+	{ 1.85759570e-02f, -2.61466019e-03f, -4.48550389e-04f, -1.82951316e-02f },
+	{ 1.82878543e-02f, -3.90182831e-03f, -2.90183979e-03f, -1.80370584e-02f },
+	{ 1.78870019e-02f, -5.16493991e-03f, -5.29506896e-03f, -1.74056683e-02f },
+	{ 1.73758715e-02f, -6.39620842e-03f, -7.57870870e-03f, -1.64140295e-02f },
+	{ 1.67576112e-02f, -7.58804195e-03f, -9.70548671e-03f, -1.50826657e-02f },
+	{ 1.60360355e-02f, -8.73309188e-03f, -1.16313919e-02f, -1.34391310e-02f },
+	{ 1.52155934e-02f, -9.82429739e-03f, -1.33165559e-02f, -1.15174446e-02f },
+	{ 1.43013410e-02f, -1.08549353e-02f, -1.47261051e-02f, -9.35738161e-03f },
+	{ 1.32989166e-02f, -1.18186492e-02f, -1.58308670e-02f, -7.00363843e-03f },
+	{ 1.22144995e-02f, -1.27094975e-02f, -1.66079700e-02f, -4.50494653e-03f },
+	{ 1.10547747e-02f, -1.35219870e-02f, -1.70413367e-02f, -1.91301527e-03f },
+	{ 9.82689485e-03f, -1.42511092e-02f, -1.71219930e-02f, 7.18510244e-04f },
+	{ 8.53842776e-03f, -1.48923676e-02f, -1.68482736e-02f, 3.33516439e-03f },
+	{ 7.19731860e-03f, -1.54418107e-02f, -1.62258409e-02f, 5.88279823e-03f },
+	{ 5.81183564e-03f, -1.58960503e-02f, -1.52675770e-02f, 8.30866583e-03f },
+	{ 4.39052563e-03f, -1.62522830e-02f, -1.39933191e-02f, 1.05625680e-02f },
+	{ 2.94214208e-03f, -1.65083166e-02f, -1.24294376e-02f, 1.25978542e-02f },
+	{ 1.47561904e-03f, -1.66625716e-02f, -1.06082968e-02f, 1.43724065e-02f },
+	{ -1.64420455e-09f, -1.67140942e-02f, -8.56759865e-03f, 1.58494823e-02f },
+	{ -1.47562241e-03f, -1.66625697e-02f, -6.34957477e-03f, 1.69985201e-02f },
+	{ -2.94214510e-03f, -1.65083148e-02f, -4.00013290e-03f, 1.77957341e-02f },
+	{ -4.39052889e-03f, -1.62522811e-02f, -1.56789925e-03f, 1.82246268e-02f },
+	{ -5.81183936e-03f, -1.58960484e-02f, 8.96793383e-04f, 1.82763208e-02f },
+	{ -7.19732139e-03f, -1.54418088e-02f, 3.34291696e-03f, 1.79497469e-02f },
+	{ -8.53843056e-03f, -1.48923667e-02f, 5.71985124e-03f, 1.72516610e-02f },
+	{ -9.82689671e-03f, -1.42511083e-02f, 7.97840115e-03f, 1.61965154e-02f },
+	{ -1.10547775e-02f, -1.35219852e-02f, 1.00718206e-02f, 1.48061467e-02f },
+	{ -1.22145014e-02f, -1.27094956e-02f, 1.19567858e-02f, 1.31093273e-02f },
+	{ -1.32989185e-02f, -1.18186474e-02f, 1.35942744e-02f, 1.11411847e-02f },
+	{ -1.43013438e-02f, -1.08549334e-02f, 1.49503984e-02f, 8.94245226e-03f },
+	{ -1.52155962e-02f, -9.82429460e-03f, 1.59970932e-02f, 6.55863574e-03f },
+	{ -1.60360392e-02f, -8.73308629e-03f, 1.67126916e-02f, 4.03906545e-03f },
+	{ -1.67576149e-02f, -7.58803543e-03f, 1.70823839e-02f, 1.43590604e-03f },
+	{ -1.73758753e-02f, -6.39620190e-03f, 1.70985162e-02f, -1.19697279e-03f },
+	{ -1.78870019e-02f, -5.16494084e-03f, 1.67607591e-02f, -3.80507740e-03f },
+};
+
+static void fff_F_1200_96000_calc (const float *x, float *sums)
+{
+	fff_calc_sparse (x, fff_F_1200_96000, 113, sums);
+}
+
+/* E, 1200 baud, 1200 & 2200 Hz, 44100 samples per second. */
+
+static const float fff_E_1200_44100[74][4] = {
+	{ 3.79122721e-05f, 9.14403528e-04f, 8.14513711e-04f, 3.87420063e-04f },
+	{ 5.64199639e-04f, 2.68164161e-03f, 2.68240762e-03f, 3.54421645e-04f },
+	{ 1.66180043e-03f, 4.23411746e-03f, 4.43025632e-03f, -8.11118574e-04f },
+	{ 3.26442090e-03f, 5.42322686e-03f, 5.53887337e-03f, -2.98108091e-03f },
+	{ 5.27327415e-03f, 6.11969316e-03f, 5.57533093e-03f, -5.82072418e-03f },
+	{ 7.56199844e-03f, 6.22065645e-03f, 4.26866906e-03f, -8.83522164e-03f },
+	{ 9.98297613e-03f, 5.65552153e-03f, 1.56327605e-03f, -1.14418380e-02f },
+	{ 1.23747345e-02f, 4.39023878e-03f, -2.35809362e-03f, -1.30578782e-02f },
+	{ 1.45701384e-02f, 2.42986786e-03f, -7.08583137e-03f, -1.31924469e-02f },
+	{ 1.64049547e-02f, -1.80828458e-04f, -1.20288413e-02f, -1.15290089e-02f },
+	{ 1.77263338e-02f, -3.35866679e-03f, -1.64885037e-02f, -7.98691809e-03f },
+	{ 1.84009299e-02f, -6.98524481e-03f, -1.97520237e-02f, -2.75265961e-03f },
+	{ 1.83221418e-02f, -1.09118568e-02f, -2.11929996e-02f, 3.72477691e-03f },
+	{ 1.74162183e-02f, -1.49660353e-02f, -2.03657821e-02f, 1.07750110e-02f },
+	{ 1.56468470e-02f, -1.89592391e-02f, -1.70806758e-02f, 1.75799951e-02f },
+	{ 1.30181322e-02f, -2.26954967e-02f, -1.14491610e-02f, 2.32717432e-02f },
+	{ 9.57561191e-03f, -2.59805489e-02f, -3.89177469e-03f, 2.70422492e-02f },
+	{ 5.40545536e-03f, -2.86310650e-02f, 4.89371270e-03f, 2.82516275e-02f },
+	{ 6.31658477e-04f, -3.04835308e-02f, 1.40015781e-02f, 2.65205353e-02f },
+	{ -4.58845310e-03f, -3.14023755e-02f, 2.24173870e-02f, 2.17943694e-02f },
+	{ -1.00704385e-02f, -3.12869772e-02f, 2.91358978e-02f, 1.43698761e-02f },
+	{ -1.56101948e-02f, -3.00772078e-02f, 3.32833789e-02f, 4.87959431e-03f },
+	{ -2.09925324e-02f, -2.77572237e-02f, 3.42294686e-02f, -5.76570956e-03f },
+	{ -2.60002967e-02f, -2.43573710e-02f, 3.16742472e-02f, -1.64708234e-02f },
+	{ -3.04238088e-02f, -1.99540164e-02f, 2.56990287e-02f, -2.60759722e-02f },
+	{ -3.40700708e-02f, -1.46674104e-02f, 1.67736635e-02f, -3.34888138e-02f },
+	{ -3.67714167e-02f, -8.65748804e-03f, 5.71798068e-03f, -3.78132537e-02f },
+	{ -3.83931249e-02f, -2.11798912e-03f, -6.37916103e-03f, -3.84593569e-02f },
+	{ -3.88397723e-02f, 4.73109446e-03f, -1.82746369e-02f, -3.52207683e-02f },
+	{ -3.80598828e-02f, 1.16521642e-02f, -2.87069939e-02f, -2.83097196e-02f },
+	{ -3.60488035e-02f, 1.83996651e-02f, -3.65377367e-02f, -1.83445923e-02f },
+	{ -3.28495875e-02f, 2.47300249e-02f, -4.08817567e-02f, -6.29046094e-03f },
+	{ -2.85517983e-02f, 3.04117352e-02f, -4.12111618e-02f, 6.64108526e-03f },
+	{ -2.32883934e-02f, 3.52348909e-02f, -3.74202840e-02f, 1.91220287e-02f },
+	{ -1.72306988e-02f, 3.90199684e-02f, -2.98435967e-02f, 2.98529249e-02f },
+	{ -1.05817588e-02f, 4.16252799e-02f, -1.92240681e-02f, 3.77065130e-02f },
+	{ -3.56830470e-03f, 4.29529324e-02f, -6.63511502e-03f, 4.18530405e-02f },
+	{ 3.56830470e-03f, 4.29529324e-02f, 6.63511502e-03f, 4.18530405e-02f },
+	{ 1.05817588e-02f, 4.16252799e-02f, 1.92240681e-02f, 3.77065130e-02f },
+	{ 1.72306988e-02f, 3.90199684e-02f, 2.98435967e-02f, 2.98529249e-02f },
+	{ 2.32883934e-02f, 3.52348909e-02f, 3.74202840e-02f, 1.91220287e-02f },
+	{ 2.85517983e-02f, 3.04117352e-02f, 4.12111618e-02f, 6.64108526e-03f },
+	{ 3.28495875e-02f, 2.47300249e-02f, 4.08817567e-02f, -6.29046094e-03f },
+	{ 3.60488035e-02f, 1.83996651e-02f, 3.65377367e-02f, -1.83445923e-02f },
+	{ 3.80598828e-02f, 1.16521642e-02f, 2.87069939e-02f, -2.83097196e-02f },
+	{ 3.88397723e-02f, 4.73109446e-03f, 1.82746369e-02f, -3.52207683e-02f },
+	{ 3.83931249e-02f, -2.11798912e-03f, 6.37916103e-03f, -3.84593569e-02f },
+	{ 3.67714167e-02f, -8.65748804e-03f, -5.71798068e-03f, -3.78132537e-02f },
+	{ 3.40700708e-02f, -1.46674104e-02f, -1.67736635e-02f, -3.34888138e-02f },
+	{ 3.04238088e-02f, -1.99540164e-02f, -2.56990287e-02f, -2.60759722e-02f },
+	{ 2.60002967e-02f, -2.43573710e-02f, -3.16742472e-02f, -1.64708234e-02f },
+	{ 2.09925324e-02f, -2.77572237e-02f, -3.42294686e-02f, -5.76570956e-03f },
+	{ 1.56101948e-02f, -3.00772078e-02f, -3.32833789e-02f, 4.87959431e-03f },
+	{ 1.00704385e-02f, -3.12869772e-02f, -2.91358978e-02f, 1.43698761e-02f },
+	{ 4.58845310e-03f, -3.14023755e-02f, -2.24173870e-02f, 2.17943694e-02f },
+	{ -6.31658477e-04f, -3.04835308e-02f, -1.40015781e-02f, 2.65205353e-02f },
+	{ -5.40545536e-03f, -2.86310650e-02f, -4.89371270e-03f, 2.82516275e-02f },
+	{ -9.57561191e-03f, -2.59805489e-02f, 3.89177469e-03f, 2.70422492e-02f },
+	{ -1.30181322e-02f, -2.26954967e-02f, 1.14491610e-02f, 2.32717432e-02f },
+	{ -1.56468470e-02f, -1.89592391e-02f, 1.70806758e-02f, 1.75799951e-02f },
+	{ -1.74162183e-02f, -1.49660353e-02f, 2.03657821e-02f, 1.07750110e-02f },
+	{ -1.83221418e-02f, -1.09118568e-02f, 2.11929996e-02f, 3.72477691e-03f },
+	{ -1.84009299e-02f, -6.98524481e-03f, 1.97520237e-02f, -2.75265961e-03f },
+	{ -1.77263338e-02f, -3.35866679e-03f, 1.64885037e-02f, -7.98691809e-03f },
+	{ -1.64049547e-02f, -1.80828458e-04f, 1.20288413e-02f, -1.15290089e-02f },
+	{ -1.45701384e-02f, 2.42986786e-03f, 7.08583137e-03f, -1.31924469e-02f },
+	{ -1.23747345e-02f, 4.39023878e-03f, 2.35809362e-03f, -1.30578782e-02f },
+	{ -9.98297613e-03f, 5.65552153e-03f, -1.56327605e-03f, -1.14418380e-02f },
+	{ -7.56199844e-03f, 6.22065645e-03f, -4.26866906e-03f, -8.83522164e-03f },
+	{ -5.27327415e-03f, 6.11969316e-03f, -5.57533093e-03f, -5.82072418e-03f },
+	{ -3.26442090e-03f, 5.42322686e-03f, -5.53887337e-03f, -2.98108091e-03f },
+	{ -1.66180043e-03f, 4.23411746e-03f, -4.43025632e-03f, -8.11118574e-04f },
+	{ -5.64199639e-04f, 2.68164161e-03f, -2.68240762e-03f, 3.54421645e-04f },
+	{ -3.79122721e-05f, 9.14403528e-04f, -8.14513711e-04f, 3.87420063e-04f },
+};
+
+static void fff_E_1200_44100_calc (const float *x, float *sums)
+{
+	fff_calc (x, fff_E_1200_44100, 74, sums);
+}
+
+/* E, 1200 baud, 1200 & 2200 Hz, 48000 samples per second. */
+
+static const float fff_E_1200_48000[81][4] = {
+	{ -1.29520297e-10f, 7.63672753e-04f, 6.51975162e-04f, 3.75630159e-04f },
+	{ 3.47471214e-04f, 2.26167729e-03f, 2.19500437e-03f, 5.25872048e-04f },
+	{ 1.14283222e-03f, 3.62602272e-03f, 3.75337387e-03f, -1.96294015e-04f },
+	{ 2.34704255e-03f, 4.74874768e-03f, 4.95265471e-03f, -1.75015267e-03f },
+	{ 3.89910140e-03f, 5.53258229e-03f, 5.45407552e-03f, -3.95431509e-03f },
+	{ 5.71859675e-03f, 5.89540694e-03f, 5.00344764e-03f, -6.50695525e-03f },
+	{ 7.70906266e-03f, 5.77413477e-03f, 3.47048580e-03f, -9.02199466e-03f },
+	{ 9.76204406e-03f, 5.12779783e-03f, 8.73616431e-04f, -1.10770948e-02f },
+	{ 1.17617082e-02f, 3.93976783e-03f, -2.61312234e-03f, -1.22680422e-02f },
+	{ 1.35897854e-02f, 2.21895939e-03f, -6.67225290e-03f, -1.22630382e-02f },
+	{ 1.51306847e-02f, 1.86010152e-10f, -1.08732786e-02f, -1.08505217e-02f },
+	{ 1.62765328e-02f, -2.65765516e-03f, -1.47183044e-02f, -7.97464885e-03f },
+	{ 1.69320162e-02f, -5.67164226e-03f, -1.76979918e-02f, -3.75394779e-03f },
+	{ 1.70187168e-02f, -8.93956516e-03f, -1.93518419e-02f, 1.51982729e-03f },
+	{ 1.64788663e-02f, -1.23427575e-02f, -1.93258524e-02f, 7.40296254e-03f },
+	{ 1.52783217e-02f, -1.57506876e-02f, -1.74210593e-02f, 1.33396471e-02f },
+	{ 1.34086283e-02f, -1.90259889e-02f, -1.36270402e-02f, 1.87167302e-02f },
+	{ 1.08881071e-02f, -2.20297948e-02f, -8.13613739e-03f, 2.29276139e-02f },
+	{ 7.76190124e-03f, -2.46272627e-02f, -1.33599911e-03f, 2.54388209e-02f },
+	{ 4.10096254e-03f, -2.66929697e-02f, 6.21949788e-03f, 2.58518271e-02f },
+	{ 2.38427278e-09f, -2.81161182e-02f, 1.38585689e-02f, 2.39534900e-02f },
+	{ -4.42546746e-03f, -2.88051888e-02f, 2.08548084e-02f, 1.97490286e-02f },
+	{ -9.04298760e-03f, -2.86919605e-02f, 2.64989045e-02f, 1.34735974e-02f },
+	{ -1.37077263e-02f, -2.77347155e-02f, 3.01718675e-02f, 5.58031164e-03f },
+	{ -1.82675309e-02f, -2.59204730e-02f, 3.14118043e-02f, -3.29459505e-03f },
+	{ -2.25684140e-02f, -2.32661776e-02f, 2.99673732e-02f, -1.23868845e-02f },
+	{ -2.64601298e-02f, -1.98187809e-02f, 2.58317702e-02f, -2.08743438e-02f },
+	{ -2.98017506e-02f, -1.56542342e-02f, 1.92533471e-02f, -2.79551223e-02f },
+	{ -3.24669294e-02f, -1.08753033e-02f, 1.07209813e-02f, -3.29266861e-02f },
+	{ -3.43487076e-02f, -5.60850184e-03f, 9.25187371e-04f, -3.52572463e-02f },
+	{ -3.53636742e-02f, -1.59358782e-09f, -9.30187851e-03f, -3.46423984e-02f },
+	{ -3.54553387e-02f, 5.78919100e-03f, -1.90618038e-02f, -3.10408976e-02f },
+	{ -3.45965065e-02f, 1.15886331e-02f, -2.74736658e-02f, -2.46855933e-02f },
+	{ -3.27906683e-02f, 1.72242448e-02f, -3.37578580e-02f, -1.60679519e-02f },
+	{ -3.00722830e-02f, 2.25243084e-02f, -3.73117775e-02f, -5.89722767e-03f },
+	{ -2.65059192e-02f, 2.73254234e-02f, -3.77697162e-02f, 4.96206060e-03f },
+	{ -2.21843664e-02f, 3.14782113e-02f, -3.50409448e-02f, 1.55685581e-02f },
+	{ -1.72256716e-02f, 3.48525234e-02f, -2.93219015e-02f, 2.49908194e-02f },
+	{ -1.17692919e-02f, 3.73420641e-02f, -2.10811365e-02f, 3.23941149e-02f },
+	{ -5.97147504e-03f, 3.88680808e-02f, -1.10181384e-02f, 3.71187106e-02f },
+	{ 0.00000000e+00f, 3.93821932e-02f, 0.00000000e+00f, 3.87420543e-02f },
+	{ 5.97147504e-03f, 3.88680808e-02f, 1.10181384e-02f, 3.71187106e-02f },
+	{ 1.17692919e-02f, 3.73420641e-02f, 2.10811365e-02f, 3.23941149e-02f },
+	{ 1.72256716e-02f, 3.48525234e-02f, 2.93219015e-02f, 2.49908194e-02f },
+	{ 2.21843664e-02f, 3.14782113e-02f, 3.50409448e-02f, 1.55685581e-02f },
+	{ 2.65059192e-02f, 2.73254234e-02f, 3.77697162e-02f, 4.96206060e-03f },
+	{ 3.00722830e-02f, 2.25243084e-02f, 3.73117775e-02f, -5.89722767e-03f },
+	{ 3.27906683e-02f, 1.72242448e-02f, 3.37578580e-02f, -1.60679519e-02f },
+	{ 3.45965065e-02f, 1.15886331e-02f, 2.74736658e-02f, -2.46855933e-02f },
+	{ 3.54553387e-02f, 5.78919100e-03f, 1.90618038e-02f, -3.10408976e-02f },
+	{ 3.53636742e-02f, -1.59358782e-09f, 9.30187851e-03f, -3.46423984e-02f },
+	{ 3.43487076e-02f, -5.60850184e-03f, -9.25187371e-04f, -3.52572463e-02f },
+	{ 3.24669294e-02f, -1.08753033e-02f, -1.07209813e-02f, -3.29266861e-02f },
+	{ 2.98017506e-02f, -1.56542342e-02f, -1.92533471e-02f, -2.79551223e-02f },
+	{ 2.64601298e-02f, -1.98187809e-02f, -2.58317702e-02f, -2.08743438e-02f },
+	{ 2.25684140e-02f, -2.32661776e-02f, -2.99673732e-02f, -1.23868845e-02f },
+	{ 1.82675309e-02f, -2.59204730e-02f, -3.14118043e-02f, -3.29459505e-03f },
+	{ 1.37077263e-02f, -2.77347155e-02f, -3.01718675e-02f, 5.58031164e-03f },
+	{ 9.04298760e-03f, -2.86919605e-02f, -2.64989045e-02f, 1.34735974e-02f },
+	{ 4.42546746e-03f, -2.88051888e-02f, -2.08548084e-02f, 1.97490286e-02f },
+	{ -2.38427278e-09f, -2.81161182e-02f, -1.38585689e-02f, 2.39534900e-02f },
+	{ -4.10096254e-03f, -2.66929697e-02f, -6.21949788e-03f, 2.58518271e-02f },
+	{ -7.76190124e-03f, -2.46272627e-02f, 1.33599911e-03f, 2.54388209e-02f },
+	{ -1.08881071e-02f, -2.20297948e-02f, 8.13613739e-03f, 2.29276139e-02f },
+	{ -1.34086283e-02f, -1.90259889e-02f, 1.36270402e-02f, 1.87167302e-02f },
+	{ -1.52783217e-02f, -1.57506876e-02f, 1.74210593e-02f, 1.33396471e-02f },
+	{ -1.64788663e-02f, -1.23427575e-02f, 1.93258524e-02f, 7.40296254e-03f },
+	{ -1.70187168e-02f, -8.93956516e-03f, 1.93518419e-02f, 1.51982729e-03f },
+	{ -1.69320162e-02f, -5.67164226e-03f, 1.76979918e-02f, -3.75394779e-03f },
+	{ -1.62765328e-02f, -2.65765516e-03f, 1.47183044e-02f, -7.97464885e-03f },
+	{ -1.51306847e-02f, 1.86010152e-10f, 1.08732786e-02f, -1.08505217e-02f },
+	{ -1.35897854e-02f, 2.21895939e-03f, 6.67225290e-03f, -1.22630382e-02f },
+	{ -1.17617082e-02f, 3.93976783e-03f, 2.61312234e-03f, -1.22680422e-02f },
+	{ -9.76204406e-03f, 5.12779783e-03f, -8.73616431e-04f, -1.10770948e-02f },
+	{ -7.70906266e-03f, 5.77413477e-03f, -3.47048580e-03f, -9.02199466e-03f },
+	{ -5.71859675e-03f, 5.89540694e-03f, -5.00344764e-03f, -6.50695525e-03f },
+	{ -3.89910140e-03f, 5.53258229e-03f, -5.45407552e-03f, -3.95431509e-03f },
+	{ -2.34704255e-03f, 4.74874768e-03f, -4.95265471e-03f, -1.75015267e-03f },
+	{ -1.14283222e-03f, 3.62602272e-03f, -3.75337387e-03f, -1.96294015e-04f },
+	{ -3.47471214e-04f, 2.26167729e-03f, -2.19500437e-03f, 5.25872048e-04f },
+	{ 1.29520297e-10f, 7.63672753e-04f, -6.51975162e-04f, 3.75630159e-04f },
+};
+
+static void fff_E_1200_48000_calc (const float *x, float *sums)
+{
+	fff_calc (x, fff_E_1200_48000, 81, sums);
+}
+
+/* E, 1200 baud, 1200 & 2200 Hz, 14700 samples per second. */
+
+static const float fff_E_1200_14700[25][4] = {
+	{ 9.94397677e-04f, 7.93184061e-03f, 7.56083243e-03f, 2.24315817e-03f },
+	{ 1.38797415e-02f, 1.91268306e-02f, 1.87106226e-02f, -1.42724225e-02f },
+	{ 3.49943675e-02f, 1.59318186e-02f, -8.29427736e-04f, -3.87903787e-02f },
+	{ 5.24863936e-02f, -5.20736957e-03f, -4.38628346e-02f, -3.05851139e-02f },
+	{ 5.44256046e-02f, -3.90453078e-02f, -6.36436343e-02f, 2.18805056e-02f },
+	{ 3.42511758e-02f, -7.31472671e-02f, -2.35992223e-02f, 7.64773786e-02f },
+	{ -5.78412740e-03f, -9.26564261e-02f, 5.47642820e-02f, 7.33510777e-02f },
+	{ -5.46580032e-02f, -8.63589421e-02f, 1.01610839e-01f, -1.08538137e-03f },
+	{ -9.62181911e-02f, -5.16254492e-02f, 6.39331117e-02f, -8.95628408e-02f },
+	{ -1.15087733e-01f, 3.79565731e-03f, -3.67997959e-02f, -1.10792711e-01f },
+	{ -1.02576815e-01f, 6.39522076e-02f, -1.15864180e-01f, -3.70855965e-02f },
+	{ -6.02930374e-02f, 1.10102929e-01f, -1.00658596e-01f, 7.34338164e-02f },
+	{ 0.00000000e+00f, 1.27367884e-01f, 0.00000000e+00f, 1.25556991e-01f },
+	{ 6.02930374e-02f, 1.10102929e-01f, 1.00658596e-01f, 7.34338164e-02f },
+	{ 1.02576815e-01f, 6.39522076e-02f, 1.15864180e-01f, -3.70855965e-02f },
+	{ 1.15087733e-01f, 3.79565731e-03f, 3.67997959e-02f, -1.10792711e-01f },
+	{ 9.62181911e-02f, -5.16254492e-02f, -6.39331117e-02f, -8.95628408e-02f },
+	{ 5.46580032e-02f, -8.63589421e-02f, -1.01610839e-01f, -1.08538137e-03f },
+	{ 5.78412740e-03f, -9.26564261e-02f, -5.47642820e-02f, 7.33510777e-02f },
+	{ -3.42511758e-02f, -7.31472671e-02f, 2.35992223e-02f, 7.64773786e-02f },
+	{ -5.44256046e-02f, -3.90453078e-02f, 6.36436343e-02f, 2.18805056e-02f },
+	{ -5.24863936e-02f, -5.20736957e-03f, 4.38628346e-02f, -3.05851139e-02f },
+	{ -3.49943675e-02f, 1.59318186e-02f, 8.29427736e-04f, -3.87903787e-02f },
+	{ -1.38797415e-02f, 1.91268306e-02f, -1.87106226e-02f, -1.42724225e-02f },
+	{ -9.94397677e-04f, 7.93184061e-03f, -7.56083243e-03f, 2.24315817e-03f },
+};
+
+static void fff_E_1200_14700_calc (const float *x, float *sums)
+{
+	fff_calc (x, fff_E_1200_14700, 25, sums);
+}
+
+/* E, 1200 baud, 1200 & 2200 Hz, 16000 samples per second. */
+
+static const float fff_E_1200_16000[27][4] = {
+	{ 1.04245020e-03f, 6.77786488e-03f, 6.58068014e-03f, 1.57707196e-03f },
+	{ 1.16977496e-02f, 1.65802129e-02f, 1.63514595e-02f, -1.18588535e-02f },
+	{ 2.92872395e-02f, 1.53671568e-02f, 2.61915661e-03f, -3.32198143e-02f },
+	{ 4.53937799e-02f, 2.28476900e-08f, -3.25983725e-02f, -3.25403363e-02f },
+	{ 5.10580912e-02f, -2.67903637e-02f, -5.80173209e-02f, 4.55790898e-03f },
+	{ 4.02274281e-02f, -5.70176542e-02f, -4.08542417e-02f, 5.61308041e-02f },
+	{ 1.23033738e-02f, -7.99943134e-02f, 1.86461788e-02f, 7.75287300e-02f },
+	{ -2.71299928e-02f, -8.59849527e-02f, 7.94444010e-02f, 4.04068455e-02f },
+	{ -6.77077919e-02f, -6.97248131e-02f, 8.98429602e-02f, -3.71478349e-02f },
+	{ -9.74044949e-02f, -3.25914547e-02f, 3.21418010e-02f, -9.87459645e-02f },
+	{ -1.06370062e-01f, 1.73492264e-02f, -5.71477823e-02f, -9.30905640e-02f },
+	{ -9.02202874e-02f, 6.75015375e-02f, -1.11861676e-01f, -1.76855940e-02f },
+	{ -5.16789816e-02f, 1.04447119e-01f, -8.79078284e-02f, 7.49465972e-02f },
+	{ 0.00000000e+00f, 1.18021771e-01f, 0.00000000e+00f, 1.16186067e-01f },
+	{ 5.16789816e-02f, 1.04447119e-01f, 8.79078284e-02f, 7.49465972e-02f },
+	{ 9.02202874e-02f, 6.75015375e-02f, 1.11861676e-01f, -1.76855940e-02f },
+	{ 1.06370062e-01f, 1.73492264e-02f, 5.71477823e-02f, -9.30905640e-02f },
+	{ 9.74044949e-02f, -3.25914547e-02f, -3.21418010e-02f, -9.87459645e-02f },
+	{ 6.77077919e-02f, -6.97248131e-02f, -8.98429602e-02f, -3.71478349e-02f },
+	{ 2.71299928e-02f, -8.59849527e-02f, -7.94444010e-02f, 4.04068455e-02f },
+	{ -1.23033738e-02f, -7.99943134e-02f, -1.86461788e-02f, 7.75287300e-02f },
+	{ -4.02274281e-02f, -5.70176542e-02f, 4.08542417e-02f, 5.61308041e-02f },
+	{ -5.10580912e-02f, -2.67903637e-02f, 5.80173209e-02f, 4.55790898e-03f },
+	{ -4.53937799e-02f, 2.28476900e-08f, 3.25983725e-02f, -3.25403363e-02f },
+	{ -2.92872395e-02f, 1.53671568e-02f, -2.61915661e-03f, -3.32198143e-02f },
+	{ -1.16977496e-02f, 1.65802129e-02f, -1.63514595e-02f, -1.18588535e-02f },
+	{ -1.04245020e-03f, 6.77786488e-03f, -6.58068014e-03f, 1.57707196e-03f },
+};
+
+static void fff_E_1200_16000_calc (const float *x, float *sums)
+{
+	fff_calc (x, fff_E_1200_16000, 27, sums);
+}
+
+/* E, 1200 baud, 1200 & 2200 Hz, 32000 samples per second. */
+
+static const float fff_E_1200_32000[54][4] = {
+	{ 6.54294927e-05f, 1.71652948e-03f, 1.52379670e-03f, 7.37577677e-04f },
+	{ 1.35561905e-03f, 4.95448383e-03f, 5.07404143e-03f, 9.94413422e-05f },
+	{ 4.05792100e-03f, 7.46876933e-03f, 7.73196761e-03f, -3.37508391e-03f },
+	{ 7.86554255e-03f, 8.77056178e-03f, 7.82156736e-03f, -8.78381822e-03f },
+	{ 1.23313405e-02f, 8.49291962e-03f, 4.37484961e-03f, -1.43922837e-02f },
+	{ 1.69099178e-02f, 6.43024920e-03f, -2.50947592e-03f, -1.81057286e-02f },
+	{ 2.10095011e-02f, 2.56311754e-03f, -1.15907155e-02f, -1.80693194e-02f },
+	{ 2.40488984e-02f, -2.93389335e-03f, -2.07259133e-02f, -1.32402945e-02f },
+	{ 2.55145114e-02f, -9.70224570e-03f, -2.73750182e-02f, -3.77866509e-03f },
+	{ 2.50123292e-02f, -1.72266308e-02f, -2.92527303e-02f, 8.85547977e-03f },
+	{ 2.23101005e-02f, -2.48770919e-02f, -2.49660015e-02f, 2.21397653e-02f },
+	{ 1.73658822e-02f, -3.19625624e-02f, -1.44734122e-02f, 3.30209620e-02f },
+	{ 1.03402473e-02f, -3.77911739e-02f, 7.60016206e-04f, 3.86236459e-02f },
+	{ 1.59076019e-03f, -4.17322367e-02f, 1.79688483e-02f, 3.69704515e-02f },
+	{ -8.35099258e-03f, -4.32743654e-02f, 3.36249694e-02f, 2.75386535e-02f },
+	{ -1.88180674e-02f, -4.20748144e-02f, 4.41960208e-02f, 1.15091279e-02f },
+	{ -2.90595312e-02f, -3.79954167e-02f, 4.69558164e-02f, -8.36801529e-03f },
+	{ -3.83002572e-02f, -3.11219916e-02f, 4.06590439e-02f, -2.82795466e-02f },
+	{ -4.58040684e-02f, -2.17653140e-02f, 2.59167254e-02f, -4.41273414e-02f },
+	{ -5.09351194e-02f, -1.04431929e-02f, 5.17272996e-03f, -5.24116792e-02f },
+	{ -5.32121584e-02f, 2.15499569e-03f, -1.77297797e-02f, -5.10234125e-02f },
+	{ -5.23510650e-02f, 1.52185466e-02f, -3.83095108e-02f, -3.97624448e-02f },
+	{ -4.82919738e-02f, 2.78764628e-02f, -5.23763485e-02f, -2.04576105e-02f },
+	{ -4.12086472e-02f, 3.92642803e-02f, -5.69274053e-02f, 3.35028209e-03f },
+	{ -3.14990096e-02f, 4.85912561e-02f, -5.08114398e-02f, 2.71034986e-02f },
+	{ -1.97576340e-02f, 5.52023128e-02f, -3.50109041e-02f, 4.61557582e-02f },
+	{ -6.73224730e-03f, 5.86296096e-02f, -1.24737918e-02f, 5.67355640e-02f },
+	{ 6.73224730e-03f, 5.86296096e-02f, 1.24737918e-02f, 5.67355640e-02f },
+	{ 1.97576340e-02f, 5.52023128e-02f, 3.50109041e-02f, 4.61557582e-02f },
+	{ 3.14990096e-02f, 4.85912561e-02f, 5.08114398e-02f, 2.71034986e-02f },
+	{ 4.12086472e-02f, 3.92642803e-02f, 5.69274053e-02f, 3.35028209e-03f },
+	{ 4.82919738e-02f, 2.78764628e-02f, 5.23763485e-02f, -2.04576105e-02f },
+	{ 5.23510650e-02f, 1.52185466e-02f, 3.83095108e-02f, -3.97624448e-02f },
+	{ 5.32121584e-02f, 2.15499569e-03f, 1.77297797e-02f, -5.10234125e-02f },
+	{ 5.09351194e-02f, -1.04431929e-02f, -5.17272996e-03f, -5.24116792e-02f },
+	{ 4.58040684e-02f, -2.17653140e-02f, -2.59167254e-02f, -4.41273414e-02f },
+	{ 3.83002572e-02f, -3.11219916e-02f, -4.06590439e-02f, -2.82795466e-02f },
+	{ 2.90595312e-02f, -3.79954167e-02f, -4.69558164e-02f, -8.36801529e-03f },
+	{ 1.88180674e-02f, -4.20748144e-02f, -4.41960208e-02f, 1.15091279e-02f },
+	{ 8.35099258e-03f, -4.32743654e-02f, -3.36249694e-02f, 2.75386535e-02f },
+	{ -1.59076019e-03f, -4.17322367e-02f, -1.79688483e-02f, 3.69704515e-02f },
+	{ -1.03402473e-02f, -3.77911739e-02f, -7.60016206e-04f, 3.86236459e-02f },
+	{ -1.73658822e-02f, -3.19625624e-02f, 1.44734122e-02f, 3.30209620e-02f },
+	{ -2.23101005e-02f, -2.48770919e-02f, 2.49660015e-02f, 2.21397653e-02f },
+	{ -2.50123292e-02f, -1.72266308e-02f, 2.92527303e-02f, 8.85547977e-03f },
+	{ -2.55145114e-02f, -9.70224570e-03f, 2.73750182e-02f, -3.77866509e-03f },
+	{ -2.40488984e-02f, -2.93389335e-03f, 2.07259133e-02f, -1.32402945e-02f },
+	{ -2.10095011e-02f, 2.56311754e-03f, 1.15907155e-02f, -1.80693194e-02f },
+	{ -1.69099178e-02f, 6.43024920e-03f, 2.50947592e-03f, -1.81057286e-02f },
+	{ -1.23313405e-02f, 8.49291962e-03f, -4.37484961e-03f, -1.43922837e-02f },
+	{ -7.86554255e-03f, 8.77056178e-03f, -7.82156736e-03f, -8.78381822e-03f },
+	{ -4.05792100e-03f, 7.46876933e-03f, -7.73196761e-03f, -3.37508391e-03f },
+	{ -1.35561905e-03f, 4.95448383e-03f, -5.07404143e-03f, 9.94413422e-05f },
+	{ -6.54294927e-05f, 1.71652948e-03f, -1.52379670e-03f, 7.37577677e-04f },
+};
+
+static void fff_E_1200_32000_calc (const float *x, float *sums)
+{
+	fff_calc (x, fff_E_1200_32000, 54, sums);
+}
+
+/* D, 300 baud, 1600 & 1800 Hz, 14700 samples per second. */
+
+static const float fff_D_300_14700[91][4] = {
+	{ 3.56219040e-04f, 4.77758731e-04f, 3.81675709e-05f, -5.94798999e-04f },
+	{ 1.73234392e-03f, 4.34962625e-04f, -1.15797832e-03f, -1.36097951e-03f },
+	{ 2.69341306e-03f, -1.26300601e-03f, -2.96117901e-03f, -2.85828282e-04f },
+	{ 1.80456298e-03f, -3.75079783e-03f, -3.25237121e-03f, 2.59510102e-03f },
+	{ -1.24356418e-03f, -5.19702304e-03f, -6.82873477e-04f, 5.29906061e-03f },
+	{ -5.17716119e-03f, -3.95443803e-03f, 3.89588857e-03f, 5.22302371e-03f },
+	{ -7.67409056e-03f, 2.46316427e-04f, 7.58114876e-03f, 1.22634764e-03f },
+	{ -6.66548312e-03f, 5.80391195e-03f, 7.24734738e-03f, -5.05820476e-03f },
+	{ -1.69809454e-03f, 9.84447636e-03f, 1.90826424e-03f, -9.80391633e-03f },
+	{ 5.45416493e-03f, 9.69371665e-03f, -6.06467249e-03f, -9.32212360e-03f },
+	{ 1.13897566e-02f, 4.47444897e-03f, -1.19312024e-02f, -2.72473926e-03f },
+	{ 1.27063598e-02f, -4.07247897e-03f, -1.14115095e-02f, 6.92150928e-03f },
+	{ 7.87329488e-03f, -1.21070603e-02f, -3.66155175e-03f, 1.39707550e-02f },
+	{ -1.65369606e-03f, -1.54317450e-02f, 7.61031033e-03f, 1.35203637e-02f },
+	{ -1.17721641e-02f, -1.16582187e-02f, 1.58788767e-02f, 4.71539283e-03f },
+	{ -1.75138004e-02f, -1.69118494e-03f, 1.56029724e-02f, -8.14454816e-03f },
+	{ -1.54867144e-02f, 1.03278663e-02f, 5.86508401e-03f, -1.76744051e-02f },
+	{ -5.77749545e-03f, 1.87480543e-02f, -8.50623287e-03f, -1.76731702e-02f },
+	{ 7.71900034e-03f, 1.90843996e-02f, -1.93076469e-02f, -7.10934727e-03f },
+	{ 1.88567452e-02f, 1.03659984e-02f, -1.96760893e-02f, 8.71482026e-03f },
+	{ 2.20625997e-02f, -4.05636802e-03f, -8.41959566e-03f, 2.08079889e-02f },
+	{ 1.51188280e-02f, -1.77764092e-02f, 8.75420310e-03f, 2.16350593e-02f },
+	{ 5.16899396e-04f, -2.42047012e-02f, 2.21214462e-02f, 9.79790650e-03f },
+	{ -1.53910480e-02f, -1.97475068e-02f, 2.34871581e-02f, -8.64824932e-03f },
+	{ -2.51796544e-02f, -5.75259654e-03f, 1.12082893e-02f, -2.32870393e-02f },
+	{ -2.38424912e-02f, 1.18087083e-02f, -8.38405918e-03f, -2.52654143e-02f },
+	{ -1.13350647e-02f, 2.49080267e-02f, -2.42482778e-02f, -1.26573173e-02f },
+	{ 7.11609330e-03f, 2.71627810e-02f, -2.69002244e-02f, 7.98823591e-03f },
+	{ 2.32076999e-02f, 1.69534888e-02f, -1.41016692e-02f, 2.50526965e-02f },
+	{ 2.93314662e-02f, -1.57011568e-03f, 7.45218666e-03f, 2.84341518e-02f },
+	{ 2.21941359e-02f, -2.01753844e-02f, 2.56430414e-02f, 1.55535396e-02f },
+	{ 4.55362117e-03f, -3.02401334e-02f, 2.97924839e-02f, -6.80367323e-03f },
+	{ -1.58306640e-02f, -2.67807432e-02f, 1.69628784e-02f, -2.60739028e-02f },
+	{ -2.96424124e-02f, -1.09191351e-02f, -6.03912957e-03f, -3.10268626e-02f },
+	{ -3.03043053e-02f, 1.04325023e-02f, -2.62889899e-02f, -1.83481835e-02f },
+	{ -1.71273798e-02f, 2.76105180e-02f, -3.20592150e-02f, 5.18593658e-03f },
+	{ 4.20108996e-03f, 3.26140784e-02f, -1.96534768e-02f, 2.63483804e-02f },
+	{ 2.40925625e-02f, 2.28604078e-02f, 4.24600858e-03f, 3.29494327e-02f },
+	{ 3.34084518e-02f, 2.50602071e-03f, 2.61983201e-02f, 2.09039990e-02f },
+	{ 2.76949145e-02f, -1.93372574e-02f, 3.36179584e-02f, -3.24486243e-03f },
+	{ 9.32290684e-03f, -3.27198170e-02f, 2.20390446e-02f, -2.59025916e-02f },
+	{ -1.34992721e-02f, -3.14273424e-02f, -2.19012238e-03f, -3.41318101e-02f },
+	{ -3.04279849e-02f, -1.58894602e-02f, -2.54113954e-02f, -2.30906941e-02f },
+	{ -3.37155387e-02f, 6.94747502e-03f, -3.44118401e-02f, 1.10412715e-03f },
+	{ -2.17874218e-02f, 2.67551504e-02f, -2.39949264e-02f, 2.47903969e-02f },
+	{ 0.00000000e+00f, 3.45378071e-02f, 0.00000000e+00f, 3.45307998e-02f },
+	{ 2.17874218e-02f, 2.67551504e-02f, 2.39949264e-02f, 2.47903969e-02f },
+	{ 3.37155387e-02f, 6.94747502e-03f, 3.44118401e-02f, 1.10412715e-03f },
+	{ 3.04279849e-02f, -1.58894602e-02f, 2.54113954e-02f, -2.30906941e-02f },
+	{ 1.34992721e-02f, -3.14273424e-02f, 2.19012238e-03f, -3.41318101e-02f },
+	{ -9.32290684e-03f, -3.27198170e-02f, -2.20390446e-02f, -2.59025916e-02f },
+	{ -2.76949145e-02f, -1.93372574e-02f, -3.36179584e-02f, -3.24486243e-03f },
+	{ -3.34084518e-02f, 2.50602071e-03f, -2.61983201e-02f, 2.09039990e-02f },
+	{ -2.40925625e-02f, 2.28604078e-02f, -4.24600858e-03f, 3.29494327e-02f },
+	{ -4.20108996e-03f, 3.26140784e-02f, 1.96534768e-02f, 2.63483804e-02f },
+	{ 1.71273798e-02f, 2.76105180e-02f, 3.20592150e-02f, 5.18593658e-03f },
+	{ 3.03043053e-02f, 1.04325023e-02f, 2.62889899e-02f, -1.83481835e-02f },
+	{ 2.96424124e-02f, -1.09191351e-02f, 6.03912957e-03f, -3.10268626e-02f },
+	{ 1.58306640e-02f, -2.67807432e-02f, -1.69628784e-02f, -2.60739028e-02f },
+	{ -4.55362117e-03f, -3.02401334e-02f, -2.97924839e-02f, -6.80367323e-03f },
+	{ -2.21941359e-02f, -2.01753844e-02f, -2.56430414e-02f, 1.55535396e-02f },
+	{ -2.93314662e-02f, -1.57011568e-03f, -7.45218666e-03f, 2.84341518e-02f },
+	{ -2.32076999e-02f, 1.69534888e-02f, 1.41016692e-02f, 2.50526965e-02f },
+	{ -7.11609330e-03f, 2.71627810e-02f, 2.69002244e-02f, 7.98823591e-03f },
+	{ 1.13350647e-02f, 2.49080267e-02f, 2.42482778e-02f, -1.26573173e-02f },
+	{ 2.38424912e-02f, 1.18087083e-02f, 8.38405918e-03f, -2.52654143e-02f },
+	{ 2.51796544e-02f, -5.75259654e-03f, -1.12082893e-02f, -2.32870393e-02f },
+	{ 1.53910480e-02f, -1.97475068e-02f, -2.34871581e-02f, -8.64824932e-03f },
+	{ -5.16899396e-04f, -2.42047012e-02f, -2.21214462e-02f, 9.79790650e-03f },
+	{ -1.51188280e-02f, -1.77764092e-02f, -8.75420310e-03f, 2.16350593e-02f },
+	{ -2.20625997e-02f, -4.05636802e-03f, 8.41959566e-03f, 2.08079889e-02f },
+	{ -1.88567452e-02f, 1.03659984e-02f, 1.96760893e-02f, 8.71482026e-03f },
+	{ -7.71900034e-03f, 1.90843996e-02f, 1.93076469e-02f, -7.10934727e-03f },
+	{ 5.77749545e-03f, 1.87480543e-02f, 8.50623287e-03f, -1.76731702e-02f },
+	{ 1.54867144e-02f, 1.03278663e-02f, -5.86508401e-03f, -1.76744051e-02f },
+	{ 1.75138004e-02f, -1.69118494e-03f, -1.56029724e-02f, -8.14454816e-03f },
+	{ 1.17721641e-02f, -1.16582187e-02f, -1.58788767e-02f, 4.71539283e-03f },
+	{ 1.65369606e-03f, -1.54317450e-02f, -7.61031033e-03f, 1.35203637e-02f },
+	{ -7.87329488e-03f, -1.21070603e-02f, 3.66155175e-03f, 1.39707550e-02f },
+	{ -1.27063598e-02f, -4.07247897e-03f, 1.14115095e-02f, 6.92150928e-03f },
+	{ -1.13897566e-02f, 4.47444897e-03f, 1.19312024e-02f, -2.72473926e-03f },
+	{ -5.45416493e-03f, 9.69371665e-03f, 6.06467249e-03f, -9.32212360e-03f },
+	{ 1.69809454e-03f, 9.84447636e-03f, -1.90826424e-03f, -9.80391633e-03f },
+	{ 6.66548312e-03f, 5.80391195e-03f, -7.24734738e-03f, -5.05820476e-03f },
+	{ 7.67409056e-03f, 2.46316427e-04f, -7.58114876e-03f, 1.22634764e-03f },
+	{ 5.17716119e-03f, -3.95443803e-03f, -3.89588857e-03f, 5.22302371e-03f },
+	{ 1.24356418e-03f, -5.19702304e-03f, 6.82873477e-04f, 5.29906061e-03f },
+	{ -1.80456298e-03f, -3.75079783e-03f, 3.25237121e-03f, 2.59510102e-03f },
+	{ -2.69341306e-03f, -1.26300601e-03f, 2.96117901e-03f, -2.85828282e-04f },
+	{ -1.73234392e-03f, 4.34962625e-04f, 1.15797832e-03f, -1.36097951e-03f },
+	{ -3.56219040e-04f, 4.77758731e-04f, -3.81675709e-05f, -5.94798999e-04f },
+};
+
+static void fff_D_300_14700_calc (const float *x, float *sums)
+{
+	fff_calc (x, fff_D_300_14700, 91, sums);
+}
+
+/* D, 300 baud, 1600 & 1800 Hz, 16000 samples per second. */
+
+static const float fff_D_300_16000[99][4] = {
+	{ 2.95783597e-04f, 4.07501007e-04f, 3.94910421e-05f, -5.02053939e-04f },
+	{ 1.43528078e-03f, 4.66797821e-04f, -8.87211645e-04f, -1.22186809e-03f },
+	{ 2.39053206e-03f, -7.77471229e-04f, -2.44454923e-03f, -5.87233342e-04f },
+	{ 2.06632027e-03f, -2.84676021e-03f, -3.13285040e-03f, 1.59719377e-03f },
+	{ 3.22956828e-10f, -4.51807911e-03f, -1.72766973e-03f, 4.17339383e-03f },
+	{ -3.23726446e-03f, -4.45996644e-03f, 1.70223438e-03f, 5.24204969e-03f },
+	{ -6.17787940e-03f, -2.00924207e-03f, 5.53959282e-03f, 3.39668291e-03f },
+	{ -7.11154193e-03f, 2.31287768e-03f, 7.38680502e-03f, -1.17062544e-03f },
+	{ -4.96778684e-03f, 6.84408844e-03f, 5.48994588e-03f, -6.43167365e-03f },
+	{ -6.58633414e-09f, 9.42635536e-03f, 1.86393958e-08f, -9.42463335e-03f },
+	{ 6.09741220e-03f, 8.40039179e-03f, -6.73828647e-03f, -7.89421424e-03f },
+	{ 1.07652778e-02f, 3.50119406e-03f, -1.11819627e-02f, -1.77210919e-03f },
+	{ 1.16538908e-02f, -3.79019626e-03f, -1.04498537e-02f, 6.40742527e-03f },
+	{ 7.74445711e-03f, -1.06694764e-02f, -4.07227036e-03f, 1.25404326e-02f },
+	{ 1.86929849e-08f, -1.40978182e-02f, 5.39081823e-03f, 1.30223148e-02f },
+	{ -8.80437717e-03f, -1.21297864e-02f, 1.33487377e-02f, 6.80556847e-03f },
+	{ -1.50822224e-02f, -4.90520569e-03f, 1.54230418e-02f, -3.70491296e-03f },
+	{ -1.59034729e-02f, 5.17227734e-03f, 9.83070116e-03f, -1.35387313e-02f },
+	{ -1.03265475e-02f, 1.42268399e-02f, -1.37862598e-03f, -1.75279342e-02f },
+	{ -8.77553918e-10f, 1.84151139e-02f, -1.30113875e-02f, -1.30190849e-02f },
+	{ 1.12901786e-02f, 1.55544337e-02f, -1.91522744e-02f, -1.50823768e-03f },
+	{ 1.90202817e-02f, 6.18595723e-03f, -1.61825754e-02f, 1.17642498e-02f },
+	{ 1.97535269e-02f, -6.42441399e-03f, -4.84958570e-03f, 2.02117916e-02f },
+	{ 1.26492362e-02f, -1.74267758e-02f, 9.77168791e-03f, 1.91894080e-02f },
+	{ 1.50296042e-08f, -2.22697798e-02f, 2.05587074e-02f, 8.52072984e-03f },
+	{ -1.34923188e-02f, -1.85883380e-02f, 2.18350366e-02f, -7.09878793e-03f },
+	{ -2.24804971e-02f, -7.31133670e-03f, 1.23527963e-02f, -2.01697331e-02f },
+	{ -2.31073126e-02f, 7.51519529e-03f, -3.80148413e-03f, -2.40158718e-02f },
+	{ -1.46541316e-02f, 2.01889202e-02f, -1.89611781e-02f, -1.62039679e-02f },
+	{ -8.93131524e-09f, 2.55649798e-02f, -2.55452469e-02f, -2.52906212e-08f },
+	{ 1.53555200e-02f, 2.11552512e-02f, -1.98687688e-02f, 1.69795118e-02f },
+	{ 2.53759474e-02f, 8.25304259e-03f, -4.17476008e-03f, 2.63737068e-02f },
+	{ 2.58806087e-02f, -8.41713604e-03f, 1.42210498e-02f, 2.32203845e-02f },
+	{ 1.62908826e-02f, -2.24438794e-02f, 2.63639949e-02f, 8.57125595e-03f },
+	{ 6.72348732e-10f, -2.82179303e-02f, 2.60498505e-02f, -1.07965488e-02f },
+	{ -1.68329570e-02f, -2.31906958e-02f, 1.30037265e-02f, -2.55362839e-02f },
+	{ -2.76339091e-02f, -8.98739137e-03f, -6.78420532e-03f, -2.82750204e-02f },
+	{ -2.80037168e-02f, 9.10764281e-03f, -2.38257181e-02f, -1.73206273e-02f },
+	{ -1.75183695e-02f, 2.41349973e-02f, -2.97175776e-02f, 2.34019407e-03f },
+	{ -5.26865662e-09f, 3.01619843e-02f, -2.13112906e-02f, 2.13238355e-02f },
+	{ 1.78874917e-02f, 2.46435553e-02f, -2.38812645e-03f, 3.03616505e-02f },
+	{ 2.91976426e-02f, 9.49595496e-03f, 1.80484205e-02f, 2.48561893e-02f },
+	{ 2.94233076e-02f, -9.56934690e-03f, 3.00881825e-02f, 7.22779566e-03f },
+	{ 1.83057655e-02f, -2.52197832e-02f, 2.77542397e-02f, -1.41498195e-02f },
+	{ 2.73794054e-09f, -3.13483030e-02f, 1.19872233e-02f, -2.89567616e-02f },
+	{ -1.84926726e-02f, -2.54772976e-02f, -9.72394273e-03f, -2.99448874e-02f },
+	{ -3.00278664e-02f, -9.76596680e-03f, -2.69254632e-02f, -1.65096782e-02f },
+	{ -3.01037263e-02f, 9.79063474e-03f, -3.12689357e-02f, 4.95543005e-03f },
+	{ -1.86332725e-02f, 2.56709959e-02f, -2.05917936e-02f, 2.41241064e-02f },
+	{ 0.00000000e+00f, 3.17470804e-02f, 0.00000000e+00f, 3.17412801e-02f },
+	{ 1.86332725e-02f, 2.56709959e-02f, 2.05917936e-02f, 2.41241064e-02f },
+	{ 3.01037263e-02f, 9.79063474e-03f, 3.12689357e-02f, 4.95543005e-03f },
+	{ 3.00278664e-02f, -9.76596680e-03f, 2.69254632e-02f, -1.65096782e-02f },
+	{ 1.84926726e-02f, -2.54772976e-02f, 9.72394273e-03f, -2.99448874e-02f },
+	{ -2.73794054e-09f, -3.13483030e-02f, -1.19872233e-02f, -2.89567616e-02f },
+	{ -1.83057655e-02f, -2.52197832e-02f, -2.77542397e-02f, -1.41498195e-02f },
+	{ -2.94233076e-02f, -9.56934690e-03f, -3.00881825e-02f, 7.22779566e-03f },
+	{ -2.91976426e-02f, 9.49595496e-03f, -1.80484205e-02f, 2.48561893e-02f },
+	{ -1.78874917e-02f, 2.46435553e-02f, 2.38812645e-03f, 3.03616505e-02f },
+	{ 5.26865662e-09f, 3.01619843e-02f, 2.13112906e-02f, 2.13238355e-02f },
+	{ 1.75183695e-02f, 2.41349973e-02f, 2.97175776e-02f, 2.34019407e-03f },
+	{ 2.80037168e-02f, 9.10764281e-03f, 2.38257181e-02f, -1.73206273e-02f },
+	{ 2.76339091e-02f, -8.98739137e-03f, 6.78420532e-03f, -2.82750204e-02f },
+	{ 1.68329570e-02f, -2.31906958e-02f, -1.30037265e-02f, -2.55362839e-02f },
+	{ -6.72348732e-10f, -2.82179303e-02f, -2.60498505e-02f, -1.07965488e-02f },
+	{ -1.62908826e-02f, -2.24438794e-02f, -2.63639949e-02f, 8.57125595e-03f },
+	{ -2.58806087e-02f, -8.41713604e-03f, -1.42210498e-02f, 2.32203845e-02f },
+	{ -2.53759474e-02f, 8.25304259e-03f, 4.17476008e-03f, 2.63737068e-02f },
+	{ -1.53555200e-02f, 2.11552512e-02f, 1.98687688e-02f, 1.69795118e-02f },
+	{ 8.93131524e-09f, 2.55649798e-02f, 2.55452469e-02f, -2.52906212e-08f },
+	{ 1.46541316e-02f, 2.01889202e-02f, 1.89611781e-02f, -1.62039679e-02f },
+	{ 2.31073126e-02f, 7.51519529e-03f, 3.80148413e-03f, -2.40158718e-02f },
+	{ 2.24804971e-02f, -7.31133670e-03f, -1.23527963e-02f, -2.01697331e-02f },
+	{ 1.34923188e-02f, -1.85883380e-02f, -2.18350366e-02f, -7.09878793e-03f },
+	{ -1.50296042e-08f, -2.22697798e-02f, -2.05587074e-02f, 8.52072984e-03f },
+	{ -1.26492362e-02f, -1.74267758e-02f, -9.77168791e-03f, 1.91894080e-02f },
+	{ -1.97535269e-02f, -6.42441399e-03f, 4.84958570e-03f, 2.02117916e-02f },
+	{ -1.90202817e-02f, 6.18595723e-03f, 1.61825754e-02f, 1.17642498e-02f },
+	{ -1.12901786e-02f, 1.55544337e-02f, 1.91522744e-02f, -1.50823768e-03f },
+	{ 8.77553918e-10f, 1.84151139e-02f, 1.30113875e-02f, -1.30190849e-02f },
+	{ 1.03265475e-02f, 1.42268399e-02f, 1.37862598e-03f, -1.75279342e-02f },
+	{ 1.59034729e-02f, 5.17227734e-03f, -9.83070116e-03f, -1.35387313e-02f },
+	{ 1.50822224e-02f, -4.90520569e-03f, -1.54230418e-02f, -3.70491296e-03f },
+	{ 8.80437717e-03f, -1.21297864e-02f, -1.33487377e-02f, 6.80556847e-03f },
+	{ -1.86929849e-08f, -1.40978182e-02f, -5.39081823e-03f, 1.30223148e-02f },
+	{ -7.74445711e-03f, -1.06694764e-02f, 4.07227036e-03f, 1.25404326e-02f },
+	{ -1.16538908e-02f, -3.79019626e-03f, 1.04498537e-02f, 6.40742527e-03f },
+	{ -1.07652778e-02f, 3.50119406e-03f, 1.11819627e-02f, -1.77210919e-03f },
+	{ -6.09741220e-03f, 8.40039179e-03f, 6.73828647e-03f, -7.89421424e-03f },
+	{ 6.58633414e-09f, 9.42635536e-03f, -1.86393958e-08f, -9.42463335e-03f },
+	{ 4.96778684e-03f, 6.84408844e-03f, -5.48994588e-03f, -6.43167365e-03f },
+	{ 7.11154193e-03f, 2.31287768e-03f, -7.38680502e-03f, -1.17062544e-03f },
+	{ 6.17787940e-03f, -2.00924207e-03f, -5.53959282e-03f, 3.39668291e-03f },
+	{ 3.23726446e-03f, -4.45996644e-03f, -1.70223438e-03f, 5.24204969e-03f },
+	{ -3.22956828e-10f, -4.51807911e-03f, 1.72766973e-03f, 4.17339383e-03f },
+	{ -2.06632027e-03f, -2.84676021e-03f, 3.13285040e-03f, 1.59719377e-03f },
+	{ -2.39053206e-03f, -7.77471229e-04f, 2.44454923e-03f, -5.87233342e-04f },
+	{ -1.43528078e-03f, 4.66797821e-04f, 8.87211645e-04f, -1.22186809e-03f },
+	{ -2.95783597e-04f, 4.07501007e-04f, -3.94910421e-05f, -5.02053939e-04f },
+};
+
+static void fff_D_300_16000_calc (const float *x, float *sums)
+{
+	fff_calc (x, fff_D_300_16000, 99, sums);
+}
+
+/* D, 300 baud, 1600 & 1800 Hz, 32000 samples per second. */
+
+static const float fff_D_300_32000[198][4] = {
+	{ 5.71154524e-05f, 1.12209542e-04f, 3.17715021e-05f, -1.21832360e-04f },
+	{ 2.66857183e-04f, 2.67128722e-04f, -3.69970658e-05f, -3.75887292e-04f },
+	{ 5.60339540e-04f, 2.85797782e-04f, -2.74500082e-04f, -5.66306873e-04f },
+	{ 8.69379262e-04f, 1.37836643e-04f, -6.34625147e-04f, -6.10572635e-04f },
+	{ 1.11739861e-03f, -1.77157504e-04f, -1.03670103e-03f, -4.53755871e-04f },
+	{ 1.23150740e-03f, -6.28120732e-04f, -1.38001342e-03f, -8.14409068e-05f },
+	{ 1.15444371e-03f, -1.15561509e-03f, -1.56262156e-03f, 4.74317872e-04f },
+	{ 8.54726590e-04f, -1.67919754e-03f, -1.50139618e-03f, 1.13724964e-03f },
+	{ 3.33563774e-04f, -2.10817554e-03f, -1.14981714e-03f, 1.79733557e-03f },
+	{ -3.72524490e-04f, -2.35441513e-03f, -5.10446844e-04f, 2.32794136e-03f },
+	{ -1.19390537e-03f, -2.34554987e-03f, 3.60376231e-04f, 2.60715908e-03f },
+	{ -2.03476474e-03f, -2.03683763e-03f, 1.35673862e-03f, 2.53991759e-03f },
+	{ -2.78409477e-03f, -1.42001302e-03f, 2.33614771e-03f, 2.07728799e-03f },
+	{ -3.32944607e-03f, -5.27872704e-04f, 3.13966209e-03f, 1.22963672e-03f },
+	{ -3.57186073e-03f, 5.66296978e-04f, 3.61636281e-03f, 7.10686727e-05f },
+	{ -3.44009651e-03f, 1.75459147e-03f, 3.64849367e-03f, -1.26599276e-03f },
+	{ -2.90229497e-03f, 2.90523609e-03f, 3.17339157e-03f, -2.60599051e-03f },
+	{ -1.97349046e-03f, 3.87711753e-03f, 2.19850056e-03f, -3.75338946e-03f },
+	{ -7.17787945e-04f, 4.53651417e-03f, 8.06781347e-04f, -4.52068588e-03f },
+	{ 7.55367975e-04f, 4.77406755e-03f, -8.49009200e-04f, -4.75741317e-03f },
+	{ 2.30069808e-03f, 4.51996457e-03f, -2.56300461e-03f, -4.37572878e-03f },
+	{ 3.75155848e-03f, 3.75537062e-03f, -4.10197489e-03f, -3.36857047e-03f },
+	{ 4.93791234e-03f, 2.51854840e-03f, -5.23704197e-03f, -1.81722734e-03f },
+	{ 5.70587115e-03f, 9.04639543e-04f, -5.77696320e-03f, 1.13505856e-04f },
+	{ 5.93658863e-03f, -9.41218052e-04f, -5.59820049e-03f, 2.19248841e-03f },
+	{ 5.56225842e-03f, -2.83699110e-03f, -4.66733193e-03f, 4.15012939e-03f },
+	{ 4.57722694e-03f, -4.58187703e-03f, -3.05201788e-03f, 5.71355456e-03f },
+	{ 3.04267928e-03f, -5.97763481e-03f, -9.18446050e-04f, 6.64434768e-03f },
+	{ 1.08398288e-03f, -6.85088616e-03f, 1.48527347e-03f, 6.77385973e-03f },
+	{ -1.11923204e-03f, -7.07378611e-03f, 3.85807920e-03f, 6.03080541e-03f },
+	{ -3.34968953e-03f, -6.58082962e-03f, 5.88399777e-03f, 4.45693824e-03f },
+	{ -5.37409820e-03f, -5.37956599e-03f, 7.27422955e-03f, 2.20803474e-03f },
+	{ -6.96767308e-03f, -3.55381938e-03f, 7.80790485e-03f, -4.60734213e-04f },
+	{ -7.93895219e-03f, -1.25868933e-03f, 7.36562163e-03f, -3.22383991e-03f },
+	{ -8.15217849e-03f, 1.29248411e-03f, 5.95089700e-03f, -5.72533300e-03f },
+	{ -7.54468935e-03f, 3.84811009e-03f, 3.69604747e-03f, -7.62500940e-03f },
+	{ -6.13717642e-03f, 6.14340371e-03f, 8.50890705e-04f, -8.64463206e-03f },
+	{ -4.03541559e-03f, 7.92798772e-03f, -2.24474934e-03f, -8.60788301e-03f },
+	{ -1.42293132e-03f, 8.99314974e-03f, -5.20194834e-03f, -7.46857468e-03f },
+	{ 1.45499327e-03f, 9.19579342e-03f, -7.63195287e-03f, -5.32260258e-03f },
+	{ 4.31454321e-03f, 8.47636349e-03f, -9.19738878e-03f, -2.40157451e-03f },
+	{ 6.86164014e-03f, 6.86860364e-03f, -9.65890475e-03f, 9.51906084e-04f },
+	{ 8.82239826e-03f, 4.49979585e-03f, -8.91062804e-03f, 4.32471558e-03f },
+	{ 9.97258723e-03f, 1.58112065e-03f, -6.99935015e-03f, 7.28440518e-03f },
+	{ 1.01629682e-02f, -1.61127734e-03f, -4.12434014e-03f, 9.43505578e-03f },
+	{ 9.33758263e-03f, -4.76255408e-03f, -6.17088401e-04f, 1.04702944e-02f },
+	{ 7.54294870e-03f, -7.55059207e-03f, 3.09713045e-03f, 1.02164540e-02f },
+	{ 4.92678769e-03f, -9.67916381e-03f, 6.55110972e-03f, 8.65982380e-03f },
+	{ 1.72614784e-03f, -1.09094828e-02f, 9.29497834e-03f, 5.95393917e-03f },
+	{ -1.75418588e-03f, -1.10867834e-02f, 1.09551027e-02f, 2.40517850e-03f },
+	{ -5.17099164e-03f, -1.01589588e-02f, 1.12847937e-02f, -1.56186998e-03f },
+	{ -8.17679148e-03f, -8.18509981e-03f, 1.02002202e-02f, -5.45560149e-03f },
+	{ -1.04554771e-02f, -5.33274375e-03f, 7.79611152e-03f, -8.77885800e-03f },
+	{ -1.17556918e-02f, -1.86381058e-03f, 4.33882931e-03f, -1.10927084e-02f },
+	{ -1.19184377e-02f, 1.88961206e-03f, 2.36975247e-04f, -1.20746661e-02f },
+	{ -1.08958902e-02f, 5.55735920e-03f, -4.00723889e-03f, -1.15633579e-02f },
+	{ -8.75921827e-03f, 8.76809936e-03f, -7.85994530e-03f, -9.58352070e-03f },
+	{ -5.69438003e-03f, 1.11871818e-02f, -1.08232405e-02f, -6.34769024e-03f },
+	{ -1.98599021e-03f, 1.25517473e-02f, -1.24999424e-02f, -2.23365379e-03f },
+	{ 2.00931937e-03f, 1.26992483e-02f, -1.26468372e-02f, 2.25987728e-03f },
+	{ 5.89754153e-03f, 1.15863346e-02f, -1.12094162e-02f, 6.57414692e-03f },
+	{ 9.28652938e-03f, 9.29595996e-03f, -8.33314657e-03f, 1.01604480e-02f },
+	{ 1.18258959e-02f, 6.03171159e-03f, -4.34929831e-03f, 1.25503307e-02f },
+	{ 1.32434648e-02f, 2.09969818e-03f, 2.63294380e-04f, 1.34170633e-02f },
+	{ 1.33744916e-02f, -2.12045433e-03f, 4.93628811e-03f, 1.26202172e-02f },
+	{ 1.21804690e-02f, -6.21255301e-03f, 9.08232480e-03f, 1.02272481e-02f },
+	{ 9.75543540e-03f, -9.76533443e-03f, 1.21694887e-02f, 6.50891243e-03f },
+	{ 6.31891470e-03f, -1.24141537e-02f, 1.37899173e-02f, 1.90860580e-03f },
+	{ 2.19593919e-03f, -1.38786845e-02f, 1.37138516e-02f, -3.01082968e-03f },
+	{ -2.21397518e-03f, -1.39926784e-02f, 1.19219115e-02f, -7.63658294e-03f },
+	{ -6.47593290e-03f, -1.27226338e-02f, 8.61101877e-03f, -1.13827642e-02f },
+	{ -1.01629607e-02f, -1.01732938e-02f, 4.17293981e-03f, -1.37651134e-02f },
+	{ -1.28992163e-02f, -6.57916116e-03f, -8.52436468e-04f, -1.44639909e-02f },
+	{ -1.43985339e-02f, -2.28282507e-03f, -5.84320771e-03f, -1.33672636e-02f },
+	{ -1.44945486e-02f, 2.29803799e-03f, -1.01731056e-02f, -1.05874576e-02f },
+	{ -1.31590469e-02f, 6.71167485e-03f, -1.32906344e-02f, -6.45055622e-03f },
+	{ -1.05065741e-02f, 1.05172424e-02f, -1.47897583e-02f, -1.45760668e-03f },
+	{ -6.78471010e-03f, 1.33292526e-02f, -1.44630866e-02f, 3.77650280e-03f },
+	{ -2.35072779e-03f, 1.48569578e-02f, -1.23303952e-02f, 8.59930739e-03f },
+	{ 2.36300472e-03f, 1.49345836e-02f, -8.63871444e-03f, 1.24027533e-02f },
+	{ 6.89162919e-03f, 1.35393171e-02f, -3.83357634e-03f, 1.47004277e-02f },
+	{ 1.07840858e-02f, 1.07950429e-02f, 1.49513397e-03f, 1.51901357e-02f },
+	{ 1.36484848e-02f, 6.96131494e-03f, 6.68618828e-03f, 1.37938075e-02f },
+	{ 1.51918791e-02f, 2.40860158e-03f, 1.10896965e-02f, 1.06693823e-02f },
+	{ 1.52504686e-02f, -2.41789035e-03f, 1.41491070e-02f, 6.19291933e-03f },
+	{ 1.38070416e-02f, -7.04217702e-03f, 1.54720200e-02f, 9.13021795e-04f },
+	{ 1.09937694e-02f, -1.10049294e-02f, 1.48808481e-02f, -4.51694662e-03f },
+	{ 7.08005251e-03f, -1.39094936e-02f, 1.24366693e-02f, -9.42033622e-03f },
+	{ 2.44645705e-03f, -1.54619915e-02f, 8.43308400e-03f, -1.31822117e-02f },
+	{ -2.45267362e-03f, -1.55012980e-02f, 3.36069940e-03f, -1.53270056e-02f },
+	{ -7.13419169e-03f, -1.40158618e-02f, -2.15346692e-03f, -1.55791044e-02f },
+	{ -1.11342911e-02f, -1.11455964e-02f, -7.42412545e-03f, -1.38984667e-02f },
+	{ -1.40548721e-02f, -7.16858916e-03f, -1.17935147e-02f, -1.04866987e-02f },
+	{ -1.56035712e-02f, -2.47387215e-03f, -1.47141526e-02f, -5.76269999e-03f },
+	{ -1.56232668e-02f, 2.47699325e-03f, -1.58179216e-02f, -3.10825853e-04f },
+	{ -1.41081717e-02f, 7.19577167e-03f, -1.49628296e-02f, 5.19198226e-03f },
+	{ -1.12047736e-02f, 1.12161506e-02f, -1.22513724e-02f, 1.00608831e-02f },
+	{ -7.19753234e-03f, 1.41402958e-02f, -8.01815558e-03f, 1.36890532e-02f },
+	{ -2.48072529e-03f, 1.56785864e-02f, -2.78828479e-03f, 1.56238824e-02f },
+	{ 2.48072529e-03f, 1.56785864e-02f, 2.78828479e-03f, 1.56238824e-02f },
+	{ 7.19753234e-03f, 1.41402958e-02f, 8.01815558e-03f, 1.36890532e-02f },
+	{ 1.12047736e-02f, 1.12161506e-02f, 1.22513724e-02f, 1.00608831e-02f },
+	{ 1.41081717e-02f, 7.19577167e-03f, 1.49628296e-02f, 5.19198226e-03f },
+	{ 1.56232668e-02f, 2.47699325e-03f, 1.58179216e-02f, -3.10825853e-04f },
+	{ 1.56035712e-02f, -2.47387215e-03f, 1.47141526e-02f, -5.76269999e-03f },
+	{ 1.40548721e-02f, -7.16858916e-03f, 1.17935147e-02f, -1.04866987e-02f },
+	{ 1.11342911e-02f, -1.11455964e-02f, 7.42412545e-03f, -1.38984667e-02f },
+	{ 7.13419169e-03f, -1.40158618e-02f, 2.15346692e-03f, -1.55791044e-02f },
+	{ 2.45267362e-03f, -1.55012980e-02f, -3.36069940e-03f, -1.53270056e-02f },
+	{ -2.44645705e-03f, -1.54619915e-02f, -8.43308400e-03f, -1.31822117e-02f },
+	{ -7.08005251e-03f, -1.39094936e-02f, -1.24366693e-02f, -9.42033622e-03f },
+	{ -1.09937694e-02f, -1.10049294e-02f, -1.48808481e-02f, -4.51694662e-03f },
+	{ -1.38070416e-02f, -7.04217702e-03f, -1.54720200e-02f, 9.13021795e-04f },
+	{ -1.52504686e-02f, -2.41789035e-03f, -1.41491070e-02f, 6.19291933e-03f },
+	{ -1.51918791e-02f, 2.40860158e-03f, -1.10896965e-02f, 1.06693823e-02f },
+	{ -1.36484848e-02f, 6.96131494e-03f, -6.68618828e-03f, 1.37938075e-02f },
+	{ -1.07840858e-02f, 1.07950429e-02f, -1.49513397e-03f, 1.51901357e-02f },
+	{ -6.89162919e-03f, 1.35393171e-02f, 3.83357634e-03f, 1.47004277e-02f },
+	{ -2.36300472e-03f, 1.49345836e-02f, 8.63871444e-03f, 1.24027533e-02f },
+	{ 2.35072779e-03f, 1.48569578e-02f, 1.23303952e-02f, 8.59930739e-03f },
+	{ 6.78471010e-03f, 1.33292526e-02f, 1.44630866e-02f, 3.77650280e-03f },
+	{ 1.05065741e-02f, 1.05172424e-02f, 1.47897583e-02f, -1.45760668e-03f },
+	{ 1.31590469e-02f, 6.71167485e-03f, 1.32906344e-02f, -6.45055622e-03f },
+	{ 1.44945486e-02f, 2.29803799e-03f, 1.01731056e-02f, -1.05874576e-02f },
+	{ 1.43985339e-02f, -2.28282507e-03f, 5.84320771e-03f, -1.33672636e-02f },
+	{ 1.28992163e-02f, -6.57916116e-03f, 8.52436468e-04f, -1.44639909e-02f },
+	{ 1.01629607e-02f, -1.01732938e-02f, -4.17293981e-03f, -1.37651134e-02f },
+	{ 6.47593290e-03f, -1.27226338e-02f, -8.61101877e-03f, -1.13827642e-02f },
+	{ 2.21397518e-03f, -1.39926784e-02f, -1.19219115e-02f, -7.63658294e-03f },
+	{ -2.19593919e-03f, -1.38786845e-02f, -1.37138516e-02f, -3.01082968e-03f },
+	{ -6.31891470e-03f, -1.24141537e-02f, -1.37899173e-02f, 1.90860580e-03f },
+	{ -9.75543540e-03f, -9.76533443e-03f, -1.21694887e-02f, 6.50891243e-03f },
+	{ -1.21804690e-02f, -6.21255301e-03f, -9.08232480e-03f, 1.02272481e-02f },
+	{ -1.33744916e-02f, -2.12045433e-03f, -4.93628811e-03f, 1.26202172e-02f },
+	{ -1.32434648e-02f, 2.09969818e-03f, -2.63294380e-04f, 1.34170633e-02f },
+	{ -1.18258959e-02f, 6.03171159e-03f, 4.34929831e-03f, 1.25503307e-02f },
+	{ -9.28652938e-03f, 9.29595996e-03f, 8.33314657e-03f, 1.01604480e-02f },
+	{ -5.89754153e-03f, 1.15863346e-02f, 1.12094162e-02f, 6.57414692e-03f },
+	{ -2.00931937e-03f, 1.26992483e-02f, 1.26468372e-02f, 2.25987728e-03f },
+	{ 1.98599021e-03f, 1.25517473e-02f, 1.24999424e-02f, -2.23365379e-03f },
+	{ 5.69438003e-03f, 1.11871818e-02f, 1.08232405e-02f, -6.34769024e-03f },
+	{ 8.75921827e-03f, 8.76809936e-03f, 7.85994530e-03f, -9.58352070e-03f },
+	{ 1.08958902e-02f, 5.55735920e-03f, 4.00723889e-03f, -1.15633579e-02f },
+	{ 1.19184377e-02f, 1.88961206e-03f, -2.36975247e-04f, -1.20746661e-02f },
+	{ 1.17556918e-02f, -1.86381058e-03f, -4.33882931e-03f, -1.10927084e-02f },
+	{ 1.04554771e-02f, -5.33274375e-03f, -7.79611152e-03f, -8.77885800e-03f },
+	{ 8.17679148e-03f, -8.18509981e-03f, -1.02002202e-02f, -5.45560149e-03f },
+	{ 5.17099164e-03f, -1.01589588e-02f, -1.12847937e-02f, -1.56186998e-03f },
+	{ 1.75418588e-03f, -1.10867834e-02f, -1.09551027e-02f, 2.40517850e-03f },
+	{ -1.72614784e-03f, -1.09094828e-02f, -9.29497834e-03f, 5.95393917e-03f },
+	{ -4.92678769e-03f, -9.67916381e-03f, -6.55110972e-03f, 8.65982380e-03f },
+	{ -7.54294870e-03f, -7.55059207e-03f, -3.09713045e-03f, 1.02164540e-02f },
+	{ -9.33758263e-03f, -4.76255408e-03f, 6.17088401e-04f, 1.04702944e-02f },
+	{ -1.01629682e-02f, -1.61127734e-03f, 4.12434014e-03f, 9.43505578e-03f },
+	{ -9.97258723e-03f, 1.58112065e-03f, 6.99935015e-03f, 7.28440518e-03f },
+	{ -8.82239826e-03f, 4.49979585e-03f, 8.91062804e-03f, 4.32471558e-03f },
+	{ -6.86164014e-03f, 6.86860364e-03f, 9.65890475e-03f, 9.51906084e-04f },
+	{ -4.31454321e-03f, 8.47636349e-03f, 9.19738878e-03f, -2.40157451e-03f },
+	{ -1.45499327e-03f, 9.19579342e-03f, 7.63195287e-03f, -5.32260258e-03f },
+	{ 1.42293132e-03f, 8.99314974e-03f, 5.20194834e-03f, -7.46857468e-03f },
+	{ 4.03541559e-03f, 7.92798772e-03f, 2.24474934e-03f, -8.60788301e-03f },
+	{ 6.13717642e-03f, 6.14340371e-03f, -8.50890705e-04f, -8.64463206e-03f },
+	{ 7.54468935e-03f, 3.84811009e-03f, -3.69604747e-03f, -7.62500940e-03f },
+	{ 8.15217849e-03f, 1.29248411e-03f, -5.95089700e-03f, -5.72533300e-03f },
+	{ 7.93895219e-03f, -1.25868933e-03f, -7.36562163e-03f, -3.22383991e-03f },
+	{ 6.96767308e-03f, -3.55381938e-03f, -7.80790485e-03f, -4.60734213e-04f },
+	{ 5.37409820e-03f, -5.37956599e-03f, -7.27422955e-03f, 2.20803474e-03f },
+	{ 3.34968953e-03f, -6.58082962e-03f, -5.88399777e-03f, 4.45693824e-03f },
+	{ 1.11923204e-03f, -7.07378611e-03f, -3.85807920e-03f, 6.03080541e-03f },
+	{ -1.08398288e-03f, -6.85088616e-03f, -1.48527347e-03f, 6.77385973e-03f },
+	{ -3.04267928e-03f, -5.97763481e-03f, 9.18446050e-04f, 6.64434768e-03f },
+	{ -4.57722694e-03f, -4.58187703e-03f, 3.05201788e-03f, 5.71355456e-03f },
+	{ -5.56225842e-03f, -2.83699110e-03f, 4.66733193e-03f, 4.15012939e-03f },
+	{ -5.93658863e-03f, -9.41218052e-04f, 5.59820049e-03f, 2.19248841e-03f },
+	{ -5.70587115e-03f, 9.04639543e-04f, 5.77696320e-03f, 1.13505856e-04f },
+	{ -4.93791234e-03f, 2.51854840e-03f, 5.23704197e-03f, -1.81722734e-03f },
+	{ -3.75155848e-03f, 3.75537062e-03f, 4.10197489e-03f, -3.36857047e-03f },
+	{ -2.30069808e-03f, 4.51996457e-03f, 2.56300461e-03f, -4.37572878e-03f },
+	{ -7.55367975e-04f, 4.77406755e-03f, 8.49009200e-04f, -4.75741317e-03f },
+	{ 7.17787945e-04f, 4.53651417e-03f, -8.06781347e-04f, -4.52068588e-03f },
+	{ 1.97349046e-03f, 3.87711753e-03f, -2.19850056e-03f, -3.75338946e-03f },
+	{ 2.90229497e-03f, 2.90523609e-03f, -3.17339157e-03f, -2.60599051e-03f },
+	{ 3.44009651e-03f, 1.75459147e-03f, -3.64849367e-03f, -1.26599276e-03f },
+	{ 3.57186073e-03f, 5.66296978e-04f, -3.61636281e-03f, 7.10686727e-05f },
+	{ 3.32944607e-03f, -5.27872704e-04f, -3.13966209e-03f, 1.22963672e-03f },
+	{ 2.78409477e-03f, -1.42001302e-03f, -2.33614771e-03f, 2.07728799e-03f },
+	{ 2.03476474e-03f, -2.03683763e-03f, -1.35673862e-03f, 2.53991759e-03f },
+	{ 1.19390537e-03f, -2.34554987e-03f, -3.60376231e-04f, 2.60715908e-03f },
+	{ 3.72524490e-04f, -2.35441513e-03f, 5.10446844e-04f, 2.32794136e-03f },
+	{ -3.33563774e-04f, -2.10817554e-03f, 1.14981714e-03f, 1.79733557e-03f },
+	{ -8.54726590e-04f, -1.67919754e-03f, 1.50139618e-03f, 1.13724964e-03f },
+	{ -1.15444371e-03f, -1.15561509e-03f, 1.56262156e-03f, 4.74317872e-04f },
+	{ -1.23150740e-03f, -6.28120732e-04f, 1.38001342e-03f, -8.14409068e-05f },
+	{ -1.11739861e-03f, -1.77157504e-04f, 1.03670103e-03f, -4.53755871e-04f },
+	{ -8.69379262e-04f, 1.37836643e-04f, 6.34625147e-04f, -6.10572635e-04f },
+	{ -5.60339540e-04f, 2.85797782e-04f, 2.74500082e-04f, -5.66306873e-04f },
+	{ -2.66857183e-04f, 2.67128722e-04f, 3.69970658e-05f, -3.75887292e-04f },
+	{ -5.71154524e-05f, 1.12209542e-04f, -3.17715021e-05f, -1.21832360e-04f },
+};
+
+static void fff_D_300_32000_calc (const float *x, float *sums)
+{
+	fff_calc (x, fff_D_300_32000, 198, sums);
+}
+
+
+static const struct fff_kernel_s fff_kernel[] = {
+	{ 'A', 44100, 1200, 1200, 2200, 52, fff_A_1200_44100, fff_A_1200_44100_calc },
+	{ 'B', 44100, 1200, 1200, 2200, 52, fff_B_1200_44100, fff_B_1200_44100_calc },
+	{ 'C', 44100, 1200, 1200, 2200, 76, fff_C_1200_44100, fff_C_1200_44100_calc },
+	{ 'F', 44100, 1200, 1200, 2200, 52, fff_F_1200_44100, fff_F_1200_44100_calc },
+	{ 'A', 48000, 1200, 1200, 2200, 57, fff_A_1200_48000, fff_A_1200_48000_calc },
+	{ 'B', 48000, 1200, 1200, 2200, 57, fff_B_1200_48000, fff_B_1200_48000_calc },
+	{ 'C', 48000, 1200, 1200, 2200, 83, fff_C_1200_48000, fff_C_1200_48000_calc },
+	{ 'F', 48000, 1200, 1200, 2200, 57, fff_F_1200_48000, fff_F_1200_48000_calc },
+	{ 'A', 96000, 1200, 1200, 2200, 113, fff_A_1200_96000, fff_A_1200_96000_calc },
+	{ 'B', 96000, 1200, 1200, 2200, 113, fff_B_1200_96000, fff_B_1200_96000_calc },
+	{ 'C', 96000, 1200, 1200, 2200, 165, fff_C_1200_96000, fff_C_1200_96000_calc },
+	{ 'F', 96000, 1200, 1200, 2200, 113, fff_F_1200_96000, fff_F_1200_96000_calc },
+	{ 'E', 44100, 1200, 1200, 2200, 74, fff_E_1200_44100, fff_E_1200_44100_calc },
+	{ 'E', 48000, 1200, 1200, 2200, 81, fff_E_1200_48000, fff_E_1200_48000_calc },
+	{ 'E', 14700, 1200, 1200, 2200, 25, fff_E_1200_14700, fff_E_1200_14700_calc },
+	{ 'E', 16000, 1200, 1200, 2200, 27, fff_E_1200_16000, fff_E_1200_16000_calc },
+	{ 'E', 32000, 1200, 1200, 2200, 54, fff_E_1200_32000, fff_E_1200_32000_calc },
+	{ 'D', 14700, 300, 1600, 1800, 91, fff_D_300_14700, fff_D_300_14700_calc },
+	{ 'D', 16000, 300, 1600, 1800, 99, fff_D_300_16000, fff_D_300_16000_calc },
+	{ 'D', 32000, 300, 1600, 1800, 198, fff_D_300_32000, fff_D_300_32000_calc },
+};
+
+#define FFF_NUM_KERNELS 20
@@ -130,14 +130,8 @@ static int save_bit[MAX_CHANS];
  * For low pass filtering of 9600 baud data. 
  */
 
-/* Add sample to buffer and shift the rest down. */
-// TODO:  Can we have one copy of these in dsp.h?
-
-static inline void push_sample (float val, float *buff, int size)
-{
-	memmove(buff+1,buff,(size-1)*sizeof(float));
-	buff[0] = val; 
-}
+/* push_sample() is now shared with the demodulators.  See dsp.h. */
+// TODO:  Can we have one copy of convolve in dsp.h too?
 
 
 /* FIR filter kernel. */
@@ -154,7 +148,7 @@ static inline float convolve (const float *data, const float *filter, int filter
 }
 
 static int lp_filter_size[MAX_CHANS];
-static float raw[MAX_CHANS][MAX_FILTER_SIZE] __attribute__((aligned(16)));
+static struct delay_line_s raw[MAX_CHANS];
 static float lp_filter[MAX_CHANS][MAX_FILTER_SIZE] __attribute__((aligned(16)));
 static int resample[MAX_CHANS];
 
@@ -363,6 +357,7 @@ int gen_tone_init (struct audio_s *audio_config_p, int amp, int gen_packets)
 	    //dw_printf ("gen_tone_init: chan %d, call gen_lowpass(fc=%.2f, , size=%d, )\n", chan, fc, lp_filter_size[chan]);
 
 	    gen_lowpass (fc, lp_filter[chan], lp_filter_size[chan], BP_WINDOW_HAMMING);
+	    memset (&(raw[chan]), 0, sizeof(raw[chan]));
 
 	  }
 	}
@@ -507,12 +502,12 @@ void tone_gen_put_bit (int chan, int dat)
 
 	      /* version 1.2 - added a low pass filter instead of square wave out. */
 
-	      push_sample (fsam, raw[chan], lp_filter_size[chan]);
+	      push_sample (fsam, &(raw[chan]), lp_filter_size[chan]);
 
 	      resample[chan]++;
 	      if (resample[chan] >= UPSAMPLE) {
 
-	        sam = (int) convolve (raw[chan], lp_filter[chan], lp_filter_size[chan]);
+	        sam = (int) convolve (delay_line(&(raw[chan])), lp_filter[chan], lp_filter_size[chan]);
 	        resample[chan] = 0;
 	        gen_tone_put_sample (chan, a, sam);
 	      }
@@ -30,6 +30,7 @@
 #include "direwolf.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <assert.h>
 #include <string.h>
 
@@ -108,12 +109,18 @@ struct hdlc_state_s {
 					
 };
 
-static struct hdlc_state_s hdlc_state[MAX_CHANS][MAX_SUBCHANS][MAX_SLICERS];
+// Version 1.5:  Allocated only for the slicers in use.
+
+static struct hdlc_state_s *hdlc_state[MAX_CHANS][MAX_SUBCHANS][MAX_SLICERS];
 
 static int num_subchan[MAX_CHANS];		//TODO1.2 use ptr rather than copy.
 
 static int composite_dcd[MAX_CHANS][MAX_SUBCHANS+1];
 
+// Version 1.5:  Demodulators for a channel can now run in different threads.
+
+static dw_mutex_t dcd_mutex;
+
 
 /***********************************************************************************
  *
@@ -138,6 +145,7 @@ void hdlc_rec_init (struct audio_s *pa)
 	assert (pa != NULL);
 	
 	memset (composite_dcd, 0, sizeof(composite_dcd));
+	dw_mutex_init (&dcd_mutex);
 
 	for (ch = 0; ch < MAX_CHANS; ch++)
 	{
@@ -148,17 +156,25 @@ void hdlc_rec_init (struct audio_s *pa)
 
 	    assert (num_subchan[ch] >= 1 && num_subchan[ch] <= MAX_SUBCHANS);
 
+	    assert (pa->achan[ch].num_slicers >= 1 && pa->achan[ch].num_slicers <= MAX_SLICERS);
+
 	    for (sub = 0; sub < num_subchan[ch]; sub++)
 	    {
-	      for (slice = 0; slice < MAX_SLICERS; slice++) {
-
-	        H = &hdlc_state[ch][sub][slice];
+	      for (slice = 0; slice < pa->achan[ch].num_slicers; slice++) {
+
+	        if (hdlc_state[ch][sub][slice] == NULL) {
+	          hdlc_state[ch][sub][slice] = malloc (sizeof(struct hdlc_state_s));
+	          if (hdlc_state[ch][sub][slice] == NULL) {
+	            text_color_set(DW_COLOR_ERROR);
+	            dw_printf ("FATAL: Out of memory for HDLC decoder.\n");
+	            exit (1);
+	          }
+	        }
+	        H = hdlc_state[ch][sub][slice];
+	        memset (H, 0, sizeof(struct hdlc_state_s));
 
 	        H->olen = -1;
 
-		// TODO: FIX13 wasteful if not needed.
-		// Should loop on number of slicers, not max.
-
 	        H->rrbb = rrbb_new(ch, sub, slice, pa->achan[ch].modem_type == MODEM_SCRAMBLE, H->lfsr, H->prev_descram);
 	      }
 	    }
@@ -187,7 +203,9 @@ void hdlc_rec_init (struct audio_s *pa)
  *	
  *		is_scrambled - Is the data scrambled?
  *
- *		descram_state - Current descrambler state.  (not used - remove)
+ *		conf	- Version 1.5:  How sure the demodulator is about the bit.
+ *			  0 for a coin toss up to 255 for certain.
+ *			  This replaces the descrambler state which wasn't used.
  *					
  *
  * Description:	This is called once for each received bit.
@@ -196,9 +214,7 @@ void hdlc_rec_init (struct audio_s *pa)
  *
  ***********************************************************************************/
 
-// TODO: int not_used_remove
-
-void hdlc_rec_bit (int chan, int subchan, int slice, int raw, int is_scrambled, int not_used_remove)
+void hdlc_rec_bit (int chan, int subchan, int slice, int raw, int is_scrambled, int conf)
 {
 
 	int dbit;			/* Data bit after undoing NRZI. */
@@ -215,7 +231,8 @@ void hdlc_rec_bit (int chan, int subchan, int slice, int raw, int is_scrambled,
 /*
  * Different state information for each channel / subchannel / slice.
  */
-	H = &hdlc_state[chan][subchan][slice];
+	H = hdlc_state[chan][subchan][slice];
+	assert (H != NULL);
 
 /*
  * Using NRZI encoding,
@@ -339,7 +356,7 @@ void hdlc_rec_bit (int chan, int subchan, int slice, int raw, int is_scrambled,
  */
 
 
-	rrbb_append_bit (H->rrbb, raw);
+	rrbb_append_bit (H->rrbb, raw, conf);
 
 	if (H->pat_det == 0x7e) {
 
@@ -431,7 +448,7 @@ void hdlc_rec_bit (int chan, int subchan, int slice, int raw, int is_scrambled,
 	  H->frame_len = 0;
 
 
-	  rrbb_append_bit (H->rrbb, H->prev_raw); /* Last bit of flag.  Needed to get first data bit. */
+	  rrbb_append_bit (H->rrbb, H->prev_raw, 255); /* Last bit of flag.  Needed to get first data bit. */
 						/* Now that we are saving other initial state information, */
 						/* it would be sensible to do the same for this instead */
 						/* of lumping it in with the frame data bits. */
@@ -482,6 +499,15 @@ void hdlc_rec_bit (int chan, int subchan, int slice, int raw, int is_scrambled,
 	  rrbb_clear (H->rrbb, is_scrambled, H->lfsr, H->prev_descram); 
 
 	}
+
+/*
+ * Version 1.5:  The new way collects only the raw bits here.
+ * Unstuffing and building octets is left for hdlc_rec2, where it is
+ * done 8 bits at a time, so don't spend time on it for every bit
+ * of every slicer.
+ */
+
+#if OLD_WAY
 	else if ( (H->pat_det & 0xfc) == 0x7c ) {
 
 /*
@@ -518,6 +544,7 @@ void hdlc_rec_bit (int chan, int subchan, int slice, int raw, int is_scrambled,
 	    }
 	  }
 	}
+#endif
 }
 
 
@@ -556,12 +583,60 @@ int hdlc_rec_gathering (int chan, int subchan, int slice)
 	// olen>=0		992	985
 	// OR-ed		992	985
 
-	return ( hdlc_state[chan][subchan][slice].data_detect );
+	return ( hdlc_state[chan][subchan][slice]->data_detect );
 
 } /* end hdlc_rec_gathering */
 
 
 
+/*-------------------------------------------------------------------
+ *
+ * Name:        hdlc_rec_slicer_idle
+ *
+ * Purpose:     Version 1.5:  Forget about anything in progress when a
+ *		slicer is taken out of service.  See governor in multi_modem.c.
+ *
+ * Inputs:	chan
+ *		subchan
+ *		slice
+ *
+ * Description:	hdlc_rec_bit won't be called for this slicer again until
+ *		it is put back in service.  Don't leave DCD stuck on or
+ *		a partial frame that would be continued with unrelated bits.
+ *
+ *		Must be called from the thread doing the demodulation
+ *		for the subchannel, between blocks of audio.
+ *
+ *--------------------------------------------------------------------*/
+
+void hdlc_rec_slicer_idle (int chan, int subchan, int slice)
+{
+	struct hdlc_state_s *H;
+
+	assert (chan >= 0 && chan < MAX_CHANS);
+	assert (subchan >= 0 && subchan < MAX_SUBCHANS);
+	assert (slice >= 0 && slice < MAX_SLICERS);
+
+	H = hdlc_state[chan][subchan][slice];
+	if (H == NULL) {
+	  return;
+	}
+
+	if (H->data_detect) {
+	  H->data_detect = 0;
+	  dcd_change (chan, subchan, slice, 0);
+	}
+
+	H->pat_det = 0;
+	H->flag4_det = 0;
+	H->olen = -1;
+	H->frame_len = 0;
+
+	rrbb_clear (H->rrbb, rrbb_get_is_scrambled(H->rrbb), H->lfsr, H->prev_descram);
+}
+
+
+
 /*-------------------------------------------------------------------
  *
  * Name:        dcd_change
@@ -586,6 +661,9 @@ int hdlc_rec_gathering (int chan, int subchan, int slice)
  * version 1.3:	Add DTMF detection into the final result.
  *		This is now called from dtmf.c too.
  *
+ * Version 1.5:	The demodulators for a channel can be in different threads
+ *		so we need a lock around the update.
+ *
  *--------------------------------------------------------------------*/
 
 void dcd_change (int chan, int subchan, int slice, int state)
@@ -602,6 +680,8 @@ void dcd_change (int chan, int subchan, int slice, int state)
 	dw_printf ("DCD %d.%d.%d = %d \n", chan, subchan, slice, state);
 #endif
 
+	dw_mutex_lock (&dcd_mutex);
+
 	old = hdlc_rec_data_detect_any(chan);
 
 	if (state) {
@@ -616,6 +696,8 @@ void dcd_change (int chan, int subchan, int slice, int state)
 	if (new != old) {
 	  ptt_set (OCTYPE_DCD, chan, new);
 	}
+
+	dw_mutex_unlock (&dcd_mutex);
 }
 
 
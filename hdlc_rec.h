@@ -5,7 +5,7 @@
 
 void hdlc_rec_init (struct audio_s *pa);
 
-void hdlc_rec_bit (int chan, int subchan, int slice, int raw, int is_scrambled, int descram_state);
+void hdlc_rec_bit (int chan, int subchan, int slice, int raw, int is_scrambled, int conf);
 
 /* Provided elsewhere to process a complete frame. */
 
@@ -18,6 +18,10 @@ void hdlc_rec_bit (int chan, int subchan, int slice, int raw, int is_scrambled,
 
 int hdlc_rec_gathering (int chan, int subchan, int slice);
 
+/* Version 1.5:  Slicer is being taken out of service. */
+
+void hdlc_rec_slicer_idle (int chan, int subchan, int slice);
+
 /* Transmit needs to know when someone else is transmitting. */
 
 void dcd_change (int chan, int subchan, int slice, int state);
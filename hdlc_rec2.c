@@ -82,6 +82,21 @@
  *		Took out the delayed processing and just do it realtime.
  *		Changed SWAP to INVERT because it is more descriptive.
  *
+ * Version 1.5:	Use the CRC syndrome to find which bits might need to be
+ *		inverted rather than decoding the whole frame again for
+ *		every possibility.  See syndrome_init.
+ *		A full decode is now needed only to confirm a likely fix
+ *		or when inverting bits would change the bit stuffing.
+ *		Inverting two separated bits was order N**3 and is now
+ *		about order N**2 with a very small constant.
+ *
+ *		The first decoding attempt saves the decoder state every
+ *		so often.  Later attempts start from the last one before
+ *		the first inverted bit rather than the beginning.
+ *
+ *		The search for two separated bits can be shared by
+ *		several threads.  See try_two_sep.
+ *
  *******************************************************************************/
 
 #include "direwolf.h"
@@ -90,6 +105,11 @@
 #include <assert.h>
 #include <ctype.h>
 #include <string.h>
+#include <stdlib.h>
+
+#if __WIN32__
+#include <process.h>
+#endif
 
 //Optimize processing by accessing directly to decoded bits
 #define RRBB_C 1
@@ -100,6 +120,7 @@
 #include "rrbb.h"
 #include "rdq.h"
 #include "multi_modem.h"
+#include "demod.h"
 #include "dtime_now.h"
 #include "demod_9600.h"		/* for descramble() */
 #include "audio.h"		/* for struct audio_s */
@@ -143,14 +164,15 @@ struct hdlc_state_s {
 	int prev_descram;		/* Previous unscrambled for 9600 baud. */
 
 
-	unsigned char pat_det; 		/* 8 bit pattern detector shift register. */
-					/* See below for more details. */
+	int ones;			/* Version 1.5:  Number of 1 data bits in a row, */
+					/* 0 .. 6.  Replaces the 8 bit pattern detector. */
 
-	unsigned char oacc;		/* Accumulator for building up an octet. */
+	unsigned int oacc;		/* Accumulator for building up an octet. */
+					/* Version 1.5:  First bit is now in the LSB. */
 
 	int olen;			/* Number of bits in oacc. */
-					/* When this reaches 8, oacc is copied */
-					/* to the frame buffer and olen is zeroed. */
+					/* When this reaches 8, the low 8 bits are copied */
+					/* to the frame buffer and removed. */
 
 	unsigned char frame_buf[MAX_FRAME_LEN];
 					/* One frame is kept here. */
@@ -158,16 +180,128 @@ struct hdlc_state_s {
 	int frame_len;			/* Number of octets in frame_buf. */
 					/* Should be in range of 0 .. MAX_FRAME_LEN. */
 
+	unsigned short fcs;		/* Version 1.5:  Running FCS of frame_buf. */
+
+	int fcs_len;			/* Version 1.5:  Number of octets included in fcs. */
+					/* Brought up to date only when needed so */
+					/* fcs_update can take many at once. */
+
+};
+
+
+/*
+ * Version 1.5:  Decoder state saved during the first attempt so later
+ * attempts don't need to start over from the beginning.
+ * Everything in hdlc_state_s except for frame_buf.  The octets before
+ * the checkpoint can't be different so we need only one copy.
+ */
+
+#define CHECKPOINT_INTERVAL 64		/* Bits between checkpoints. */
+
+struct checkpoints_s {
+
+	int count;			/* Number saved.  Checkpoint n is the state */
+					/* before bit 1 + n * CHECKPOINT_INTERVAL. */
+	struct {
+	  int prev_raw;
+	  int lfsr;
+	  int prev_descram;
+	  int ones;
+	  unsigned int oacc;
+	  int olen;
+	  int frame_len;
+	  unsigned short fcs;
+	} state[MAX_NUM_BITS / CHECKPOINT_INTERVAL + 1];
+
+	unsigned char frame_buf[MAX_FRAME_LEN];
 };
 
 
-static int try_decode (rrbb_t block, int chan, int subchan, int slice, alevel_t alevel, retry_conf_t retry_conf, int passall);
+static int try_decode (rrbb_t block, int chan, int subchan, int slice, alevel_t alevel, retry_conf_t retry_conf, int passall, struct checkpoints_s *cp, int deliver);
 
-static int try_to_fix_quick_now (rrbb_t block, int chan, int subchan, int slice, alevel_t alevel);
+static int try_to_fix_quick_now (rrbb_t block, int chan, int subchan, int slice, alevel_t alevel, struct checkpoints_s *cp);
 
 static int sanity_check (unsigned char *buf, int blen, retry_t bits_flipped, enum sanity_e sanity_test);
 
 
+/*
+ * Version 1.5:  What we know about a block of bits, as received, for 
+ * quickly finding which bits could be inverted to get a good CRC.
+ *
+ * The CRC is linear.  If the frame structure doesn't change, inverting
+ * some bits changes the CRC "syndrome" (calculated FCS xor received FCS)
+ * by the xor of a value for each bit.  We just need to find bits that
+ * change it to zero.
+ *
+ * The hard part is that inverting a bit on the radio channel can change
+ * the frame structure.  It can add or remove a stuffed bit, shifting
+ * everything after it, or create a flag or abort pattern.
+ * We keep track of what was done with each bit so we can tell when 
+ * that happens.  In that case we need to decode the whole thing again.
+ */
+
+enum stuff_e { STUFF_KEEP = 0, STUFF_REMOVE, STUFF_FLAG, STUFF_ABORT };
+
+struct syndrome_s {
+
+	int blen;			/* Number of bits in block. */
+
+	int is_scrambled;		/* Set for 9600 baud. */
+
+	int ok;				/* Frame has whole number of octets, is long */
+					/* enough, and has no flag or abort pattern. */
+					/* Otherwise the syndrome is not meaningful. */
+
+	unsigned short syn;		/* Calculated FCS xor received FCS. */
+					/* Zero would mean it is good. */
+
+	int nkeep;			/* Number of bits kept after removing stuffing. */
+
+	int ntrouble;			/* Number of flag or abort patterns found. */
+
+	unsigned char dbit[MAX_NUM_BITS];	/* After NRZI decoding and descrambling. */
+
+	unsigned char pat_det[MAX_NUM_BITS];	/* Pattern detector before this bit. */
+
+	unsigned char stuff[MAX_NUM_BITS];	/* What was done with this bit.  enum stuff_e. */
+
+	unsigned short bit_syn[MAX_NUM_BITS];	/* Change to syndrome if this bit is inverted. */
+};
+
+static void syndrome_init (struct syndrome_s *S, rrbb_t block, int invert);
+
+/* Effect of inverting some bits.  See syndrome_flip. */
+
+struct flip_s {
+	unsigned short syn;		/* Change to syndrome if structure doesn't change. */
+	short dkeep;			/* Change to number of bits kept. */
+	short dtrouble;			/* Change to number of flag or abort patterns. */
+};
+
+static int syndrome_flip (struct syndrome_s *S, const int *raw, int nraw, struct flip_s *f);
+
+static int structure_ok (struct syndrome_s *S, int dkeep, int dtrouble);
+
+static int syndrome_candidate (struct syndrome_s *S, const int *raw, int nraw);
+
+/*
+ * Inverting one raw bit inverts 2 data bits after NRZI decoding or
+ * up to 6 for 9600 baud with the descrambler.  Those can change what
+ * is done with the next 7 bits because the pattern detector is 8 bits.
+ * Bits farther apart than this don't affect each other.
+ */
+
+#define NEAR_BITS(S) (((S)->is_scrambled ? 18 : 1) + 7)
+
+static int try_two_sep (rrbb_t block, int chan, int subchan, int slice, alevel_t alevel, struct syndrome_s *base, struct checkpoints_s *cp);
+
+static void fix_pool_init (int num_helpers);
+
+static int try_low_confidence (rrbb_t block, int chan, int subchan, int slice, alevel_t alevel, struct syndrome_s *base, struct checkpoints_s *cp, int budget);
+
+static void deframe_init (void);
+
+
 /***********************************************************************************
  *
  * Name:	hdlc_rec2_init
@@ -193,17 +327,62 @@ static int sanity_check (unsigned char *buf, int blen, retry_t bits_flipped, enu
  *					Allow thru even with bad CRC after exhausting
  *					all fixup attempts.
  *
+ *				int fix_threads;
+ *					Version 1.5:  Number of threads to share
+ *					the search for two separated bits.
+ *
  * Description:	Save pointer to configuration for later use.
+ *		Start the threads for fixing frames if any channel wants them.
  *
  ***********************************************************************************/
 
 void hdlc_rec2_init (struct audio_s *p_audio_config)
 {
+	int chan;
+	int n = 1;
+
 	save_audio_config_p = p_audio_config;
+
+	deframe_init ();
+
+/*
+ * Version 1.5:  One pool of threads for searching for two separated
+ * bits is shared by all channels.  Size it for the one wanting the most.
+ */
+	for (chan = 0; chan < MAX_CHANS; chan++) {
+	  if (p_audio_config->achan[chan].valid &&
+	      p_audio_config->achan[chan].fix_bits >= RETRY_INVERT_TWO_SEP &&
+	      p_audio_config->achan[chan].fix_threads > n) {
+	    n = p_audio_config->achan[chan].fix_threads;
+	  }
+	}
+
+	fix_pool_init (n - 1);
 }
 
 
 
+/*
+ * Version 1.5:  Frames waiting to be fixed until the whole block of audio
+ * has been demodulated.  See hdlc_rec2_block.
+ *
+ * Each subchannel is demodulated, and its frames fixed, by only one thread
+ * so its list needs no lock.
+ */
+
+struct deferred_s {
+	struct deferred_s *next;
+	rrbb_t block;
+	int block_pos;			/* Where it was received in the audio block. */
+	struct checkpoints_s cp;	/* Saved by the first attempt. */
+};
+
+static struct deferred_s *deferred_head[MAX_CHANS][MAX_SUBCHANS];
+static struct deferred_s *deferred_tail[MAX_CHANS][MAX_SUBCHANS];
+
+static void fix_block (rrbb_t block, struct checkpoints_s *cp);
+
+
 /***********************************************************************************
  *
  * Name:	hdlc_rec2_block
@@ -223,18 +402,25 @@ void hdlc_rec2_init (struct audio_s *p_audio_config)
  *
  * Version 1.2:	Now works properly for G3RUH type scrambling.
  *
+ * Version 1.5:	When there are other subchannels or slicers, a frame that
+ *		needs fixing is set aside until hdlc_rec2_fix_deferred is
+ *		called, after all of them have finished the block of audio.
+ *		Then we know whether one of them already received it.
+ *		Deciding before then would depend on which thread got there first.
+ *
  ***********************************************************************************/
 
-
 void hdlc_rec2_block (rrbb_t block)
 {
 	int chan = rrbb_get_chan(block);
 	int subchan = rrbb_get_subchan(block);
 	int slice = rrbb_get_slice(block);
 	alevel_t alevel = rrbb_get_audio_level(block);
-	retry_t fix_bits = save_audio_config_p->achan[chan].fix_bits;
+	retry_t fix_bits = multi_modem_fix_bits (chan);
 	int passall = save_audio_config_p->achan[chan].passall;
 	int ok;
+	struct deferred_s *d = NULL;
+	struct checkpoints_s *cp = NULL;
 
 #if DEBUGx
 	text_color_set(DW_COLOR_DEBUG);
@@ -257,38 +443,141 @@ void hdlc_rec2_block (rrbb_t block)
 	retry_cfg.u_bits.contig.nr_bits = 0;
 	retry_cfg.u_bits.contig.bit_idx = 0;
 
-	ok = try_decode (block, chan, subchan, slice, alevel, retry_cfg, passall & (fix_bits == RETRY_NONE));
+	if (fix_bits > RETRY_NONE) {
+	  d = malloc (sizeof(struct deferred_s));
+	  if (d == NULL) {
+	    text_color_set(DW_COLOR_ERROR);
+	    dw_printf ("FATAL: Out of memory for bit fix attempts.\n");
+	    exit (1);
+	  }
+	  cp = &(d->cp);
+	}
+
+	ok = try_decode (block, chan, subchan, slice, alevel, retry_cfg, passall & (fix_bits == RETRY_NONE), cp, 1);
 	if (ok) {
 #if DEBUG
 	  text_color_set(DW_COLOR_INFO);
 	  dw_printf ("Got it the first time.\n");
 #endif
+	 if (d != NULL) free (d);
 	 rrbb_delete (block);
 	 return;
 	}
 
+	if (fix_bits == RETRY_NONE) {
+	  rrbb_delete (block);
+	  return;
+	}
+
+	if (save_audio_config_p->achan[chan].num_subchan == 1 &&
+	    save_audio_config_p->achan[chan].num_slicers == 1) {
+	  fix_block (block, cp);
+	  free (d);
+	  return;
+	}
+
+	d->next = NULL;
+	d->block = block;
+	d->block_pos = demod_get_block_pos (chan, subchan);
+	if (deferred_head[chan][subchan] == NULL) {
+	  deferred_head[chan][subchan] = d;
+	}
+	else {
+	  deferred_tail[chan][subchan]->next = d;
+	}
+	deferred_tail[chan][subchan] = d;
+
+} /* end hdlc_rec2_block */
+
+
+/***********************************************************************************
+ *
+ * Name:	hdlc_rec2_fix_deferred
+ *
+ * Purpose:	Version 1.5:  Try to fix the frames set aside by hdlc_rec2_block.
+ *
+ * Inputs:	chan, subchan	- Called by the thread demodulating this subchannel
+ *				  after all subchannels of the channel have 
+ *				  finished the block of audio.
+ *
+ * Description:	Don't bother if another subchannel or slicer already
+ *		received the same transmission.  A fixed frame would lose out
+ *		to that one anyway.  On a strong signal this avoids nearly all
+ *		of the fix up work.  Don't let it thru for passall either.
+ *		It would just be a broken copy of a frame we already have.
+ *
+ *		Only frames received without fixing are considered so the
+ *		answer doesn't depend on the order the others are fixed in.
+ *		Everyone sees the same thing no matter how many threads.
+ *
+ ***********************************************************************************/
+
+void hdlc_rec2_fix_deferred (int chan, int subchan)
+{
+	struct deferred_s *d;
+
+	while ((d = deferred_head[chan][subchan]) != NULL) {
+
+	  deferred_head[chan][subchan] = d->next;
+
+	  demod_set_block_pos (chan, subchan, d->block_pos);
+
+	  if (multi_modem_sibling_has_frame (chan, subchan, rrbb_get_slice(d->block), rrbb_get_len(d->block))) {
+#if DEBUG
+	    text_color_set(DW_COLOR_INFO);
+	    dw_printf ("Sibling already has it, not fixing.\n");
+#endif
+	    rrbb_delete (d->block);
+	  }
+	  else {
+	    fix_block (d->block, &(d->cp));
+	  }
+	  free (d);
+	}
+
+	deferred_tail[chan][subchan] = NULL;
+}
+
+
 /*
  * Not successful with frame in orginal form.
- * See if we can "fix" it.
+ * See if we can "fix" it.  The block is deleted when done.
  */
-	if (try_to_fix_quick_now (block, chan, subchan, slice, alevel)) {
+
+static void fix_block (rrbb_t block, struct checkpoints_s *cp)
+{
+	int chan = rrbb_get_chan(block);
+	int subchan = rrbb_get_subchan(block);
+	int slice = rrbb_get_slice(block);
+	alevel_t alevel = rrbb_get_audio_level(block);
+	int ok;
+
+	ok = try_to_fix_quick_now (block, chan, subchan, slice, alevel, cp);
+	if (ok) {
 	  rrbb_delete (block);
 	  return;
 	}
 
 
-	if (passall) {
+	if (save_audio_config_p->achan[chan].passall) {
 	  /* Exhausted all desired fix up attempts. */
 	  /* Let thru even with bad CRC.  Of course, it still */
 	  /* needs to be a minimum number of whole octets. */
-	  ok = try_decode (block, chan, subchan, slice, alevel, retry_cfg, 1);
+	  retry_conf_t retry_cfg;
+
+	  memset (&retry_cfg, 0, sizeof(retry_cfg));
+	  retry_cfg.type = RETRY_TYPE_NONE;
+	  retry_cfg.mode = RETRY_MODE_CONTIGUOUS;
+	  retry_cfg.retry = RETRY_NONE;
+
+	  ok = try_decode (block, chan, subchan, slice, alevel, retry_cfg, 1, NULL, 1);
 	  rrbb_delete (block);
 	}
 	else {  
 	  rrbb_delete (block); 
 	}
 
-} /* end hdlc_rec2_block */
+} /* end fix_block */
 
 
 /***********************************************************************************
@@ -308,6 +597,9 @@ void hdlc_rec2_block (rrbb_t block)
  *				RETRY_INVERT_SINGLE (1)  - Try inverting single bits.
  *				etc.
  *
+ *				Version 1.5:  Might be lowered, for a while, by
+ *				the governor in multi_modem.c when falling behind.
+ *
  *		configuration passall - Let it thru with bad CRC after exhausting
  *				all fixup attempts.
  *
@@ -328,12 +620,14 @@ void hdlc_rec2_block (rrbb_t block)
  *
  ***********************************************************************************/
 
-static int try_to_fix_quick_now (rrbb_t block, int chan, int subchan, int slice, alevel_t alevel)
+static int try_to_fix_quick_now (rrbb_t block, int chan, int subchan, int slice, alevel_t alevel, struct checkpoints_s *cp)
 {
 	int ok;
 	int len, i;
-	retry_t fix_bits = save_audio_config_p->achan[chan].fix_bits;
+	retry_t fix_bits = multi_modem_fix_bits (chan);
 	//int passall = save_audio_config_p->achan[chan].passall;
+	struct syndrome_s *base;
+	int raw[3];
 
 
 	len = rrbb_get_len(block);
@@ -353,20 +647,49 @@ static int try_to_fix_quick_now (rrbb_t block, int chan, int subchan, int slice,
 
 	  return 0;	/* failure. */
 	}
+
+/*
+ * Version 1.5:  Analyze the block once.
+ * Then try_decode is used only for changes which could possibly
+ * result in a good CRC.  It also does the sanity check.
+ */
+	base = malloc (sizeof(struct syndrome_s));
+	if (base == NULL) {
+	  text_color_set(DW_COLOR_ERROR);
+	  dw_printf ("FATAL: Out of memory for bit fix attempts.\n");
+	  exit (1);
+	}
+	syndrome_init (base, block, -1);
+
+/*
+ * Version 1.5:  Optionally, try only the bits that the demodulator
+ * was least sure about, and those first.
+ */
+	if (save_audio_config_p->achan[chan].fix_budget > 0) {
+	  ok = try_low_confidence (block, chan, subchan, slice, alevel, base, cp, save_audio_config_p->achan[chan].fix_budget);
+	  free (base);
+	  return (ok);
+	}
+
 	/* Try to swap one bit */
 	retry_cfg.type = RETRY_TYPE_SWAP;
 	retry_cfg.retry = RETRY_INVERT_SINGLE;
 	retry_cfg.u_bits.contig.nr_bits = 1;
 
 	for (i=0; i<len; i++) {
+	  raw[0] = i;
+	  if ( ! syndrome_candidate (base, raw, 1)) {
+	    continue;
+	  }
 	  /* Set the index of the bit to swap */
 	  retry_cfg.u_bits.contig.bit_idx = i;
-	  ok = try_decode (block, chan, subchan, slice, alevel, retry_cfg, 0);
+	  ok = try_decode (block, chan, subchan, slice, alevel, retry_cfg, 0, cp, 1);
 	  if (ok) {
 #if DEBUG
 	    text_color_set(DW_COLOR_ERROR);
 	    dw_printf ("*** Success by flipping SINGLE bit %d of %d ***\n", i, len);
 #endif
+	    free (base);
 	    return 1;
 	  }
 	}
@@ -375,6 +698,7 @@ static int try_to_fix_quick_now (rrbb_t block, int chan, int subchan, int slice,
  * Try inverting two adjacent bits.
  */
 	if (fix_bits < RETRY_INVERT_DOUBLE) {
+	  free (base);
 	  return 0;
 	}
 	/* Try to swap two contiguous bits */
@@ -383,13 +707,19 @@ static int try_to_fix_quick_now (rrbb_t block, int chan, int subchan, int slice,
 
 
 	for (i=0; i<len-1; i++) {
+	  raw[0] = i;
+	  raw[1] = i + 1;
+	  if ( ! syndrome_candidate (base, raw, 2)) {
+	    continue;
+	  }
 	  retry_cfg.u_bits.contig.bit_idx = i;
-	  ok = try_decode (block, chan, subchan, slice, alevel, retry_cfg, 0);
+	  ok = try_decode (block, chan, subchan, slice, alevel, retry_cfg, 0, cp, 1);
 	  if (ok) {
 #if DEBUG
 	    text_color_set(DW_COLOR_ERROR);
 	    dw_printf ("*** Success by flipping DOUBLE bit %d of %d ***\n", i, len);
 #endif
+	    free (base);
 	    return 1;
 	  }
 	}
@@ -398,6 +728,7 @@ static int try_to_fix_quick_now (rrbb_t block, int chan, int subchan, int slice,
  * Try inverting adjacent three bits.
  */
 	if (fix_bits < RETRY_INVERT_TRIPLE) {
+	  free (base);
 	  return 0;
 	}
 	/* Try to swap three contiguous bits */
@@ -405,13 +736,20 @@ static int try_to_fix_quick_now (rrbb_t block, int chan, int subchan, int slice,
 	retry_cfg.u_bits.contig.nr_bits = 3;
 
 	for (i=0; i<len-2; i++) {
+	  raw[0] = i;
+	  raw[1] = i + 1;
+	  raw[2] = i + 2;
+	  if ( ! syndrome_candidate (base, raw, 3)) {
+	    continue;
+	  }
 	  retry_cfg.u_bits.contig.bit_idx = i;
-	  ok = try_decode (block, chan, subchan, slice, alevel, retry_cfg, 0);
+	  ok = try_decode (block, chan, subchan, slice, alevel, retry_cfg, 0, cp, 1);
 	  if (ok) {
 #if DEBUG
 	    text_color_set(DW_COLOR_ERROR);
 	    dw_printf ("*** Success by flipping TRIPLE bit %d of %d ***\n", i, len);
 #endif
+	    free (base);
 	    return 1;
 	  }
 	}
@@ -422,119 +760,1468 @@ static int try_to_fix_quick_now (rrbb_t block, int chan, int subchan, int slice,
  * It chews up a lot of CPU time.  Usual test takes 4 times longer to run.
  *
  * Processing time is order N squared so time goes up rapidly with larger frames.
+ *
+ * Version 1.5:  Much better now.  See try_two_sep.
  */
 	if (fix_bits < RETRY_INVERT_TWO_SEP) {
+	  free (base);
 	  return 0;
 	}
 
-	retry_cfg.mode = RETRY_MODE_SEPARATED;
-	retry_cfg.type = RETRY_TYPE_SWAP;
-	retry_cfg.retry = RETRY_INVERT_TWO_SEP;
-	retry_cfg.u_bits.sep.bit_idx_c = -1;
-
-#ifdef DEBUG_LATER
-	tstart = dtime_now();
-	dw_printf ("*** Try flipping TWO SEPARATED BITS %d bits\n", len);
-#endif
-	len = rrbb_get_len(block);
-	for (i=0; i<len-2; i++) {
-	  retry_cfg.u_bits.sep.bit_idx_a = i;
-	  int j;
-
-	  ok = 0;
-	  for (j=i+2; j<len; j++) {
-	    retry_cfg.u_bits.sep.bit_idx_b = j;
-	    ok = try_decode (block, chan, subchan, slice, alevel, retry_cfg, 0);
-	    if (ok) {
-	      break;
-	    }
-
-	  }	  
-	  if (ok) {
-#if DEBUG
-	    text_color_set(DW_COLOR_ERROR);
-	    dw_printf ("*** Success by flipping TWO SEPARATED bits %d and %d of %d \n", i, j, len);
-#endif
-	    return (1);
-	  }
-	}
+	ok = try_two_sep (block, chan, subchan, slice, alevel, base, cp);
 
-	return 0;
+	free (base);
+	return (ok);
 }
 
 
+/***********************************************************************************
+ *
+ * Name:	try_low_confidence
+ *
+ * Purpose:	Version 1.5:  Try inverting the bits that the demodulator was
+ *		least sure about.
+ *
+ * Inputs:	block	- Stream of bits that might be a frame.
+ *		chan, subchan, slice, alevel - Passed along to try_decode.
+ *		base	- Result of syndrome_init for the block as received.
+ *		cp	- Checkpoints for try_decode.
+ *		budget	- How many possibilities to try for each technique.
+ *
+ * Returns:	1 for success.
+ *
+ * Description:	Same techniques, and in the same order, as try_to_fix_quick_now,
+ *		up to the configured fix_bits level.  Rather than trying every
+ *		position from the beginning, we rank them by confidence,
+ *		adding it up when there is more than one bit, and try only 
+ *		the lowest "budget" of them.
+ *
+ *		For two separated bits, we take pairs from the "budget" 
+ *		least confident single bits.
+ *
+ *		A bit with a wrong value usually has low confidence so this 
+ *		finds nearly all of the same frames with far fewer tries.
+ *		It is also less likely to "fix" a frame by inverting some
+ *		other bits that happen to give a good CRC.
+ *
+ ***********************************************************************************/
 
-// TODO:  Remove this.  but first figure out what to do in atest.c
+struct ranked_s {
+	short a;		/* First bit position. */
+	short b;		/* Second for separated bits. */
+	int score;		/* Sum of confidence.  Lower is tried first. */
+};
 
+static int ranked_compare (const void *p1, const void *p2)
+{
+	const struct ranked_s *x = p1;
+	const struct ranked_s *y = p2;
 
+	if (x->score != y->score) return (x->score - y->score);
+	if (x->a != y->a) return (x->a - y->a);
+	return (x->b - y->b);
+}
 
-int hdlc_rec2_try_to_fix_later (rrbb_t block, int chan, int subchan, int slice, alevel_t alevel)
+static int try_low_confidence (rrbb_t block, int chan, int subchan, int slice, alevel_t alevel, struct syndrome_s *base, struct checkpoints_s *cp, int budget)
 {
-	int ok;
-	//int len;
-	//retry_t fix_bits = save_audio_config_p->achan[chan].fix_bits;
-	int passall = save_audio_config_p->achan[chan].passall;
-#if DEBUG_LATER
-	double tstart, tend;
-#endif
-	retry_conf_t retry_cfg;
+	retry_t fix_bits = multi_modem_fix_bits (chan);
+	int len = base->blen;
+	struct ranked_s *r;
+	int nr, i, j, k;
+	int ok = 0;
+	int raw[3];
+        retry_conf_t retry_cfg;
 
 	memset (&retry_cfg, 0, sizeof(retry_cfg));
+	retry_cfg.type = RETRY_TYPE_SWAP;
 
-	//len = rrbb_get_len(block);
-
+	r = malloc ((len + budget * budget / 2) * sizeof(struct ranked_s));
+	if (r == NULL) {
+	  text_color_set(DW_COLOR_ERROR);
+	  dw_printf ("FATAL: Out of memory for bit fix attempts.\n");
+	  exit (1);
+	}
 
 /*
- * All fix up attempts have failed.  
- * Should we pass it along anyhow with a bad CRC?
- * Note that we still need a minimum number of whole octets.
+ * Inverting 1, 2, or 3 adjacent bits.
  */
-	if (passall) {
-
-	  retry_cfg.type = RETRY_TYPE_NONE;
-	  retry_cfg.mode = RETRY_MODE_CONTIGUOUS;
-	  retry_cfg.retry = RETRY_NONE;
-	  retry_cfg.u_bits.contig.nr_bits = 0;
-	  retry_cfg.u_bits.contig.bit_idx = 0;
-	  ok = try_decode (block, chan, subchan, slice, alevel, retry_cfg, passall);
-	  return (ok);
-	}
+	retry_cfg.mode = RETRY_MODE_CONTIGUOUS; 
 
-	return (0);
+	for (k = 1; k <= 3 && k <= (int)fix_bits && ! ok; k++) {
 
-}  /* end hdlc_rec2_try_to_fix_later */
+	  nr = 0;
+	  for (i = 0; i + k <= len; i++) {
+	    r[nr].a = i;
+	    r[nr].b = -1;
+	    r[nr].score = 0;
+	    for (j = 0; j < k; j++) {
+	      r[nr].score += rrbb_get_conf(block, i + j);
+	    }
+	    nr++;
+	  }
+	  qsort (r, nr, sizeof(struct ranked_s), ranked_compare);
+	  if (nr > budget) nr = budget;
 
+	  retry_cfg.retry = (retry_t)k;
+	  retry_cfg.u_bits.contig.nr_bits = k;
 
+	  for (i = 0; i < nr && ! ok; i++) {
+	    for (j = 0; j < k; j++) {
+	      raw[j] = r[i].a + j;
+	    }
+	    if (syndrome_candidate (base, raw, k)) {
+	      retry_cfg.u_bits.contig.bit_idx = r[i].a;
+	      ok = try_decode (block, chan, subchan, slice, alevel, retry_cfg, 0, cp, 1);
+	    }
+	  }
+	}
 
-/* 
- * Check if the specified index of bit has been modified with the current type of configuration
- * Provide a specific implementation for contiguous mode to optimize number of tests done in the loop 
+/*
+ * Two separated bits.  Pairs from the least confident single bits.
+ *
+ * Trying syndrome_candidate on every pair is not good enough.  When one
+ * of the bits changes the frame structure, it can only check that the 
+ * result is plausible so most of those pairs would need a full decode.
+ * Use the same tests as try_two_sep, which give the exact answer, but
+ * only for bits in the budget:
+ *
+ *	- Close together.  Check them together with syndrome_flip.
+ *	- Neither changes the frame structure.  Syndromes must cancel.
+ *	- Only one does.  Analyze the block with that one inverted,
+ *	  once, and check the others against that.
+ *	- Both do.  Check that the structure could be valid.
+ *
+ * Those found are tried in the same order as before.
  */
+	if ( ! ok && fix_bits >= RETRY_INVERT_TWO_SEP) {
+	  int near = NEAR_BITS(base);
+	  struct flip_s *f1;
+	  unsigned char *s1;
+	  struct syndrome_s *other = NULL;
+	  int n = 0;
+
+	  nr = 0;
+	  for (i = 0; i < len; i++) {
+	    r[nr].a = i;
+	    r[nr].b = -1;
+	    r[nr].score = rrbb_get_conf(block, i);
+	    nr++;
+	  }
+	  qsort (r, nr, sizeof(struct ranked_s), ranked_compare);
+	  if (nr > budget) nr = budget;
 
-inline static char is_contig_bit_modified(int bit_idx, retry_conf_t retry_conf) {
-	  int cont_bit_idx = retry_conf.u_bits.contig.bit_idx;
-	  int cont_nr_bits = retry_conf.u_bits.contig.nr_bits;
-
-	  if (bit_idx >= cont_bit_idx && (bit_idx < cont_bit_idx + cont_nr_bits )) 
-		return 1;
-	  else 
-		return 0;
-}
+	  f1 = malloc (nr * sizeof(struct flip_s));
+	  s1 = malloc (nr);
+	  if (nr > 0 && (f1 == NULL || s1 == NULL)) {
+	    text_color_set(DW_COLOR_ERROR);
+	    dw_printf ("FATAL: Out of memory for bit fix attempts.\n");
+	    exit (1);
+	  }
+	  for (i = 0; i < nr; i++) {
+	    raw[0] = r[i].a;
+	    s1[i] = syndrome_flip (base, raw, 1, &(f1[i]));
+	  }
 
-/* 
- * Check  if the specified index of bit has been modified with the current type of configuration in separated bit index mode
- * Provide a specific implementation for separated mode to optimize number of tests done in the loop 
- */
+	  for (i = 0; i < nr; i++) {
+	    for (j = i + 1; j < nr; j++) {
+	      int a = r[i].a < r[j].a ? r[i].a : r[j].a;
+	      int b = r[i].a < r[j].a ? r[j].a : r[i].a;
+	      int found;
 
-inline static char is_sep_bit_modified(int bit_idx, retry_conf_t retry_conf) {
-	  if (bit_idx == retry_conf.u_bits.sep.bit_idx_a || 
-	      bit_idx == retry_conf.u_bits.sep.bit_idx_b ||
-	      bit_idx == retry_conf.u_bits.sep.bit_idx_c)
-	    return 1;
-	  else
-	    return 0;
-}
+	      if (b - a < 2) {
+	        continue;
+	      }
+	      if (b - a <= near) {
+	        raw[0] = a;
+	        raw[1] = b;
+	        found = syndrome_candidate (base, raw, 2);
+	      }
+	      else if ( ! s1[i] && ! s1[j]) {
+	        found = base->ok && (f1[i].syn ^ f1[j].syn) == base->syn;
+	      }
+	      else if (s1[i] && s1[j]) {
+	        found = structure_ok (base, f1[i].dkeep + f1[j].dkeep, f1[i].dtrouble + f1[j].dtrouble);
+	      }
+	      else {
+	        continue;	/* Below. */
+	      }
 
+	      if (found) {
+	        r[len + n].a = a;
+	        r[len + n].b = b;
+	        r[len + n].score = r[i].score + r[j].score;
+	        n++;
+	      }
+	    }
+	  }
+
+	  for (i = 0; i < nr; i++) {
+	    if ( ! s1[i] || ! structure_ok (base, f1[i].dkeep, f1[i].dtrouble)) {
+	      continue;
+	    }
+	    if (other == NULL) {
+	      other = malloc (sizeof(struct syndrome_s));
+	      if (other == NULL) {
+	        text_color_set(DW_COLOR_ERROR);
+	        dw_printf ("FATAL: Out of memory for bit fix attempts.\n");
+	        exit (1);
+	      }
+	    }
+	    syndrome_init (other, block, r[i].a);
+	    if ( ! other->ok) {
+	      continue;
+	    }
+	    for (j = 0; j < nr; j++) {
+	      struct flip_s f;
+
+	      if (s1[j] || abs (r[j].a - r[i].a) <= near) {
+	        continue;
+	      }
+	      raw[0] = r[j].a;
+	      if ( ! syndrome_flip (other, raw, 1, &f) && f.syn == other->syn) {
+	        r[len + n].a = r[i].a < r[j].a ? r[i].a : r[j].a;
+	        r[len + n].b = r[i].a < r[j].a ? r[j].a : r[i].a;
+	        r[len + n].score = r[i].score + r[j].score;
+	        n++;
+	      }
+	    }
+	  }
+
+	  if (other != NULL) free (other);
+	  free (f1);
+	  free (s1);
+
+	  qsort (r + len, n, sizeof(struct ranked_s), ranked_compare);
+
+	  retry_cfg.mode = RETRY_MODE_SEPARATED;
+	  retry_cfg.retry = RETRY_INVERT_TWO_SEP;
+	  retry_cfg.u_bits.sep.bit_idx_c = -1;
+
+	  for (i = 0; i < n && ! ok; i++) {
+	    retry_cfg.u_bits.sep.bit_idx_a = r[len + i].a;
+	    retry_cfg.u_bits.sep.bit_idx_b = r[len + i].b;
+	    ok = try_decode (block, chan, subchan, slice, alevel, retry_cfg, 0, cp, 1);
+	  }
+	}
+
+	free (r);
+	return (ok);
+}
+
+
+/***********************************************************************************
+ *
+ * Name:	try_two_sep
+ *
+ * Purpose:	Try inverting two non-adjacent bits.
+ *
+ * Inputs:	block	- Stream of bits that might be a frame.
+ *		chan, subchan, slice, alevel - Passed along to try_decode.
+ *		base	- Result of syndrome_init for the block as received.
+ *
+ * Returns:	1 for success.
+ *
+ * Description:	We try the same pairs, in the same order, as the original
+ *		brute force method which decoded the frame for every pair.
+ *		Here we divide them into three groups:
+ *
+ *		- Bits close together.  Check them together with syndrome_flip.
+ *
+ *		- Far apart and neither one changes the frame structure.
+ *		  Look for the second bit, in a table by syndrome, that
+ *		  cancels out the rest of the syndrome.
+ *
+ *		- Far apart and one of them changes the frame structure.
+ *		  Analyze the block with that one bit inverted, then the
+ *		  other one is easy.  These are less common.
+ *
+ *		Only when both of them change the frame structure do
+ *		we need to decode it to find out.  Even then, we can
+ *		tell from the number of bits kept, and whether a flag
+ *		or abort pattern appears, that most can't be valid.
+ *
+ *		The work can be shared by a pool of threads.  See FIX_THREADS.
+ *		Each thread takes a range of bits at a time and the first
+ *		success, in the original order, is the one passed along.
+ *		Ranges after that are not started.
+ *		The search is dropped, as ranges are handed out, if another
+ *		subchannel or slicer already has the frame.
+ *
+ *		The amount of work is limited by FIX_WORK_LIMIT.  It is
+ *		estimated before starting, from the block alone, so the
+ *		result is the same for any number of threads and doesn't
+ *		depend on how busy the processor is.  This means very long
+ *		frames are only partly searched, even with one thread.
+ *
+ ***********************************************************************************/
+
+#define SYN_HASH_SIZE 1024
+
+#define FIX_WORK_LIMIT 4000000	/* Bits examined.  Don't try first bits after */
+				/* the estimate for all of them passes this. */
+
+struct pair_s {
+	short a;
+	short b;
+};
+
+static int pair_compare (const void *p1, const void *p2)
+{
+	const struct pair_s *x = p1;
+	const struct pair_s *y = p2;
+
+	if (x->a != y->a) return (x->a - y->a);
+	return (x->b - y->b);
+}
+
+
+/*
+ * One search for two separated bits.
+ * Everything up to "phase" is set up first and doesn't change.
+ */
+
+enum sep_phase_e { SEP_PAIRS, SEP_DECODE };
+
+struct sep_job_s {
+
+	rrbb_t block;
+	int chan, subchan, slice;
+	alevel_t alevel;
+	struct syndrome_s *base;
+	struct checkpoints_s *cp;
+
+	int len;		/* Number of bits in block. */
+	int near;		/* Bits within this distance can affect each other. */
+	struct flip_s *flip1;	/* Effect of inverting each single bit. */
+	unsigned char *struct1;	/* Inverting this single bit changes frame structure. */
+	short *hash_next;	/* Chains of bits, with same syndrome hash, in increasing order. */
+	short hash_head[SYN_HASH_SIZE];
+
+	int shared;		/* Pool threads can help. */
+
+	int end_a;		/* First bits tried are 0 thru end_a-1.  See FIX_WORK_LIMIT. */
+
+	enum sep_phase_e phase;
+
+	struct pair_s *pairs;	/* Near structure changing bit, far syndrome match. */
+	int npairs;		/* Collected in SEP_PAIRS phase. */
+	int pairs_size;
+
+	int found_a;		/* First success, in the original order. */
+	int found_b;		/* found_a is len if none yet.  Set under fix_pool.mutex */
+				/* but found_a is also read without it, so use atomics. */
+
+
+/* Remaining fields are for handing out ranges.  Protected by fix_pool.mutex when shared. */
+
+	int cancelled;		/* A sibling already has the frame. */
+
+	int next;		/* Start of next range. */
+	int end;		/* End of everything for this phase. */
+	int chunk;		/* Size of range. */
+	int active;		/* Number of ranges in progress. */
+
+	struct sep_job_s *next_job;	/* List of jobs in fix_pool. */
+
+#if __WIN32__
+	HANDLE done_event;	/* Set when active goes to zero. */
+#endif
+};
+
+
+/*
+ * Scratch space for one thread.
+ */
+
+struct sep_work_s {
+
+	struct syndrome_s other;	/* Block analyzed with one bit inverted. */
+
+	short cand[MAX_NUM_BITS];	/* Candidates for second bit. */
+
+	struct pair_s *pairs;		/* Found in one range before adding to job. */
+	int npairs;
+	int pairs_size;
+};
+
+
+/*
+ * Threads, other than the one which received the frame, that can help.
+ */
+
+static struct fix_pool_s {
+
+	int num_helpers;		/* 0 for none. */
+
+	struct sep_job_s *jobs;		/* Searches in progress. */
+
+	dw_mutex_t mutex;
+
+#if __WIN32__
+	HANDLE work_sem;		/* Released when a job is added. */
+#else
+	pthread_cond_t work_cond;	/* Job added. */
+	pthread_cond_t done_cond;	/* Some job has no ranges in progress. */
+#endif
+
+} fix_pool;
+
+
+static void sep_run (struct sep_job_s *J, enum sep_phase_e phase, int begin, int end, struct sep_work_s *W);
+
+
+static int try_two_sep (rrbb_t block, int chan, int subchan, int slice, alevel_t alevel, struct syndrome_s *base, struct checkpoints_s *cp)
+{
+	int len = base->blen;
+	struct sep_job_s *J;
+	struct sep_work_s *W;
+	int i, ok;
+	int raw[1];
+	long work;
+
+	if (len < 3) {
+	  return (0);
+	}
+
+	J = calloc (1, sizeof(struct sep_job_s));
+	W = calloc (1, sizeof(struct sep_work_s));
+	if (J == NULL || W == NULL) {
+	  text_color_set(DW_COLOR_ERROR);
+	  dw_printf ("FATAL: Out of memory for bit fix attempts.\n");
+	  exit (1);
+	}
+
+	J->block = block;
+	J->chan = chan;
+	J->subchan = subchan;
+	J->slice = slice;
+	J->alevel = alevel;
+	J->base = base;
+	J->cp = cp;
+	J->len = len;
+
+	J->near = NEAR_BITS(base);
+
+	J->flip1 = malloc (len * sizeof(struct flip_s));
+	J->struct1 = malloc (len);
+	J->hash_next = malloc (len * sizeof(short));
+	if (J->flip1 == NULL || J->struct1 == NULL || J->hash_next == NULL) {
+	  text_color_set(DW_COLOR_ERROR);
+	  dw_printf ("FATAL: Out of memory for bit fix attempts.\n");
+	  exit (1);
+	}
+
+	for (i = 0; i < SYN_HASH_SIZE; i++) {
+	  J->hash_head[i] = -1;
+	}
+
+	for (i = len - 1; i >= 0; i--) {
+	  raw[0] = i;
+	  J->struct1[i] = syndrome_flip (base, raw, 1, &(J->flip1[i]));
+	  J->hash_next[i] = -1;
+	  if ( ! J->struct1[i]) {
+	    J->hash_next[i] = J->hash_head[J->flip1[i].syn % SYN_HASH_SIZE];
+	    J->hash_head[J->flip1[i].syn % SYN_HASH_SIZE] = i;
+	  }
+	}
+
+	J->found_a = len;
+	J->found_b = -1;
+	J->shared = fix_pool.num_helpers > 0 && save_audio_config_p->achan[chan].fix_threads > 1;
+
+/*
+ * Estimate the work, in bits examined, and decide how far to go.
+ * Each structure changing second bit, in the first phase, means
+ * analyzing the whole block again and then looking at the bits
+ * before it.  Each structure changing first bit means the same for
+ * the bits after it.  Others are mostly a hash lookup.
+ */
+	work = 0;
+	for (i = 0; i < len; i++) {
+	  if (J->struct1[i] && structure_ok (base, J->flip1[i].dkeep, J->flip1[i].dtrouble)) {
+	    work += 2 * len;
+	  }
+	}
+
+	J->end_a = 0;
+	while (J->end_a < len - 2 && work <= FIX_WORK_LIMIT) {
+	  work += J->struct1[J->end_a] ? 2 * (len - J->end_a) : J->near;
+	  J->end_a++;
+	}
+#if __WIN32__
+	if (J->shared) {
+	  J->done_event = CreateEvent (NULL, FALSE, FALSE, NULL);
+	}
+#endif
+
+/*
+ * First bit doesn't change structure, second one does.
+ * With the second one inverted, find first bits that would
+ * make the syndrome zero.  Not many so keep a list.
+ */
+	if (J->end_a > 0) {
+	  sep_run (J, SEP_PAIRS, J->near + 1, len, W);
+	}
+
+	if (J->npairs > 1) {
+	  qsort (J->pairs, J->npairs, sizeof(struct pair_s), pair_compare);
+	}
+
+/*
+ * Now the first bit of each pair.
+ */
+	if (J->end_a > 0 && ! J->cancelled) {
+	  sep_run (J, SEP_DECODE, 0, J->end_a, W);
+	}
+
+	ok = 0;
+	if (J->found_a < len && ! J->cancelled) {
+	  retry_conf_t retry_cfg;
+
+	  memset (&retry_cfg, 0, sizeof(retry_cfg));
+	  retry_cfg.mode = RETRY_MODE_SEPARATED;
+	  retry_cfg.type = RETRY_TYPE_SWAP;
+	  retry_cfg.retry = RETRY_INVERT_TWO_SEP;
+	  retry_cfg.u_bits.sep.bit_idx_a = J->found_a;
+	  retry_cfg.u_bits.sep.bit_idx_b = J->found_b;
+	  retry_cfg.u_bits.sep.bit_idx_c = -1;
+
+	  ok = try_decode (block, chan, subchan, slice, alevel, retry_cfg, 0, cp, 1);
+#if DEBUG
+	  if (ok) {
+	    text_color_set(DW_COLOR_ERROR);
+	    dw_printf ("*** Success by flipping TWO SEPARATED bits %d and %d of %d \n", J->found_a, J->found_b, len);
+	  }
+#endif
+	}
+
+#if __WIN32__
+	if (J->shared) {
+	  CloseHandle (J->done_event);
+	}
+#endif
+	free (J->flip1);
+	free (J->struct1);
+	free (J->hash_next);
+	if (J->pairs != NULL) free (J->pairs);
+	free (J);
+	if (W->pairs != NULL) free (W->pairs);
+	free (W);
+
+	return (ok);
+}
+
+
+/*
+ * SEP_PAIRS phase for second bit in range lo thru hi-1.
+ */
+
+static void sep_pairs_range (struct sep_job_s *J, int lo, int hi, struct sep_work_s *W)
+{
+	int a, b;
+	int raw[1];
+
+	W->npairs = 0;
+
+	for (b = lo; b < hi; b++) {
+	  if (J->struct1[b] && structure_ok (J->base, J->flip1[b].dkeep, J->flip1[b].dtrouble)) {
+	    syndrome_init (&(W->other), J->block, b);
+	    if (W->other.ok) {
+	      for (a = 0; a < b - J->near && a < J->end_a; a++) {
+	        struct flip_s f;
+	        raw[0] = a;
+	        if ( ! J->struct1[a] && ! syndrome_flip (&(W->other), raw, 1, &f) && f.syn == W->other.syn) {
+	          if (W->npairs >= W->pairs_size) {
+	            struct pair_s *more = realloc (W->pairs, (W->pairs_size + 32) * sizeof(struct pair_s));
+	            if (more == NULL) {
+	              text_color_set(DW_COLOR_ERROR);
+	              dw_printf ("FATAL: Out of memory for bit fix attempts.\n");
+	              exit (1);
+	            }
+	            W->pairs = more;
+	            W->pairs_size += 32;
+	          }
+	          W->pairs[W->npairs].a = a;
+	          W->pairs[W->npairs].b = b;
+	          W->npairs++;
+	        }
+	      }
+	    }
+	  }
+	}
+
+	if (W->npairs == 0) {
+	  return;
+	}
+
+	if (J->shared) dw_mutex_lock (&fix_pool.mutex);
+
+	if (J->npairs + W->npairs > J->pairs_size) {
+	  struct pair_s *more = realloc (J->pairs, (J->npairs + W->npairs + 32) * sizeof(struct pair_s));
+	  if (more == NULL) {
+	    text_color_set(DW_COLOR_ERROR);
+	    dw_printf ("FATAL: Out of memory for bit fix attempts.\n");
+	    exit (1);
+	  }
+	  J->pairs = more;
+	  J->pairs_size = J->npairs + W->npairs + 32;
+	}
+	memcpy (J->pairs + J->npairs, W->pairs, W->npairs * sizeof(struct pair_s));
+	J->npairs += W->npairs;
+
+	if (J->shared) dw_mutex_unlock (&fix_pool.mutex);
+}
+
+
+/*
+ * SEP_DECODE phase for first bit in range lo thru hi-1.
+ * Stop at the first success or when someone else has
+ * found one earlier.
+ */
+
+static void sep_decode_range (struct sep_job_s *J, int lo, int hi, struct sep_work_s *W)
+{
+	int len = J->len;
+	int near = J->near;
+	struct syndrome_s *base = J->base;
+	struct syndrome_s *other = &(W->other);
+	short *cand = W->cand;
+	int a, b, i, p, n;
+	int raw[2];
+        retry_conf_t retry_cfg;
+
+	memset (&retry_cfg, 0, sizeof(retry_cfg));
+	retry_cfg.mode = RETRY_MODE_SEPARATED;
+	retry_cfg.type = RETRY_TYPE_SWAP;
+	retry_cfg.retry = RETRY_INVERT_TWO_SEP;
+	retry_cfg.u_bits.sep.bit_idx_c = -1;
+
+	/* Pairs are sorted so find the first one for this range. */
+
+	p = 0;
+	n = J->npairs;
+	while (p < n) {
+	  int m = (p + n) / 2;
+	  if (J->pairs[m].a < lo) p = m + 1; else n = m;
+	}
+
+	for (a = lo; a < hi && a < __atomic_load_n (&(J->found_a), __ATOMIC_RELAXED); a++) {
+	  int ncand = 0;
+
+/* Close together. */
+
+	  for (b = a + 2; b < len && b <= a + near; b++) {
+	    raw[0] = a;
+	    raw[1] = b;
+	    if (syndrome_candidate (base, raw, 2)) {
+	      cand[ncand++] = b;
+	    }
+	  }
+
+/*
+ * Far apart.
+ * The changes to the frame structure, if any, are independent.
+ */
+
+	  if (J->struct1[a]) {
+	    int a_ok = structure_ok (base, J->flip1[a].dkeep, J->flip1[a].dtrouble);
+
+	    if (a_ok) {
+	      syndrome_init (other, J->block, a);
+	    }
+	    for (b = a + near + 1; b < len; b++) {
+	      struct flip_s f;
+	      raw[0] = b;
+	      if (J->struct1[b]) {
+	        if (structure_ok (base, J->flip1[a].dkeep + J->flip1[b].dkeep, J->flip1[a].dtrouble + J->flip1[b].dtrouble)) {
+	          cand[ncand++] = b;
+	        }
+	      }
+	      else if (a_ok && other->ok && ! syndrome_flip (other, raw, 1, &f) && f.syn == other->syn) {
+	        cand[ncand++] = b;
+	      }
+	    }
+	  }
+	  else {
+	    unsigned short want = base->syn ^ J->flip1[a].syn;
+	    int h = base->ok ? J->hash_head[want % SYN_HASH_SIZE] : -1;
+
+	    while (p < J->npairs && J->pairs[p].a < a) {
+	      p++;
+	    }
+
+	    /* Merge the two lists which are both in increasing order. */
+
+	    while (h >= 0 && h <= a + near) {
+	      h = J->hash_next[h];
+	    }
+	    while (h >= 0 || (p < J->npairs && J->pairs[p].a == a)) {
+	      if (h >= 0 && (p >= J->npairs || J->pairs[p].a != a || h < J->pairs[p].b)) {
+	        if (J->flip1[h].syn == want) {
+	          cand[ncand++] = h;
+	        }
+	        h = J->hash_next[h];
+	      }
+	      else {
+	        cand[ncand++] = J->pairs[p].b;
+	        p++;
+	      }
+	    }
+	  }
+
+/* Now decode them to be sure.  Passed along later if this is the first. */
+
+	  retry_cfg.u_bits.sep.bit_idx_a = a;
+	  for (i = 0; i < ncand; i++) {
+	    retry_cfg.u_bits.sep.bit_idx_b = cand[i];
+	    if (try_decode (J->block, J->chan, J->subchan, J->slice, J->alevel, retry_cfg, 0, J->cp, 0)) {
+
+	      if (J->shared) dw_mutex_lock (&fix_pool.mutex);
+	      if (a < J->found_a) {
+	        J->found_b = cand[i];
+	        __atomic_store_n (&(J->found_a), a, __ATOMIC_RELAXED);
+	      }
+	      if (J->shared) dw_mutex_unlock (&fix_pool.mutex);
+	      return;
+	    }
+	  }
+	}
+}
+
+
+static void sep_do_range (struct sep_job_s *J, int lo, int hi, struct sep_work_s *W)
+{
+	if (J->phase == SEP_PAIRS) {
+	  sep_pairs_range (J, lo, hi, W);
+	}
+	else {
+	  sep_decode_range (J, lo, hi, W);
+	}
+}
+
+
+/*
+ * Hand out the next range of a job.  Called with fix_pool.mutex held if shared.
+ * Returns 0 if there is nothing more to do, or a sibling already has the frame.
+ */
+
+static int sep_take_range (struct sep_job_s *J, int *lo, int *hi)
+{
+	if (J->cancelled || J->next >= J->end) {
+	  return (0);
+	}
+	if (multi_modem_sibling_has_frame (J->chan, J->subchan, J->slice, J->len)) {
+	  J->cancelled = 1;
+	  return (0);
+	}
+	if (J->phase == SEP_DECODE && J->next >= J->found_a) {
+	  return (0);
+	}
+
+	*lo = J->next;
+	*hi = J->next + J->chunk;
+	if (*hi > J->end) *hi = J->end;
+	J->next = *hi;
+	J->active++;
+	return (1);
+}
+
+
+/*
+ * Do one phase of the search, from begin thru end-1.
+ * When shared, we are in the pool and also do our share.
+ */
+
+static void sep_run (struct sep_job_s *J, enum sep_phase_e phase, int begin, int end, struct sep_work_s *W)
+{
+	struct sep_job_s **pj;
+	int lo, hi;
+
+	J->phase = phase;
+
+	if ( ! J->shared) {
+	  J->next = begin;
+	  J->end = end;
+	  J->chunk = (end - begin) / 4;
+	  if (J->chunk < 8) J->chunk = 8;
+	  J->active = 0;
+
+	  while (sep_take_range (J, &lo, &hi)) {
+	    sep_do_range (J, lo, hi, W);
+	    J->active--;
+	  }
+	  return;
+	}
+
+	dw_mutex_lock (&fix_pool.mutex);
+
+	J->next = begin;
+	J->end = end;
+	J->chunk = (end - begin) / (4 * (fix_pool.num_helpers + 1));
+	if (J->chunk < 8) J->chunk = 8;
+	J->active = 0;
+
+	J->next_job = fix_pool.jobs;
+	fix_pool.jobs = J;
+#if __WIN32__
+	ReleaseSemaphore (fix_pool.work_sem, fix_pool.num_helpers, NULL);
+#else
+	pthread_cond_broadcast (&(fix_pool.work_cond));
+#endif
+
+	while (sep_take_range (J, &lo, &hi)) {
+	  dw_mutex_unlock (&fix_pool.mutex);
+	  sep_do_range (J, lo, hi, W);
+	  dw_mutex_lock (&fix_pool.mutex);
+	  J->active--;
+	}
+
+	while (J->active > 0) {
+#if __WIN32__
+	  dw_mutex_unlock (&fix_pool.mutex);
+	  WaitForSingleObject (J->done_event, INFINITE);
+	  dw_mutex_lock (&fix_pool.mutex);
+#else
+	  pthread_cond_wait (&(fix_pool.done_cond), &(fix_pool.mutex));
+#endif
+	}
+
+	for (pj = &(fix_pool.jobs); *pj != J; pj = &((*pj)->next_job)) {
+	  ;
+	}
+	*pj = J->next_job;
+
+	dw_mutex_unlock (&fix_pool.mutex);
+}
+
+
+/*
+ * Pool thread.  Help with any search that has work left.
+ */
+
+#if __WIN32__
+static unsigned __stdcall fix_pool_thread (void *arg)
+#else
+static void * fix_pool_thread (void *arg)
+#endif
+{
+	struct sep_work_s *W = calloc (1, sizeof(struct sep_work_s));
+
+	if (W == NULL) {
+	  text_color_set(DW_COLOR_ERROR);
+	  dw_printf ("FATAL: Out of memory for bit fix attempts.\n");
+	  exit (1);
+	}
+
+	dw_mutex_lock (&fix_pool.mutex);
+
+	while (1) {
+	  struct sep_job_s *J;
+	  int lo, hi;
+
+	  for (J = fix_pool.jobs; J != NULL; J = J->next_job) {
+	    if (sep_take_range (J, &lo, &hi)) break;
+	  }
+
+	  if (J == NULL) {
+#if __WIN32__
+	    dw_mutex_unlock (&fix_pool.mutex);
+	    WaitForSingleObject (fix_pool.work_sem, INFINITE);
+	    dw_mutex_lock (&fix_pool.mutex);
+#else
+	    pthread_cond_wait (&(fix_pool.work_cond), &(fix_pool.mutex));
+#endif
+	    continue;
+	  }
+
+	  dw_mutex_unlock (&fix_pool.mutex);
+	  sep_do_range (J, lo, hi, W);
+	  dw_mutex_lock (&fix_pool.mutex);
+
+	  J->active--;
+	  if (J->active == 0) {
+#if __WIN32__
+	    SetEvent (J->done_event);
+#else
+	    pthread_cond_broadcast (&(fix_pool.done_cond));
+#endif
+	  }
+	}
+
+	return (0);
+}
+
+
+static void fix_pool_init (int num_helpers)
+{
+	int n;
+
+	memset (&fix_pool, 0, sizeof(fix_pool));
+
+	if (num_helpers <= 0) {
+	  return;
+	}
+
+	dw_mutex_init (&(fix_pool.mutex));
+#if __WIN32__
+	fix_pool.work_sem = CreateSemaphore (NULL, 0, 0x7fffffff, NULL);
+#else
+	pthread_cond_init (&(fix_pool.work_cond), NULL);
+	pthread_cond_init (&(fix_pool.done_cond), NULL);
+#endif
+
+	for (n = 0; n < num_helpers; n++) {
+#if __WIN32__
+	  HANDLE th;
+
+	  th = (HANDLE)_beginthreadex (NULL, 0, fix_pool_thread, NULL, 0, NULL);
+	  if (th == NULL) {
+	    text_color_set(DW_COLOR_ERROR);
+	    dw_printf ("Could not create thread for fixing frames.\n");
+	    break;
+	  }
+#else
+	  pthread_t tid;
+	  int e;
+
+	  e = pthread_create (&tid, NULL, fix_pool_thread, NULL);
+	  if (e != 0) {
+	    text_color_set(DW_COLOR_ERROR);
+	    perror("Could not create thread for fixing frames");
+	    break;
+	  }
+	  pthread_detach (tid);
+#endif
+	}
+	fix_pool.num_helpers = n;
+
+	text_color_set(DW_COLOR_DEBUG);
+	dw_printf ("Fixing frames with two separated bits shared among %d threads.\n", n + 1);
+}
+
+
+/***********************************************************************************
+ *
+ * Name:	syndrome_init
+ *
+ * Purpose:	Analyze a block of bits for quickly finding which bits 
+ *		could be inverted to get a good CRC.
+ *
+ * Inputs:	block	- Bit string that was collected between "flag" patterns.
+ *		invert	- Invert this bit first.  -1 for none.
+ *
+ * Outputs:	S	- See struct syndrome_s.
+ *
+ * Description:	This goes thru the bits the same way as try_decode
+ *		but doesn't give up at the first sign of trouble.
+ *
+ *		The CRC is calculated with the register starting at all 
+ *		ones and inverted at the end but that doesn't matter for
+ *		the difference between two frames of the same length.
+ *		Inverting a data bit, with k bits after it, changes the 
+ *		calculated FCS by what we would get by starting with 0 
+ *		and processing a 1 followed by k 0 bits.
+ *		Inverting an FCS bit changes only that bit.
+ *
+ ***********************************************************************************/
+
+static void syndrome_init (struct syndrome_s *S, rrbb_t block, int invert)
+{
+	int i;
+	int prev_raw, lfsr, prev_descram;
+	unsigned char pat_det = 0;
+	int nkeep = 0;
+	int trouble = 0;
+	int frame_len;
+	unsigned char frame_buf[MAX_FRAME_LEN];
+
+	S->blen = rrbb_get_len(block);
+	S->is_scrambled = rrbb_get_is_scrambled (block);
+	S->ok = 0;
+	S->syn = 0;
+
+	prev_descram = rrbb_get_prev_descram (block);
+	lfsr = rrbb_get_descram_state (block);
+	prev_raw = rrbb_get_bit (block, 0) ^ (invert == 0);
+
+	for (i = 1; i < S->blen; i++) {
+	  int raw = rrbb_get_bit (block, i) ^ (invert == i);
+	  int dbit;
+
+	  if (S->is_scrambled) {
+	    int descram = descramble(raw, &lfsr);
+	    dbit = (descram == prev_descram);
+	    prev_descram = descram;
+	  }
+	  else {
+	    dbit = (raw == prev_raw);
+	  }
+	  prev_raw = raw;
+
+	  S->dbit[i] = dbit;
+	  S->pat_det[i] = pat_det;
+	  pat_det = (pat_det >> 1) | (dbit << 7);
+
+	  if (dbit) {
+	    S->stuff[i] = (pat_det == 0xfe) ? STUFF_ABORT : STUFF_KEEP;
+	  }
+	  else if (pat_det == 0x7e) {
+	    S->stuff[i] = STUFF_FLAG;
+	  }
+	  else if ((pat_det >> 2) == 0x1f) {
+	    S->stuff[i] = STUFF_REMOVE;
+	  }
+	  else {
+	    S->stuff[i] = STUFF_KEEP;
+	  }
+
+	  /* Use bit_syn for position in frame until we know the length. */
+
+	  S->bit_syn[i] = 0;
+	  if (S->stuff[i] == STUFF_KEEP) {
+	    S->bit_syn[i] = nkeep++;
+	  }
+	  else if (S->stuff[i] != STUFF_REMOVE) {
+	    trouble++;
+	  }
+	}
+
+	S->nkeep = nkeep;
+	S->ntrouble = trouble;
+
+	if ( ! structure_ok (S, 0, 0)) {
+	  for (i = 1; i < S->blen; i++) {
+	    S->bit_syn[i] = 0;
+	  }
+	  return;
+	}
+
+/*
+ * Put frame together to get the syndrome.
+ * Like try_decode, anything past the maximum length is discarded.
+ */
+	frame_len = nkeep / 8;
+	if (frame_len > MAX_FRAME_LEN) {
+	  frame_len = MAX_FRAME_LEN;
+	}
+	memset (frame_buf, 0, sizeof(frame_buf));
+	for (i = 1; i < S->blen; i++) {
+	  if (S->stuff[i] == STUFF_KEEP && S->dbit[i] && S->bit_syn[i] < frame_len * 8) {
+	    frame_buf[S->bit_syn[i] >> 3] |= 1 << (S->bit_syn[i] & 7);
+	  }
+	}
+
+	S->syn = fcs_calc (frame_buf, frame_len - 2) ^ (frame_buf[frame_len-2] | (frame_buf[frame_len-1] << 8));
+	S->ok = 1;
+
+/*
+ * Now replace the frame position with the effect on the syndrome.
+ * Work backwards so we know how many data bits follow each one.
+ */
+	int ndata = (frame_len - 2) * 8;
+	unsigned short crc = 0x8408;
+
+	for (i = S->blen - 1; i >= 1; i--) {
+	  if (S->stuff[i] == STUFF_KEEP) {
+	    int pos = S->bit_syn[i];
+
+	    if (pos >= frame_len * 8) {
+	      S->bit_syn[i] = 0;
+	    }
+	    else if (pos >= ndata) {
+	      S->bit_syn[i] = 1 << (pos - ndata);
+	    }
+	    else {
+	      S->bit_syn[i] = crc;
+	      crc = (crc & 1) ? ((crc >> 1) ^ 0x8408) : (crc >> 1);
+	    }
+	  }
+	}
+
+} /* end syndrome_init */
+
+
+/***********************************************************************************
+ *
+ * Name:	syndrome_flip
+ *
+ * Purpose:	Find the effect of inverting some of the received bits.
+ *
+ * Inputs:	S	- From syndrome_init.
+ *		raw	- Positions of bits to invert, in increasing order.
+ *		nraw	- How many.  Up to 3.
+ *
+ * Outputs:	f	- Change to the syndrome, meaningful only if result is 0,
+ *			  and changes to the number of bits kept and the 
+ *			  number of flag or abort patterns.
+ *
+ * Returns:	1 if the frame structure would change.  Bit stuffing is 
+ *		different or a flag or abort pattern appears or disappears.
+ *		If it could still be a valid frame, see structure_ok,
+ *		the only way to find out is a full decode.
+ *
+ ***********************************************************************************/
+
+static int syndrome_flip (struct syndrome_s *S, const int *raw, int nraw, struct flip_s *f)
+{
+	static const int nrzi_offs[] = { 0, 1 };
+	static const int scram_offs[] = { 0, 1, 12, 13, 17, 18 };
+	const int *offs = S->is_scrambled ? scram_offs : nrzi_offs;
+	int noffs = S->is_scrambled ? 6 : 2;
+	int t[3 * 6];		/* Data bit positions, after NRZI decoding, to invert. */
+	int nt = 0;
+	int n, j, k;
+	int changed = 0;
+
+	f->syn = 0;
+	f->dkeep = 0;
+	f->dtrouble = 0;
+
+/*
+ * The first bit is the end of the opening flag and is used only to
+ * find the first data bit.  For 9600, the descrambler state was saved
+ * so it doesn't matter at all.
+ *
+ * An inverted bit changes the result of the descrambler now and 12
+ * and 17 bits later.  Each of those changes the NRZI decoding of that
+ * bit and the following one.  These can overlap and cancel.
+ */
+	for (n = 0; n < nraw; n++) {
+
+	  if (raw[n] == 0 && S->is_scrambled) continue;
+
+	  for (j = 0; j < noffs; j++) {
+	    int pos = raw[n] + offs[j];
+	    int found = 0;
+
+	    if (pos < 1 || pos >= S->blen) continue;
+
+	    for (k = 0; k < nt; k++) {
+	      if (t[k] == pos) {
+	        t[k] = t[--nt];
+	        found = 1;
+	        break;
+	      }
+	    }
+	    if ( ! found) {
+	      t[nt++] = pos;
+	    }
+	  }
+	}
+
+	if (nt == 0) {
+	  return (0);
+	}
+
+	/* Small so insertion sort is fine. */
+
+	for (j = 1; j < nt; j++) {
+	  int x = t[j];
+	  for (k = j; k > 0 && t[k-1] > x; k--) {
+	    t[k] = t[k-1];
+	  }
+	  t[k] = x;
+	}
+
+/*
+ * Run the pattern detector over the changed bits and the 7 after.
+ * After that it has only unchanged bits so it can't be different.
+ */
+	unsigned char pat_det = S->pat_det[t[0]];
+	int last = t[nt-1] + 7;
+
+	j = 0;
+	for (k = t[0]; k < S->blen && k <= last; k++) {
+	  int dbit = S->dbit[k];
+	  int stuff;
+
+	  if (j < nt && t[j] == k) {
+	    dbit = ! dbit;
+	    j++;
+	  }
+	  pat_det = (pat_det >> 1) | (dbit << 7);
+
+	  if (dbit) {
+	    stuff = (pat_det == 0xfe) ? STUFF_ABORT : STUFF_KEEP;
+	  }
+	  else if (pat_det == 0x7e) {
+	    stuff = STUFF_FLAG;
+	  }
+	  else if ((pat_det >> 2) == 0x1f) {
+	    stuff = STUFF_REMOVE;
+	  }
+	  else {
+	    stuff = STUFF_KEEP;
+	  }
+
+	  if (stuff != S->stuff[k]) {
+	    changed = 1;
+	    f->dkeep += (stuff == STUFF_KEEP) - (S->stuff[k] == STUFF_KEEP);
+	    f->dtrouble += (stuff >= STUFF_FLAG) - (S->stuff[k] >= STUFF_FLAG);
+	  }
+	}
+
+	if ( ! changed) {
+	  for (j = 0; j < nt; j++) {
+	    f->syn ^= S->bit_syn[t[j]];
+	  }
+	}
+	return (changed);
+
+} /* end syndrome_flip */
+
+
+/*
+ * Would the frame structure be valid after changing the number of 
+ * bits kept, and the number of flag or abort patterns, by this much?
+ * i.e.  Whole number of octets, long enough, nothing that would 
+ * make try_decode give up before the end.
+ */
+
+static int structure_ok (struct syndrome_s *S, int dkeep, int dtrouble)
+{
+	int nkeep = S->nkeep + dkeep;
+
+	return (S->ntrouble + dtrouble == 0 && (nkeep & 7) == 0 && nkeep / 8 >= MIN_FRAME_LEN);
+}
+
+
+/*
+ * Could inverting these bits possibly result in a good CRC?
+ */
+
+static int syndrome_candidate (struct syndrome_s *S, const int *raw, int nraw)
+{
+	struct flip_s f;
+
+	if (syndrome_flip (S, raw, nraw, &f)) {
+	  return (structure_ok (S, f.dkeep, f.dtrouble));
+	}
+	return (S->ok && f.syn == S->syn);
+}
+
+
+
+// TODO:  Remove this.  but first figure out what to do in atest.c
+
+
+
+int hdlc_rec2_try_to_fix_later (rrbb_t block, int chan, int subchan, int slice, alevel_t alevel)
+{
+	int ok;
+	//int len;
+	//retry_t fix_bits = save_audio_config_p->achan[chan].fix_bits;
+	int passall = save_audio_config_p->achan[chan].passall;
+#if DEBUG_LATER
+	double tstart, tend;
+#endif
+	retry_conf_t retry_cfg;
+
+	memset (&retry_cfg, 0, sizeof(retry_cfg));
+
+	//len = rrbb_get_len(block);
+
+
+/*
+ * All fix up attempts have failed.  
+ * Should we pass it along anyhow with a bad CRC?
+ * Note that we still need a minimum number of whole octets.
+ */
+	if (passall) {
+
+	  retry_cfg.type = RETRY_TYPE_NONE;
+	  retry_cfg.mode = RETRY_MODE_CONTIGUOUS;
+	  retry_cfg.retry = RETRY_NONE;
+	  retry_cfg.u_bits.contig.nr_bits = 0;
+	  retry_cfg.u_bits.contig.bit_idx = 0;
+	  ok = try_decode (block, chan, subchan, slice, alevel, retry_cfg, passall, NULL, 1);
+	  return (ok);
+	}
+
+	return (0);
+
+}  /* end hdlc_rec2_try_to_fix_later */
+
+
+
+/* 
+ * Check if the specified index of bit has been modified with the current type of configuration
+ * Provide a specific implementation for contiguous mode to optimize number of tests done in the loop 
+ */
+
+inline static char is_contig_bit_modified(int bit_idx, retry_conf_t retry_conf) {
+	  int cont_bit_idx = retry_conf.u_bits.contig.bit_idx;
+	  int cont_nr_bits = retry_conf.u_bits.contig.nr_bits;
+
+	  if (bit_idx >= cont_bit_idx && (bit_idx < cont_bit_idx + cont_nr_bits )) 
+		return 1;
+	  else 
+		return 0;
+}
+
+/* 
+ * Check  if the specified index of bit has been modified with the current type of configuration in separated bit index mode
+ * Provide a specific implementation for separated mode to optimize number of tests done in the loop 
+ */
+
+inline static char is_sep_bit_modified(int bit_idx, retry_conf_t retry_conf) {
+	  if (bit_idx == retry_conf.u_bits.sep.bit_idx_a || 
+	      bit_idx == retry_conf.u_bits.sep.bit_idx_b ||
+	      bit_idx == retry_conf.u_bits.sep.bit_idx_c)
+	    return 1;
+	  else
+	    return 0;
+}
+
+
+
+/*
+ * Version 1.5:  Deframing 8 bits at a time.
+ *
+ * Bit unstuffing and looking for flag or abort patterns only needs to
+ * know how many 1 data bits came just before.  That is never more than
+ * 6 within a frame, so a table indexed by that and the next 8 data bits
+ * can do the work of 8 trips around the loop.  Each entry has:
+ *
+ *	bits 0-7	Data bits remaining after unstuffing, first in LSB.
+ *	bits 8-11	How many of them, 0 .. 8.
+ *	bits 12-14	Number of 1 data bits in a row at the end.
+ *	bit 15		DF_STOP - Flag or abort found.  Can't be a valid frame.
+ */
+
+#define DF_SKIP 2
+#define DF_STOP 0x8000
+
+static unsigned short deframe_table[7][256];
+
+static unsigned char bit_reverse[256];		/* For the descrambler. */
+
+
+/*
+ * One data bit.  Returns the bit, DF_SKIP for one added by bit
+ * stuffing, or DF_STOP for a flag or abort pattern.
+ */
+
+static inline int deframe_bit (int *ones, int dbit)
+{
+	if (dbit) {
+	  /* Valid data will never have 7 one bits in a row. */
+	  if (*ones == 6) {
+	    return (DF_STOP);
+	  }
+	  (*ones)++;
+	  return (1);
+	}
+
+	/* The special pattern 01111110 indicates beginning and ending of a frame. */
+	if (*ones == 6) {
+	  return (DF_STOP);
+	}
+
+/*
+ * If we have five '1' bits in a row, followed by a '0' bit,
+ *
+ *	011111xx
+ *
+ * the current '0' bit should be discarded because it was added for 
+ * "bit stuffing."
+ */
+	if (*ones == 5) {
+	  *ones = 0;
+	  return (DF_SKIP);
+	}
+
+	*ones = 0;
+	return (0);
+}
+
+
+static void deframe_init (void)
+{
+	int ones, byte, j;
+
+	for (ones = 0; ones <= 6; ones++) {
+	  for (byte = 0; byte < 256; byte++) {
+	    int o = ones;
+	    int val = 0;
+	    int n = 0;
+	    int e = 0;
+
+	    for (j = 0; j < 8; j++) {
+	      int d = deframe_bit (&o, (byte >> j) & 1);
+
+	      if (d == DF_STOP) {
+	        e = DF_STOP;
+	        break;
+	      }
+	      if (d != DF_SKIP) {
+	        val |= d << n;
+	        n++;
+	      }
+	    }
+	    if (e == 0) {
+	      e = val | (n << 8) | (o << 12);
+	    }
+	    deframe_table[ones][byte] = e;
+	  }
+	}
+
+	for (byte = 0; byte < 256; byte++) {
+	  int r = 0;
+
+	  for (j = 0; j < 8; j++) {
+	    if (byte & (1 << j)) {
+	      r |= 0x80 >> j;
+	    }
+	  }
+	  bit_reverse[byte] = r;
+	}
+}
+
+
+/*
+ * Add n data bits, first in LSB, and move a complete octet to the frame buffer.
+ * At most 7 are left over from last time so there can't be more than one.
+ */
+
+static inline void append_data_bits (struct hdlc_state_s *H, int val, int n)
+{
+	H->oacc |= val << H->olen;
+	H->olen += n;
+
+	if (H->olen >= 8) {
+	  H->olen -= 8;
+
+	  if (H->frame_len < MAX_FRAME_LEN) {
+	    H->frame_buf[H->frame_len] = H->oacc & 0xff;
+	    H->frame_len++;
+	  }
+	  H->oacc >>= 8;
+	}
+}
+
+
+static void save_checkpoint (struct checkpoints_s *cp, struct hdlc_state_s *H)
+{
+	int n = cp->count;
+
+	H->fcs = fcs_update (H->fcs, H->frame_buf + H->fcs_len, H->frame_len - H->fcs_len);
+	H->fcs_len = H->frame_len;
+
+	cp->state[n].prev_raw = H->prev_raw;
+	cp->state[n].lfsr = H->lfsr;
+	cp->state[n].prev_descram = H->prev_descram;
+	cp->state[n].ones = H->ones;
+	cp->state[n].oacc = H->oacc;
+	cp->state[n].olen = H->olen;
+	cp->state[n].frame_len = H->frame_len;
+	cp->state[n].fcs = H->fcs;
+	if (n > 0) {
+	  memcpy (cp->frame_buf + cp->state[n-1].frame_len, H->frame_buf + cp->state[n-1].frame_len, 
+				H->frame_len - cp->state[n-1].frame_len);
+	}
+	cp->count++;
+}
 
 
 /***********************************************************************************
@@ -575,17 +2262,28 @@ inline static char is_sep_bit_modified(int bit_idx, retry_conf_t retry_conf) {
  *				  Valid only when no changes make.  i.e.
  *					retry == RETRY_NONE, type == RETRY_TYPE_NONE
  *
+ *		cp		- Version 1.5:  Checkpoints or NULL.
+ *				  Saved when type == RETRY_TYPE_NONE.
+ *				  Otherwise used to skip over the beginning
+ *				  of the block where nothing is changed.
+ *
+ *		deliver		- Version 1.5:  Pass a good frame along for processing.
+ *				  0 to only find out whether this would work.
+ *
  * Returns:	1 = successfully extracted something.
  *		0 = failure.
  *
  ***********************************************************************************/
 
-static int try_decode (rrbb_t block, int chan, int subchan, int slice, alevel_t alevel, retry_conf_t retry_conf, int passall)
+static int try_decode (rrbb_t block, int chan, int subchan, int slice, alevel_t alevel, retry_conf_t retry_conf, int passall, struct checkpoints_s *cp, int deliver)
 {
 	struct hdlc_state_s H;	
 	int blen;			/* Block length in bits. */
 	int i;
-	int raw;			/* From demodulator.  Should be 0 or 1. */
+	int start = 1;			/* First bit to process. */
+	int next_save;			/* Next bit position for saving checkpoint. */
+	int raw;			/* From demodulator.  Version 1.5:  Now 8 at a time. */
+	int flip_lo, flip_hi;		/* Range of bits being inverted. */
 #if DEBUGx
 	int crc_failed = 1;
 #endif
@@ -611,121 +2309,195 @@ static int try_decode (rrbb_t block, int chan, int subchan, int slice, alevel_t
 	  H.prev_raw = ! H.prev_raw;
 	}
 
-	H.pat_det = 0;
+	H.ones = 0;
 	H.oacc = 0;
 	H.olen = 0;
 	H.frame_len = 0;
+	H.fcs = FCS_INIT;
+	H.fcs_len = 0;
 
 	blen = rrbb_get_len(block);
 
+/*
+ * Version 1.5:  Range of bits that might be inverted.
+ * Bytes outside of it can be taken as they are.
+ */
+	flip_lo = blen;
+	flip_hi = -1;
+
+	if (retry_conf_retry == RETRY_INVERT_TWO_SEP) {
+	  flip_lo = retry_conf.u_bits.sep.bit_idx_a;
+	  flip_hi = retry_conf.u_bits.sep.bit_idx_a;
+	  if (retry_conf.u_bits.sep.bit_idx_b >= 0) {
+	    if (retry_conf.u_bits.sep.bit_idx_b < flip_lo) flip_lo = retry_conf.u_bits.sep.bit_idx_b;
+	    if (retry_conf.u_bits.sep.bit_idx_b > flip_hi) flip_hi = retry_conf.u_bits.sep.bit_idx_b;
+	  }
+	  if (retry_conf.u_bits.sep.bit_idx_c >= 0) {
+	    if (retry_conf.u_bits.sep.bit_idx_c < flip_lo) flip_lo = retry_conf.u_bits.sep.bit_idx_c;
+	    if (retry_conf.u_bits.sep.bit_idx_c > flip_hi) flip_hi = retry_conf.u_bits.sep.bit_idx_c;
+	  }
+	}
+	else if (retry_conf_mode == RETRY_MODE_CONTIGUOUS && retry_conf_type == RETRY_TYPE_SWAP) {
+	  flip_lo = retry_conf.u_bits.contig.bit_idx;
+	  flip_hi = retry_conf.u_bits.contig.bit_idx + retry_conf.u_bits.contig.nr_bits - 1;
+	}
+
+/*
+ * Version 1.5:  Save checkpoints on the first attempt.
+ * Later, start from the last one before the first changed bit.
+ */
+	next_save = blen;
+
+	if (cp != NULL) {
+	  if (retry_conf_type == RETRY_TYPE_NONE) {
+	    cp->count = 0;
+	    next_save = 1;
+	  }
+	  else if (cp->count > 1) {
+	    int first;
+	    int n;
+
+	    if (retry_conf_mode == RETRY_MODE_SEPARATED) {
+	      first = retry_conf.u_bits.sep.bit_idx_a;
+	      if (retry_conf.u_bits.sep.bit_idx_b >= 0 && retry_conf.u_bits.sep.bit_idx_b < first) {
+	        first = retry_conf.u_bits.sep.bit_idx_b;
+	      }
+	      if (retry_conf.u_bits.sep.bit_idx_c >= 0 && retry_conf.u_bits.sep.bit_idx_c < first) {
+	        first = retry_conf.u_bits.sep.bit_idx_c;
+	      }
+	    }
+	    else {
+	      first = retry_conf.u_bits.contig.bit_idx;
+	    }
+
+	    n = (first - 1) / CHECKPOINT_INTERVAL;
+	    if (first >= 1 && n > 0) {
+	      if (n >= cp->count) {
+	        n = cp->count - 1;
+	      }
+	      start = 1 + n * CHECKPOINT_INTERVAL;
+	      H.prev_raw = cp->state[n].prev_raw;
+	      H.lfsr = cp->state[n].lfsr;
+	      H.prev_descram = cp->state[n].prev_descram;
+	      H.ones = cp->state[n].ones;
+	      H.oacc = cp->state[n].oacc;
+	      H.olen = cp->state[n].olen;
+	      H.frame_len = cp->state[n].frame_len;
+	      H.fcs = cp->state[n].fcs;
+	      H.fcs_len = H.frame_len;
+	      memcpy (H.frame_buf, cp->frame_buf, H.frame_len);
+	    }
+	  }
+	}
+
 #if DEBUGx
 	text_color_set(DW_COLOR_DEBUG);
         if (retry_conf.type == RETRY_TYPE_NONE) 
         	dw_printf ("try_decode: blen=%d\n", blen);
 #endif
-	for (i=1; i<blen; i++) {
-	  /* Get the value for the current bit */
-	  raw = rrbb_get_bit (block, i);
-	  /* If swap two sep mode , swap the bit if needed */
-	  if (retry_conf_retry == RETRY_INVERT_TWO_SEP) {
-	      if (is_sep_bit_modified(i, retry_conf))
-	        raw = ! raw;
-	  } 
-	  /* Else handle all the others contiguous modes */
-	  else if (retry_conf_mode == RETRY_MODE_CONTIGUOUS) {
-
-            if (retry_conf_type == RETRY_TYPE_SWAP) {
-	        /* If this is the bit to swap */
-	        if (is_contig_bit_modified(i, retry_conf))
-	          raw = ! raw;
-            } 
 
-	  } else {
-	  }
 /*
- * Octets are sent LSB first.
- * Shift the most recent 8 bits thru the pattern detector.
+ * Version 1.5:  Process 8 bits at a time.  The checkpoint interval is
+ * a multiple of 8 so we still land on each of them.
  */
-	    H.pat_det >>= 1;
+	for (i=start; i+8<=blen; i+=8) {
+	  int dbits;			/* 8 data bits after undoing NRZI, first in LSB. */
+	  int e;
+
+	  if (i == next_save) {
+	    save_checkpoint (cp, &H);
+	    next_save += CHECKPOINT_INTERVAL;
+	  }
+
+	  /* Get the values for the next 8 bits, first in LSB. */
+	  raw = rrbb_get_byte (block, i);
+
+	  /* Invert the bits being tried, if any are in here. */
+	  if (i + 7 >= flip_lo && i <= flip_hi) {
+	    int j;
+
+	    for (j = 0; j < 8; j++) {
+	      if (i + j >= flip_lo && i + j <= flip_hi &&
+		  (retry_conf_retry == RETRY_INVERT_TWO_SEP ? is_sep_bit_modified(i + j, retry_conf) : 1)) {
+	        raw ^= 1 << j;
+	      }
+	    }
+	  }
 
 /*
  * Using NRZI encoding,
  *   A '0' bit is represented by an inversion since previous bit.
  *   A '1' bit is represented by no change.
- *   Note: this code can be factorized with the raw != H.prev_raw code at the cost of processing time 
+ *
+ * The descrambler state has the most recent bit in the LSB so
+ * do that part in reverse order.  Output bit n depends on the
+ * input 12 and 17 bits before it.
  */
+	  if (H.is_scrambled) {
+	    int d;
 
-	    int dbit ;
-
-	    if (H.is_scrambled) {
-	      int descram;
-
-	      descram = descramble(raw, &(H.lfsr));
-
-	      dbit = (descram == H.prev_descram);
-	      H.prev_descram = descram;
-	      H.prev_raw = raw;
-	    }
-	    else {
-
-	      dbit = (raw == H.prev_raw);
-	      H.prev_raw = raw;
-	    }
+	    H.lfsr = ((H.lfsr & 0x1ffff) << 8) | bit_reverse[raw];
+	    d = (H.lfsr ^ (H.lfsr >> 12) ^ (H.lfsr >> 17)) & 0xff;
+	    dbits = bit_reverse[~(d ^ ((d >> 1) | (H.prev_descram << 7))) & 0xff];
+	    H.prev_descram = d & 1;
+	  }
+	  else {
+	    dbits = ~(raw ^ ((raw << 1) | H.prev_raw)) & 0xff;
+	  }
+	  H.prev_raw = raw >> 7;
 
-	    if (dbit) {
+/*
+ * Remove stuffed bits and look for flag or abort patterns.
+ * Either one means it can't be a valid frame.
+ */
+	  e = deframe_table[H.ones][dbits];
 
-	      H.pat_det |= 0x80;
-	      /* Valid data will never have 7 one bits in a row: exit. */
-	      if (H.pat_det == 0xfe) {
+	  if (e & DF_STOP) {
 #if DEBUGx
-	        text_color_set(DW_COLOR_DEBUG);
-	        dw_printf ("try_decode: found abort, i=%d\n", i);
+	    text_color_set(DW_COLOR_DEBUG);
+	    dw_printf ("try_decode: found flag or abort, i=%d..%d\n", i, i+7);
 #endif
-	        return 0;
-	      }
-	      H.oacc >>= 1;
-	      H.oacc |= 0x80;
-	    } else {
-	      
-	      /* The special pattern 01111110 indicates beginning and ending of a frame: exit. */
-	      if (H.pat_det == 0x7e) {
-#if DEBUGx
-	        text_color_set(DW_COLOR_DEBUG);
-	        dw_printf ("try_decode: found flag, i=%d\n", i);
-#endif
-	      return 0;
-/*
- * If we have five '1' bits in a row, followed by a '0' bit,
- *
- *	011111xx
- *
- * the current '0' bit should be discarded because it was added for 
- * "bit stuffing."
- */
-	
-	      } else if ( (H.pat_det >> 2) == 0x1f ) {
-	        continue;
-	      }
-	      H.oacc >>= 1;
-	    }
+	    return 0;
+	  }
+	  H.ones = (e >> 12) & 7;
+
+	  append_data_bits (&H, e & 0xff, (e >> 8) & 0xf);
+	}
 
 /*
- * Now accumulate bits into octets, and complete octets
- * into the frame buffer.
+ * Any bits after the last full byte, one at a time.
  */
+	for ( ; i<blen; i++) {
+	  int dbit;
+	  int d;
+
+	  raw = rrbb_get_bit (block, i);
+	  if (i >= flip_lo && i <= flip_hi &&
+		(retry_conf_retry == RETRY_INVERT_TWO_SEP ? is_sep_bit_modified(i, retry_conf) : 1)) {
+	    raw = ! raw;
+	  }
 
-	    H.olen++;
+	  if (H.is_scrambled) {
+	    int descram;
 
-	    if (H.olen & 8) {
-	      H.olen = 0;
+	    descram = descramble(raw, &(H.lfsr));
 
-	      if (H.frame_len < MAX_FRAME_LEN) {
-	        H.frame_buf[H.frame_len] = H.oacc;
-		H.frame_len++;
-	      
-	      }
-	    }
-	  }	/* end of loop on all bits in block */
+	    dbit = (descram == H.prev_descram);
+	    H.prev_descram = descram;
+	  }
+	  else {
+	    dbit = (raw == H.prev_raw);
+	  }
+	  H.prev_raw = raw;
+
+	  d = deframe_bit (&H.ones, dbit);
+	  if (d == DF_STOP) {
+	    return 0;
+	  }
+	  if (d != DF_SKIP) {
+	    append_data_bits (&H, d, 1);
+	  }
+	}	/* end of loop on all bits in block */
 /* 
  * Do we have a minimum number of complete bytes?
  */
@@ -737,8 +2509,6 @@ static int try_decode (rrbb_t block, int chan, int subchan, int slice, alevel_t
 
 	if (H.olen == 0 && H.frame_len >= MIN_FRAME_LEN) {
 
-	  unsigned short actual_fcs, expected_fcs;
-
 #if DEBUGx 
         if (retry_conf.type == RETRY_TYPE_NONE) {
 	  int j;
@@ -753,18 +2523,14 @@ static int try_decode (rrbb_t block, int chan, int subchan, int slice, alevel_t
 #endif
 	  /* Check FCS, low byte first, and process... */
 
-	  /* Alternatively, it is possible to include the two FCS bytes */
-	  /* in the CRC calculation and look for a magic constant.  */
-	  /* That would be easier in the case where the CRC is being */
-	  /* accumulated along the way as the octets are received. */
-	  /* I think making a second pass over it and comparing is */
-	  /* easier to understand. */
+	  /* Version 1.5:  The FCS is now accumulated along the way, */
+	  /* including the two FCS bytes, so we look for the magic constant. */
+	  /* This is needed when starting from a checkpoint. */
+	  /* Only the octets since the last checkpoint remain to be added. */
 
-	  actual_fcs = H.frame_buf[H.frame_len-2] | (H.frame_buf[H.frame_len-1] << 8);
+	  H.fcs = fcs_update (H.fcs, H.frame_buf + H.fcs_len, H.frame_len - H.fcs_len);
 
-	  expected_fcs = fcs_calc (H.frame_buf, H.frame_len - 2);
-
-	  if (actual_fcs == expected_fcs && 
+	  if (H.fcs == FCS_GOOD && 
 			sanity_check (H.frame_buf, H.frame_len - 2, retry_conf.retry, save_audio_config_p->achan[chan].sanity_test)) {
 
 	      // TODO: Shouldn't be necessary to pass chan, subchan, alevel into
@@ -773,6 +2539,9 @@ static int try_decode (rrbb_t block, int chan, int subchan, int slice, alevel_t
 
 	      assert (rrbb_get_chan(block) == chan);
 	      assert (rrbb_get_subchan(block) == subchan);
+	      if ( ! deliver) {
+	        return 1;
+	      }
 	      multi_modem_process_rec_frame (chan, subchan, slice, H.frame_buf, H.frame_len - 2, alevel, retry_conf.retry);   /* len-2 to remove FCS. */
 	      return 1;		/* success */
 
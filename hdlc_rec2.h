@@ -58,6 +58,8 @@ void hdlc_rec2_init (struct audio_s *audio_config_p);
 
 void hdlc_rec2_block (rrbb_t block);
 
+void hdlc_rec2_fix_deferred (int chan, int subchan);
+
 int hdlc_rec2_try_to_fix_later (rrbb_t block, int chan, int subchan, int slice, alevel_t alevel);
 
 /* Provided by the top level application to process a complete frame. */
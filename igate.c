@@ -913,10 +913,17 @@ void igate_send_rec_packet (int chan, packet_t recv_pp)
 	}
 
 /*
- * First make a copy of it because it might be modified in place.
+ * Version 1.5:  Received packets are shared, rather than copied, so we 
+ * hold on to another reference.  Make a copy only if it needs to be 
+ * modified below.
  */
 
-	pp = ax25_dup (recv_pp);
+	if (ax25_is_frozen(recv_pp)) {
+	  pp = ax25_ref (recv_pp);
+	}
+	else {
+	  pp = ax25_dup (recv_pp);
+	}
 	assert (pp != NULL);
 
 /*
@@ -1002,6 +1009,14 @@ void igate_send_rec_packet (int chan, packet_t recv_pp)
  * Starting in 1.4 we preserve any nul characters in the information part.
  */
 
+	info_len = ax25_get_info (pp, &pinfo);
+	if (ax25_is_frozen(pp) &&
+		(memchr(pinfo, '\r', info_len) != NULL || memchr(pinfo, '\n', info_len) != NULL)) {
+	  packet_t copy = ax25_dup (pp);
+	  ax25_delete (pp);
+	  pp = copy;
+	}
+
 	if (ax25_cut_at_crlf (pp) > 0) {
 	  if (s_debug >= 1) {
 	    text_color_set(DW_COLOR_DEBUG);
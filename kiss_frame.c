@@ -585,7 +585,13 @@ void kiss_process_msg (unsigned char *kiss_msg, int kiss_len, int debug, int cli
 	      /* the high priority queue. */
 	      /* Otherwise, it is an original for the low priority queue. */
 
-	      if (ax25_get_num_repeaters(pp) >= 1 &&
+	      /* Version 1.5:  Don't take any more from the client while the */
+	      /* transmit queue is too long.  See TXQUEUE_LIMIT. */
+
+	      if ( ! tq_wait_while_full (port)) {
+	        ax25_delete (pp);
+	      }
+	      else if (ax25_get_num_repeaters(pp) >= 1 &&
 	      		ax25_get_h(pp,AX25_REPEATER_1)) {
 	        tq_append (port, TQ_PRIO_0_HI, pp);
 	      }
@@ -69,6 +69,15 @@
  *		different fixup attempts.
  *		Set limit on number of packets in fix up later queue.
  *
+ * New in version 1.5:
+ *
+ *		The demodulators for a channel can be spread over 
+ *		several threads so more than one processor core can
+ *		be used.  See DEMOD_THREADS in the configuration file.
+ *
+ *		A governor gives up the most marginal work when we
+ *		can't keep up with the audio.  See GOVERNOR.
+ *
  *------------------------------------------------------------------*/
 
 //#define DEBUG 1
@@ -80,8 +89,13 @@
 #include <string.h>
 #include <assert.h>
 #include <stdio.h>
+#include <stdint.h>
 #include <sys/unistd.h>
 
+#if __WIN32__
+#include <process.h>
+#endif
+
 #include "ax25_pad.h"
 #include "textcolor.h"
 #include "multi_modem.h"
@@ -89,6 +103,7 @@
 #include "hdlc_rec.h"
 #include "hdlc_rec2.h"
 #include "dlq.h"
+#include "dtime_now.h"
 
 
 // Properties of the radio channels.
@@ -98,11 +113,12 @@ static struct audio_s          *save_audio_config_p;
 
 // Candidates for further processing.
 
-static struct {
+static struct candidate_s {
 	packet_t packet_p;
 	alevel_t alevel;
 	retry_t retries;
-	int age;
+	int64_t when;		/* Version 1.5:  Sample count when received, */
+				/* rather than an age incremented for every sample. */
 	unsigned int crc;
 	int score;
 } candidate[MAX_CHANS][MAX_SUBCHANS][MAX_SLICERS];
@@ -116,9 +132,128 @@ static struct {
 
 static int process_age[MAX_CHANS];
 
+
+/*
+ * Version 1.5:  Candidate expiry is event driven.
+ *
+ * sample_count is the number of samples processed for the channel,
+ * as of the start of the current block.  A candidate's age is the
+ * sample_count minus its 'when'.  Only the audio receive thread changes
+ * it, between blocks, but the workers read it so it is done atomically.
+ *
+ * earliest is the oldest 'when' for each subchannel, or NO_CANDIDATE.
+ * Each subchannel is demodulated by only one thread so it can update
+ * its own without a lock.  It is allowed to be too old, just not too
+ * new, so it is only brought up to date after picking.
+ * A channel with nothing waiting costs only a few comparisons per block.
+ */
+
+#define NO_CANDIDATE INT64_MAX
+
+static int64_t sample_count[MAX_CHANS];
+
+static int64_t earliest[MAX_CHANS][MAX_SUBCHANS];
+
+
+/*
+ * Version 1.5:  The most recent frame, received without fixing, from each
+ * subchannel and slicer.  Unlike the candidate, this is kept after picking
+ * so hdlc_rec2 can find out that a sibling already has the frame it's
+ * about to fix.
+ *
+ * It is written while demodulating and read while fixing, after all
+ * threads have finished demodulating the block, so everyone sees the
+ * same thing.  It is still read and written as a single 64 bit value
+ * so another thread could never see half of an update:
+ *
+ *	Low 32 bits:	Low 32 bits of candidate 'when'.  Differences 
+ *			are still right after wrap around.
+ *	High 32 bits:	Frame length in bits, including FCS, not including
+ *			any stuffed bits.  0 if nothing received yet.
+ */
+
+static uint64_t recent[MAX_CHANS][MAX_SUBCHANS][MAX_SLICERS];
+
 static void pick_best_candidate (int chan);
 
 
+/*
+ * Version 1.5:  Worker threads to share the demodulation work.
+ *
+ * The audio receive thread, for the device, is worker 0 and does
+ * its share of the subchannels.  The others wait for a block of audio,
+ * process their subchannels, and let the receive thread know when done.
+ * Everyone works on the same block at the same time so candidates are
+ * collected and picked exactly as they would be with a single thread.
+ * Frames needing to be fixed are done in a second round, after everyone
+ * has finished demodulating the block.  See hdlc_rec2_fix_deferred.
+ */
+
+static struct pool_s {
+
+	int num_workers;			/* Including the audio receive thread. */
+						/* 0 or 1 for no extra threads. */
+
+	int assign[MAX_SUBCHANS];		/* Which worker does each subchannel. */
+
+	const int16_t *samples;			/* Block currently being processed. */
+	int n;
+	int fixing;				/* 0 to demodulate the block, 1 to fix */
+						/* the frames set aside while doing that. */
+
+#if __WIN32__
+	HANDLE start_event[MAX_SUBCHANS];	/* Signal worker to process block. */
+	HANDLE done_event[MAX_SUBCHANS];	/* Worker finished the block. */
+#else
+	pthread_mutex_t mutex;
+	pthread_cond_t start_cond;		/* New block is available. */
+	pthread_cond_t done_cond;		/* All workers finished the block. */
+	int block_seq;				/* Incremented for each new block. */
+	int busy;				/* Number of workers not finished yet. */
+#endif
+
+} pool[MAX_CHANS];
+
+static void pool_init (int chan);
+static void pool_process_block (int chan, const int16_t *samples, int n);
+
+
+/*
+ * Version 1.5:  CPU budget governor.
+ *
+ * Demodulating, and fixing frames, for a block of audio must take less
+ * time than the block lasts.  Otherwise we fall behind, the audio input
+ * overruns, and everything in the lost audio is gone, including the
+ * strong signals that would have decoded without any extra effort.
+ *
+ * Keep a running average of the time spent, as a fraction of the audio
+ * duration.  When it goes over the GOVERNOR percent, give up the most
+ * marginal work, one step at a time:
+ *
+ *	- Lower the FIX_BITS level, one at a time, down to none.
+ *	- Use only the 3 middle slicers, then only the middle one.
+ *
+ * Steps are taken back, one at a time, after the load has been
+ * under half of the limit for a while.
+ * Time is measured in audio samples so processing a recording,
+ * faster than real time, behaves the same way.
+ */
+
+#define GOV_AVERAGE	1.0	/* Seconds of audio for running average of the load. */
+#define GOV_HOLD_DOWN	2.0	/* Seconds of audio, after a change, before giving up more. */
+#define GOV_HOLD_UP	10.0	/* Seconds of audio, after a change, before taking back. */
+
+static struct governor_s {
+	float load;		/* Running average of processing time / audio time. */
+	int step;		/* How much we have given up.  0 for nothing. */
+	int fix_steps;		/* Number of steps for lowering FIX_BITS. */
+	int slicer_steps;	/* Number of steps for fewer slicers, after that. */
+	int64_t since;		/* sample_count at last change. */
+} gov[MAX_CHANS];
+
+static void governor_update (int chan, int n, double elapsed);
+
+
 
 /*------------------------------------------------------------------------------
  *
@@ -147,6 +282,17 @@ void multi_modem_init (struct audio_s *pa)
 	save_audio_config_p = pa;
 
 	memset (candidate, 0, sizeof(candidate));
+	memset (recent, 0, sizeof(recent));
+	memset (sample_count, 0, sizeof(sample_count));
+	memset (gov, 0, sizeof(gov));
+
+	for (chan=0; chan<MAX_CHANS; chan++) {
+	  int subchan;
+
+	  for (subchan=0; subchan<MAX_SUBCHANS; subchan++) {
+	    earliest[chan][subchan] = NO_CANDIDATE;
+	  }
+	}
 
 	demod_init (save_audio_config_p);
 	hdlc_rec_init (save_audio_config_p);
@@ -164,6 +310,16 @@ void multi_modem_init (struct audio_s *pa)
 
 	    process_age[chan] = PROCESS_AFTER_BITS * save_audio_config_p->adev[ACHAN2ADEV(chan)].samples_per_sec / real_baud ;
 	    //crc_queue_of_last_to_app[chan] = NULL;
+
+	    pool_init (chan);
+
+	    gov[chan].fix_steps = save_audio_config_p->achan[chan].fix_bits - RETRY_NONE;
+	    if (save_audio_config_p->achan[chan].num_slicers > 3) {
+	      gov[chan].slicer_steps = 2;
+	    }
+	    else if (save_audio_config_p->achan[chan].num_slicers > 1) {
+	      gov[chan].slicer_steps = 1;
+	    }
 	  }
 	}
 
@@ -301,17 +457,55 @@ int multi_modem_get_dc_average (int chan)
 	return ( (int) ((float)(dc_average[chan]) * (200.0f / 32767.0f) ) );
 }
 
+static void age_candidates (int chan, int n);
+
+
 __attribute__((hot))
 void multi_modem_process_sample (int chan, int audio_sample) 
 {
-	int d;
-	int subchan;
+	int16_t s = audio_sample;
+
+	multi_modem_process_block (chan, &s, 1);
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Name:	multi_modem_process_block
+ * 
+ * Purpose:	Feed a block of samples into the proper modem(s) for the channel.	
+ *
+ * Inputs:	chan	- Radio channel number
+ *
+ *		samples	- Audio samples for this channel.
+ *
+ *		n	- Number of samples.
+ *
+ * Description:	Same as multi_modem_process_sample but each demodulator
+ *		processes the whole block before going on to the next.
+ *		This saves a lot of overhead when there are many 
+ *		demodulators or a high audio sample rate.
+ *
+ *		Each candidate remembers where, in the block, it was 
+ *		received so the best can be picked at the same time,
+ *		from the same set of candidates, as if we were going
+ *		one sample at a time.
+ *
+ *------------------------------------------------------------------------------*/
+
+__attribute__((hot))
+void multi_modem_process_block (int chan, const int16_t *samples, int n) 
+{
+	int d, k;
 	static int i = 0;	/* for interleaving among multiple demodulators. */
+	double start = 0;
 
 // Accumulate an average DC bias level.
 // Shouldn't happen with a soundcard but could with mistuned SDR.
 
-	dc_average[chan] = dc_average[chan] * 0.999f + (float)audio_sample * 0.001f;
+	for (k = 0; k < n; k++) {
+	  dc_average[chan] = dc_average[chan] * 0.999f + (float)samples[k] * 0.001f;
+	}
 
 
 // Issue 128.  Someone ran into this.
@@ -331,6 +525,10 @@ void multi_modem_process_sample (int chan, int audio_sample)
 	  exit (EXIT_FAILURE);
 	}
 
+	if (save_audio_config_p->achan[chan].governor > 0) {
+	  start = dtime_now();
+	}
+
 	/* Formerly one loop. */
 	/* 1.2: We can feed one demodulator but end up with multiple outputs. */
 
@@ -340,30 +538,350 @@ void multi_modem_process_sample (int chan, int audio_sample)
 // TODO: temp debug, remove this.
 
 	  assert (save_audio_config_p->achan[chan].interleave == save_audio_config_p->achan[chan].num_subchan);
-	  demod_process_sample(chan, i, audio_sample);
-	  i++;
-	  if (i >= save_audio_config_p->achan[chan].interleave) i = 0;
+
+	  /* Each sample goes to a different demodulator so this is still one at a time. */
+
+	  for (k = 0; k < n; k++) {
+	    demod_process_block(chan, i, samples + k, 1);
+	    hdlc_rec2_fix_deferred (chan, i);
+	    i++;
+	    if (i >= save_audio_config_p->achan[chan].interleave) i = 0;
+	    age_candidates (chan, 1);
+	  }
+	}
+	else if (pool[chan].num_workers > 1) {
+	  /* Same thing but split among multiple threads. */
+	  pool_process_block (chan, samples, n);
+	  age_candidates (chan, n);
 	}
 	else {
 	  /* Send same thing to all. */
 	  for (d = 0; d < save_audio_config_p->achan[chan].num_subchan; d++) {
-	    demod_process_sample(chan, d, audio_sample);
+	    demod_process_block(chan, d, samples, n);
+	  }
+	  for (d = 0; d < save_audio_config_p->achan[chan].num_subchan; d++) {
+	    hdlc_rec2_fix_deferred (chan, d);
+	  }
+	  age_candidates (chan, n);
+	}
+
+	if (save_audio_config_p->achan[chan].governor > 0) {
+	  governor_update (chan, n, dtime_now() - start);
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Name:	pool_init
+ * 
+ * Purpose:	Start up worker threads, if configured, for a channel.
+ *
+ * Inputs:	chan	- Radio channel number.  Demodulators must be initialized.
+ *
+ * Description:	Subchannels are dealt out to the workers like cards.
+ *		A subchannel using the mark/space amplitudes computed by 
+ *		another must go to the same worker, after that one.
+ *
+ *		Nothing to do for the interleaved case where each
+ *		subchannel gets a different sample.
+ *
+ *------------------------------------------------------------------------------*/
+
+#if __WIN32__
+static unsigned __stdcall pool_worker_thread (void *arg);
+#else
+static void * pool_worker_thread (void *arg);
+#endif
+
+static void pool_init (int chan)
+{
+	struct pool_s *P = &pool[chan];
+	int num_subchan = save_audio_config_p->achan[chan].num_subchan;
+	int d, w, e;
+
+	memset (P, 0, sizeof(struct pool_s));
+
+	if (save_audio_config_p->achan[chan].demod_threads <= 1 ||
+	    save_audio_config_p->achan[chan].interleave > 1 ||
+	    num_subchan <= 1) {
+	  return;
+	}
+
+	w = 0;
+	for (d = 0; d < num_subchan; d++) {
+	  int source = demod_get_front_end_source (chan, d);
+
+	  if (source != d) {
+	    P->assign[d] = P->assign[source];
+	  }
+	  else {
+	    P->assign[d] = w;
+	    w++;
+	    if (w > P->num_workers) P->num_workers = w;
+	    if (w >= save_audio_config_p->achan[chan].demod_threads) w = 0;
 	  }
 	}
 
+	if (P->num_workers <= 1) {
+	  P->num_workers = 0;
+	  return;
+	}
+
+	text_color_set(DW_COLOR_DEBUG);
+	dw_printf ("Channel %d: %d demodulators split among %d threads.\n", chan, num_subchan, P->num_workers);
+
+#if __WIN32__
+	for (w = 1; w < P->num_workers; w++) {
+	  HANDLE th;
+
+	  P->start_event[w] = CreateEvent (NULL, FALSE, FALSE, NULL);
+	  P->done_event[w] = CreateEvent (NULL, FALSE, FALSE, NULL);
+
+	  th = (HANDLE)_beginthreadex (NULL, 0, pool_worker_thread, (void*)(long)(chan * MAX_SUBCHANS + w), 0, NULL);
+	  if (th == NULL) {
+	    text_color_set(DW_COLOR_ERROR);
+	    dw_printf ("FATAL: Could not create demodulator thread for channel %d.\n", chan);
+	    exit (1);
+	  }
+	}
+#else
+	pthread_mutex_init (&(P->mutex), NULL);
+	pthread_cond_init (&(P->start_cond), NULL);
+	pthread_cond_init (&(P->done_cond), NULL);
+
+	for (w = 1; w < P->num_workers; w++) {
+	  pthread_t tid;
+
+	  e = pthread_create (&tid, NULL, pool_worker_thread, (void *)(long)(chan * MAX_SUBCHANS + w));
+	  if (e != 0) {
+	    text_color_set(DW_COLOR_ERROR);
+	    perror("FATAL: Could not create demodulator thread");
+	    exit (1);
+	  }
+	  pthread_detach (tid);
+	}
+#endif
+	(void)e;
+}
+
+
+/*
+ * Process the subchannels assigned to one worker.
+ * Increasing order so shared mark/space amplitudes are computed before use.
+ */
+
+static void pool_do_share (int chan, int w)
+{
+	struct pool_s *P = &pool[chan];
+	int d;
+
+	for (d = 0; d < save_audio_config_p->achan[chan].num_subchan; d++) {
+	  if (P->assign[d] == w) {
+	    if (P->fixing) {
+	      hdlc_rec2_fix_deferred (chan, d);
+	    }
+	    else {
+	      demod_process_block (chan, d, P->samples, P->n);
+	    }
+	  }
+	}
+}
+
+
+#if __WIN32__
+static unsigned __stdcall pool_worker_thread (void *arg)
+#else
+static void * pool_worker_thread (void *arg)
+#endif
+{
+	int chan = (int)(long)arg / MAX_SUBCHANS;
+	int w = (int)(long)arg % MAX_SUBCHANS;
+	struct pool_s *P = &pool[chan];
+#if ! __WIN32__
+	int last_seq = 0;
+#endif
+
+	while (1) {
+
+#if __WIN32__
+	  WaitForSingleObject (P->start_event[w], INFINITE);
+
+	  pool_do_share (chan, w);
+
+	  SetEvent (P->done_event[w]);
+#else
+	  pthread_mutex_lock (&(P->mutex));
+	  while (P->block_seq == last_seq) {
+	    pthread_cond_wait (&(P->start_cond), &(P->mutex));
+	  }
+	  last_seq = P->block_seq;
+	  pthread_mutex_unlock (&(P->mutex));
+
+	  pool_do_share (chan, w);
+
+	  pthread_mutex_lock (&(P->mutex));
+	  P->busy--;
+	  if (P->busy == 0) {
+	    pthread_cond_signal (&(P->done_cond));
+	  }
+	  pthread_mutex_unlock (&(P->mutex));
+#endif
+	}
+
+	return (0);
+}
+
+
+/*
+ * Hand out a block of audio to all workers, do our own share,
+ * and wait for everyone to finish.  Then do the same again for
+ * fixing frames, so the subchannels all know what the others
+ * received in the block before deciding what needs to be fixed.
+ */
+
+static void pool_round (int chan)
+{
+	struct pool_s *P = &pool[chan];
+
+#if __WIN32__
+	int w;
+
+	for (w = 1; w < P->num_workers; w++) {
+	  SetEvent (P->start_event[w]);
+	}
+
+	pool_do_share (chan, 0);
+
+	WaitForMultipleObjects (P->num_workers - 1, &(P->done_event[1]), TRUE, INFINITE);
+#else
+	pthread_mutex_lock (&(P->mutex));
+	P->busy = P->num_workers - 1;
+	P->block_seq++;
+	pthread_cond_broadcast (&(P->start_cond));
+	pthread_mutex_unlock (&(P->mutex));
+
+	pool_do_share (chan, 0);
+
+	pthread_mutex_lock (&(P->mutex));
+	while (P->busy > 0) {
+	  pthread_cond_wait (&(P->done_cond), &(P->mutex));
+	}
+	pthread_mutex_unlock (&(P->mutex));
+#endif
+}
+
+static void pool_process_block (int chan, const int16_t *samples, int n)
+{
+	struct pool_s *P = &pool[chan];
+
+	P->samples = samples;
+	P->n = n;
+	P->fixing = 0;
+	pool_round (chan);
+
+	P->fixing = 1;
+	pool_round (chan);
+}
+
+
+/*------------------------------------------------------------------------------
+ *
+ * Name:	age_candidates
+ * 
+ * Purpose:	Advance the age of candidates and pick the best when the 
+ *		oldest has waited long enough.
+ *
+ * Inputs:	chan	- Radio channel number
+ *
+ *		n	- Number of samples just processed.
+ *
+ * Description:	A candidate received at position 'pos' in the block has
+ *		'when' = sample_count + pos.  After adding n to sample_count,
+ *		its age is the number of samples since it was received,
+ *		the same as if we had incremented it after every sample.
+ *
+ *		When the oldest candidate has an age greater than process_age,
+ *		it would have been picked some time during the block.
+ *		Only candidates received before that point were available
+ *		at the time so the others are set aside for the next round.
+ *
+ *		Version 1.5:  Candidates are no longer visited after every
+ *		block.  Nothing happens until the earliest deadline passes.
+ *
+ *------------------------------------------------------------------------------*/
+
+static void age_candidates (int chan, int n)
+{
+	int subchan, slice;
+	int64_t first = NO_CANDIDATE;
+
+	__atomic_store_n (&(sample_count[chan]), sample_count[chan] + n, __ATOMIC_RELEASE);
+
 	for (subchan = 0; subchan < save_audio_config_p->achan[chan].num_subchan; subchan++) {
-	  int slice;
+	  if (earliest[chan][subchan] < first) {
+	    first = earliest[chan][subchan];
+	  }
+	}
 
-	  for (slice = 0; slice < save_audio_config_p->achan[chan].num_slicers; slice++) {
+	if (first == NO_CANDIDATE || sample_count[chan] - first <= process_age[chan]) {
+	  return;
+	}
+
+	while (1) {
+	  int oldest = -1;
+	  int too_young;
+	  struct candidate_s later[MAX_SUBCHANS][MAX_SLICERS];
+
+	  for (subchan = 0; subchan < save_audio_config_p->achan[chan].num_subchan; subchan++) {
+	    for (slice = 0; slice < save_audio_config_p->achan[chan].num_slicers; slice++) {
+	      if (candidate[chan][subchan][slice].packet_p != NULL &&
+	          sample_count[chan] - candidate[chan][subchan][slice].when > oldest) {
+	        oldest = (int)(sample_count[chan] - candidate[chan][subchan][slice].when);
+	      }
+	    }
+	  }
+
+	  if (oldest <= process_age[chan]) {
+	    break;
+	  }
+
+	  too_young = oldest - process_age[chan];
+
+	  for (subchan = 0; subchan < save_audio_config_p->achan[chan].num_subchan; subchan++) {
+	    for (slice = 0; slice < save_audio_config_p->achan[chan].num_slicers; slice++) {
+	      later[subchan][slice].packet_p = NULL;
+	      if (candidate[chan][subchan][slice].packet_p != NULL &&
+	          sample_count[chan] - candidate[chan][subchan][slice].when < too_young) {
+	        later[subchan][slice] = candidate[chan][subchan][slice];
+	        candidate[chan][subchan][slice].packet_p = NULL;
+	      }
+	    }
+	  }
 
-	    if (candidate[chan][subchan][slice].packet_p != NULL) {
-	      candidate[chan][subchan][slice].age++;
-	      if (candidate[chan][subchan][slice].age > process_age[chan]) {
-	        pick_best_candidate (chan);
+	  pick_best_candidate (chan);
+
+	  for (subchan = 0; subchan < save_audio_config_p->achan[chan].num_subchan; subchan++) {
+	    for (slice = 0; slice < save_audio_config_p->achan[chan].num_slicers; slice++) {
+	      if (later[subchan][slice].packet_p != NULL) {
+	        candidate[chan][subchan][slice] = later[subchan][slice];
 	      }
 	    }
 	  }
 	}
+
+/*
+ * Next deadline from those left.
+ */
+	for (subchan = 0; subchan < save_audio_config_p->achan[chan].num_subchan; subchan++) {
+	  earliest[chan][subchan] = NO_CANDIDATE;
+	  for (slice = 0; slice < save_audio_config_p->achan[chan].num_slicers; slice++) {
+	    if (candidate[chan][subchan][slice].packet_p != NULL &&
+	        candidate[chan][subchan][slice].when < earliest[chan][subchan]) {
+	      earliest[chan][subchan] = candidate[chan][subchan][slice].when;
+	    }
+	  }
+	}
 }
 
 
@@ -532,13 +1050,221 @@ void multi_modem_process_rec_frame (int chan, int subchan, int slice, unsigned c
 	candidate[chan][subchan][slice].packet_p = pp;
 	candidate[chan][subchan][slice].alevel = alevel;
 	candidate[chan][subchan][slice].retries = retries;
-	candidate[chan][subchan][slice].age = 0;
+	candidate[chan][subchan][slice].when = __atomic_load_n (&(sample_count[chan]), __ATOMIC_ACQUIRE) + demod_get_block_pos (chan, subchan);	/* See age_candidates. */
+
+	if (candidate[chan][subchan][slice].when < earliest[chan][subchan]) {
+	  earliest[chan][subchan] = candidate[chan][subchan][slice].when;
+	}
+
+	if (retries == RETRY_NONE) {
+	  uint64_t r = ((uint64_t)((flen + 2) * 8) << 32) | (uint32_t)(candidate[chan][subchan][slice].when);
+	  __atomic_store_n (&(recent[chan][subchan][slice]), r, __ATOMIC_RELEASE);
+	}
 	candidate[chan][subchan][slice].crc = ax25_m_m_crc(pp);
 }
 
 
 
 
+/*-------------------------------------------------------------------
+ *
+ * Name:        multi_modem_sibling_has_frame
+ *
+ * Purpose:     Find out if another subchannel or slicer already has
+ *		the frame that we are trying to fix.
+ *
+ * Inputs:	chan, subchan, slice - Where the bad frame came from.
+ *
+ *		nbits	- Number of raw bits in the bad frame, or 0 to
+ *			  go by timing alone.
+ *
+ * Returns:	1 if a different subchannel or slicer, of the same channel,
+ *		received a good frame, without fixing, that ended within
+ *		process_age samples of our current position.  That must be
+ *		the same transmission.
+ *		If nbits is given, the length must also be about right,
+ *		allowing for bit stuffing and a few bits gained or lost.
+ *
+ * Description:	Version 1.5:  Used to skip a search for bits to invert
+ *		when someone else already got it.  This is called only while
+ *		fixing, after all subchannels have demodulated the block,
+ *		so the answer doesn't depend on the number of threads.
+ *
+ *		This looks at the most recent good frame from each, rather 
+ *		than the candidates, so it still works after the best
+ *		candidate has been picked and sent along.
+ *
+ *--------------------------------------------------------------------*/
+
+int multi_modem_sibling_has_frame (int chan, int subchan, int slice, int nbits)
+{
+	uint32_t now = (uint32_t)(__atomic_load_n (&(sample_count[chan]), __ATOMIC_ACQUIRE) + demod_get_block_pos (chan, subchan));
+	int j, k;
+
+	for (j = 0; j < save_audio_config_p->achan[chan].num_subchan; j++) {
+	  for (k = 0; k < save_audio_config_p->achan[chan].num_slicers; k++) {
+	    uint64_t r = __atomic_load_n (&(recent[chan][j][k]), __ATOMIC_ACQUIRE);
+	    int r_nbits = (int)(r >> 32);
+
+	    if ((j != subchan || k != slice) && r_nbits > 0) {
+	      int elapsed = (int)(now - (uint32_t)r);
+
+	      if (elapsed >= -process_age[chan] && elapsed <= process_age[chan] &&
+		  (nbits == 0 || (nbits >= r_nbits - 8 && nbits <= r_nbits + r_nbits / 5 + 8))) {
+	        return (1);
+	      }
+	    }
+	  }
+	}
+	return (0);
+}
+
+
+
+/*-------------------------------------------------------------------
+ *
+ * Name:        governor_update
+ *
+ * Purpose:     Version 1.5:  Give up, or take back, marginal work
+ *		depending on how well we are keeping up with the audio.
+ *
+ * Inputs:	chan	- Radio channel.
+ *		n	- Number of audio samples just processed.
+ *		elapsed	- Seconds it took.
+ *
+ * Description:	See "CPU budget governor" near the beginning.
+ *		This is called, by the audio receive thread, after the
+ *		block is finished so none of the demodulators, or threads
+ *		helping with fixes, are running for this channel.
+ *
+ *--------------------------------------------------------------------*/
+
+static int governor_slicers_off (int chan)
+{
+	int num_slicers = save_audio_config_p->achan[chan].num_slicers;
+	int s = gov[chan].step - gov[chan].fix_steps;
+
+	if (s <= 0) {
+	  return (0);
+	}
+	if (s >= gov[chan].slicer_steps) {
+	  return ((num_slicers - 1) / 2);	/* Only the middle one. */
+	}
+	return ((num_slicers - 3) / 2);		/* Middle 3. */
+}
+
+
+static void governor_update (int chan, int n, double elapsed)
+{
+	struct governor_s *g = &(gov[chan]);
+	int samples_per_sec = save_audio_config_p->adev[ACHAN2ADEV(chan)].samples_per_sec;
+	float limit = save_audio_config_p->achan[chan].governor / 100.0f;
+	float k;
+	int64_t held;
+	int prev_off, off;
+	int subchan, slice;
+
+	if (n <= 0 || samples_per_sec <= 0) {
+	  return;
+	}
+
+	k = (float)n / (GOV_AVERAGE * samples_per_sec);
+	if (k > 1) k = 1;
+	g->load += k * ((float)(elapsed * samples_per_sec / n) - g->load);
+
+	held = sample_count[chan] - g->since;
+	prev_off = governor_slicers_off (chan);
+
+	if (g->load > limit && g->step < g->fix_steps + g->slicer_steps && held >= GOV_HOLD_DOWN * samples_per_sec) {
+	  g->step++;
+	}
+	else if (g->load < limit / 2 && g->step > 0 && held >= GOV_HOLD_UP * samples_per_sec) {
+	  g->step--;
+	}
+	else {
+	  return;
+	}
+
+	g->since = sample_count[chan];
+
+	off = governor_slicers_off (chan);
+	if (off != prev_off) {
+	  for (subchan = 0; subchan < save_audio_config_p->achan[chan].num_subchan; subchan++) {
+	    demod_set_slicers_off (chan, subchan, off);
+
+	    /* Anything in progress, for slicers no longer used, is abandoned. */
+
+	    for (slice = prev_off; slice < off; slice++) {
+	      hdlc_rec_slicer_idle (chan, subchan, slice);
+	      hdlc_rec_slicer_idle (chan, subchan, save_audio_config_p->achan[chan].num_slicers - 1 - slice);
+	    }
+	  }
+	}
+
+	text_color_set(DW_COLOR_INFO);
+	dw_printf ("Channel %d: Processing is taking %d%% of real time.  Now using FIX_BITS %d and %d slicer%s.\n",
+			chan, (int)(g->load * 100.0f + 0.5f), multi_modem_fix_bits (chan),
+			save_audio_config_p->achan[chan].num_slicers - 2 * off,
+			save_audio_config_p->achan[chan].num_slicers - 2 * off == 1 ? "" : "s");
+}
+
+
+/*-------------------------------------------------------------------
+ *
+ * Name:        multi_modem_fix_bits
+ *
+ * Purpose:     Version 1.5:  Level of effort for fixing frames right now.
+ *
+ * Inputs:	chan	- Radio channel.
+ *
+ * Returns:	The configured FIX_BITS unless the governor has lowered it.
+ *
+ *--------------------------------------------------------------------*/
+
+retry_t multi_modem_fix_bits (int chan)
+{
+	int fix_bits = save_audio_config_p->achan[chan].fix_bits;
+	int step = gov[chan].step;
+
+	if (step > gov[chan].fix_steps) {
+	  step = gov[chan].fix_steps;
+	}
+	return ((retry_t)(fix_bits - step));
+}
+
+
+/*-------------------------------------------------------------------
+ *
+ * Name:        multi_modem_get_load
+ *
+ * Purpose:     Version 1.5:  Report on the governor for audio statistics.
+ *
+ * Inputs:	chan	- Radio channel.
+ *
+ * Outputs:	fix_bits - FIX_BITS level in use now.
+ *		fix_reduced - True if the governor has lowered it.
+ *		slicers	- Number of slicers in use now.
+ *		slicers_reduced - True if the governor has turned some off.
+ *
+ * Returns:	Average processing time as percent of real time.
+ *		-1 if the governor is not enabled for the channel.
+ *
+ *--------------------------------------------------------------------*/
+
+int multi_modem_get_load (int chan, int *fix_bits, int *fix_reduced, int *slicers, int *slicers_reduced)
+{
+	*fix_bits = multi_modem_fix_bits (chan);
+	*fix_reduced = *fix_bits < (int)(save_audio_config_p->achan[chan].fix_bits);
+	*slicers = save_audio_config_p->achan[chan].num_slicers - 2 * governor_slicers_off (chan);
+	*slicers_reduced = governor_slicers_off (chan) > 0;
+
+	if (save_audio_config_p->achan[chan].governor <= 0) {
+	  return (-1);
+	}
+	return ((int)(gov[chan].load * 100.0f + 0.5f));
+}
+
+
 /*-------------------------------------------------------------------
  *
  * Name:        pick_best_candidate
@@ -566,7 +1292,9 @@ static void pick_best_candidate (int chan)
 {
 	int best_n, best_score;
 	char spectrum[MAX_SUBCHANS*MAX_SLICERS+1];
-	int n, j, k;
+	int present[MAX_SUBCHANS*MAX_SLICERS];	/* Version 1.5:  Those with a candidate, */
+	int num_present = 0;			/* so we don't keep visiting empty slots. */
+	int n, i, j, k;
 	int num_bars = save_audio_config_p->achan[chan].num_slicers * save_audio_config_p->achan[chan].num_subchan;
 
 	memset (spectrum, 0, sizeof(spectrum));
@@ -602,29 +1330,30 @@ static void pick_best_candidate (int chan)
 	    /* score should now be 1 for anything received.  */
 
 	    candidate[chan][j][k].score = RETRY_MAX * 1000 - ((int)candidate[chan][j][k].retries * 1000) + 1;
+
+	    present[num_present++] = n;
 	  }
 	}
 
 	/* Bump it up slightly if others nearby have the same CRC. */
+	/* Each matching pair is found once and both get the same bump. */
 
-	for (n = 0; n < num_bars; n++) {
-	  int m;
+	for (i = 0; i < num_present; i++) {
+	  int h;
 
+	  n = present[i];
 	  j = subchan_from_n(n);
 	  k = slice_from_n(n);
 
-	  if (candidate[chan][j][k].packet_p != NULL) {
-
-	    for (m = 0; m < num_bars; m++) {
+	  for (h = i + 1; h < num_present; h++) {
 
-	      int mj = subchan_from_n(m);
-	      int mk = slice_from_n(m);
+	    int m = present[h];
+	    int mj = subchan_from_n(m);
+	    int mk = slice_from_n(m);
 
-	      if (m != n && candidate[chan][mj][mk].packet_p != NULL) {
-	        if (candidate[chan][j][k].crc == candidate[chan][mj][mk].crc) {
-	          candidate[chan][j][k].score += (num_bars+1) - abs(m-n);
-	        }
-	      }
+	    if (candidate[chan][j][k].crc == candidate[chan][mj][mk].crc) {
+	      candidate[chan][j][k].score += (num_bars+1) - abs(m-n);
+	      candidate[chan][mj][mk].score += (num_bars+1) - abs(m-n);
 	    }
 	  }
 	}
@@ -632,15 +1361,14 @@ static void pick_best_candidate (int chan)
 	best_n = 0;
 	best_score = 0;
 
-	for (n = 0; n < num_bars; n++) {
+	for (i = 0; i < num_present; i++) {
+	  n = present[i];
 	  j = subchan_from_n(n);
 	  k = slice_from_n(n);
 
-	  if (candidate[chan][j][k].packet_p != NULL) {
-	    if (candidate[chan][j][k].score > best_score) {
-	       best_score = candidate[chan][j][k].score;
-	       best_n = n;
-	    }
+	  if (candidate[chan][j][k].score > best_score) {
+	     best_score = candidate[chan][j][k].score;
+	     best_n = n;
 	  }
 	}
 
@@ -660,7 +1388,7 @@ static void pick_best_candidate (int chan)
 	    dw_printf ("%d.%d.%d: ptr=%p, retry=%d, age=%3d, crc=%04x, score=%d  %s\n", chan, j, k,
 		candidate[chan][j][k].packet_p,
 		(int)(candidate[chan][j][k].retries),
-		candidate[chan][j][k].age,
+		(int)(sample_count[chan] - candidate[chan][j][k].when),
 		candidate[chan][j][k].crc,
 		candidate[chan][j][k].score,
 		(n == best_n) ? "***" : "");
@@ -679,10 +1407,11 @@ static void pick_best_candidate (int chan)
 
 	/* Delete those not chosen. */
 
-	for (n = 0; n < num_bars; n++) {
+	for (i = 0; i < num_present; i++) {
+	  n = present[i];
 	  j = subchan_from_n(n);
 	  k = slice_from_n(n);
-	  if (n != best_n && candidate[chan][j][k].packet_p != NULL) {
+	  if (n != best_n) {
 	    ax25_delete (candidate[chan][j][k].packet_p);
 	    candidate[chan][j][k].packet_p = NULL;
 	  }
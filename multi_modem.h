@@ -9,13 +9,23 @@
 /* Needed for struct audio_s */
 #include "audio.h"
 
+#include <stdint.h>	/* for int16_t */
+
 
 void multi_modem_init (struct audio_s *pmodem); 
 
 void multi_modem_process_sample (int c, int audio_sample);
 
+void multi_modem_process_block (int chan, const int16_t *samples, int n);
+
 int multi_modem_get_dc_average (int chan);
 
 void multi_modem_process_rec_frame (int chan, int subchan, int slice, unsigned char *fbuf, int flen, alevel_t alevel, retry_t retries);
 
+int multi_modem_sibling_has_frame (int chan, int subchan, int slice, int nbits);
+
+retry_t multi_modem_fix_bits (int chan);
+
+int multi_modem_get_load (int chan, int *fix_bits, int *fix_reduced, int *slicers, int *slicers_reduced);
+
 #endif
@@ -122,6 +122,7 @@ typedef struct pfstate_s {
 
 /*
  * Packet split into separate parts if APRS.
+ * Version 1.5:  This is normally the result already attached to the packet.
  * Most interesting fields are:
  *
  *		g_symbol_table	- / \ or overlay
@@ -130,7 +131,7 @@ typedef struct pfstate_s {
  *		g_name		- for object or item
  *		g_comment
  */
-	decode_aprs_t decoded;
+	decode_aprs_t *decoded;
 
 /*
  * These are set by next_token.
@@ -158,6 +159,11 @@ static int filt_r (pfstate_t *pf, char *sdist);
 static int filt_s (pfstate_t *pf);
 static int filt_i (pfstate_t *pf);
 
+/* Used when not APRS.  Never written. */
+
+static decode_aprs_t s_not_aprs;
+
+
 static char *bool2text (int val)
 {
 	if (val == 1) return "TRUE";
@@ -198,6 +204,7 @@ static char *bool2text (int val)
 int pfilter (int from_chan, int to_chan, char *filter, packet_t pp, int is_aprs)
 {
 	pfstate_t pfstate;
+	decode_aprs_t decoded;
 	char *p;
 	int result;
 
@@ -235,7 +242,16 @@ int pfilter (int from_chan, int to_chan, char *filter, packet_t pp, int is_aprs)
 	pfstate.is_aprs = is_aprs;
 
 	if (is_aprs) {
-	  decode_aprs (&pfstate.decoded, pp, 1);
+	  if (ax25_is_frozen(pp)) {
+	    pfstate.decoded = decode_aprs_cached (pp, 1);
+	  }
+	  else {
+	    decode_aprs (&decoded, pp, 1);
+	    pfstate.decoded = &decoded;
+	  }
+	}
+	else {
+	  pfstate.decoded = &s_not_aprs;
 	}
 
 	next_token(&pfstate);
@@ -560,11 +576,11 @@ static int parse_filter_spec (pfstate_t *pf)
 /* o - object or item name */
 
 	else if (pf->token_str[0] == 'o' && ispunct(pf->token_str[1])) {
-	  result = filt_bodgu (pf, pf->decoded.g_name);
+	  result = filt_bodgu (pf, pf->decoded->g_name);
 
 	  if (s_debug >= 2) {
 	    text_color_set(DW_COLOR_DEBUG);
-	    dw_printf ("   %s returns %s for %s\n", pf->token_str, bool2text(result), pf->decoded.g_name);
+	    dw_printf ("   %s returns %s for %s\n", pf->token_str, bool2text(result), pf->decoded->g_name);
 	  }
 	}
 
@@ -627,11 +643,11 @@ static int parse_filter_spec (pfstate_t *pf)
 
 	else if (pf->token_str[0] == 'g' && ispunct(pf->token_str[1])) {
 	  if (ax25_get_dti(pf->pp) == ':') {
-	    result = filt_bodgu (pf, pf->decoded.g_addressee);
+	    result = filt_bodgu (pf, pf->decoded->g_addressee);
 
 	    if (s_debug >= 2) {
 	      text_color_set(DW_COLOR_DEBUG);
-	      dw_printf ("   %s returns %s for %s\n", pf->token_str, bool2text(result), pf->decoded.g_addressee);
+	      dw_printf ("   %s returns %s for %s\n", pf->token_str, bool2text(result), pf->decoded->g_addressee);
 	    }
 	  }
 	  else {
@@ -705,14 +721,14 @@ static int parse_filter_spec (pfstate_t *pf)
 
 	  if (s_debug >= 2) {
 	    text_color_set(DW_COLOR_DEBUG);
-	    if (pf->decoded.g_symbol_table == '/') {
-	      dw_printf ("   %s returns %s for symbol %c in primary table\n", pf->token_str, bool2text(result), pf->decoded.g_symbol_code);
+	    if (pf->decoded->g_symbol_table == '/') {
+	      dw_printf ("   %s returns %s for symbol %c in primary table\n", pf->token_str, bool2text(result), pf->decoded->g_symbol_code);
 	    }
-	    else if (pf->decoded.g_symbol_table == '\\') {
-	      dw_printf ("   %s returns %s for symbol %c in alternate table\n", pf->token_str, bool2text(result), pf->decoded.g_symbol_code);
+	    else if (pf->decoded->g_symbol_table == '\\') {
+	      dw_printf ("   %s returns %s for symbol %c in alternate table\n", pf->token_str, bool2text(result), pf->decoded->g_symbol_code);
 	    }
 	    else {
-	      dw_printf ("   %s returns %s for symbol %c with overlay %c\n", pf->token_str, bool2text(result), pf->decoded.g_symbol_code, pf->decoded.g_symbol_table);
+	      dw_printf ("   %s returns %s for symbol %c with overlay %c\n", pf->token_str, bool2text(result), pf->decoded->g_symbol_code, pf->decoded->g_symbol_table);
 	    }
 	  }
 	}
@@ -729,7 +745,7 @@ static int parse_filter_spec (pfstate_t *pf)
 
 	    text_color_set(DW_COLOR_DEBUG);
 	    if (*infop == ':' && ! is_telem_metadata(infop)) {
-	      dw_printf ("   %s returns %s for message to %s\n", pf->token_str, bool2text(result), pf->decoded.g_addressee);
+	      dw_printf ("   %s returns %s for message to %s\n", pf->token_str, bool2text(result), pf->decoded->g_addressee);
 	    }
 	    else {
 	      dw_printf ("   %s returns %s for not an APRS 'message'\n", pf->token_str, bool2text(result));
@@ -936,12 +952,12 @@ static int filt_t (pfstate_t *pf)
 	      /* Positions !=/@ with symbol code _ are weather. */
 
 	      if (strchr("!=/@", *infop) != NULL &&
-			pf->decoded.g_symbol_code == '_') return (1);
+			pf->decoded->g_symbol_code == '_') return (1);
 
 	      /* Object with _ symbol is also weather.  APRS protocol spec page 66. */
 
 	      if (*infop == ';' &&
-			pf->decoded.g_symbol_code == '_') return (1);
+			pf->decoded->g_symbol_code == '_') return (1);
 
 // TODO: need more test cases at end for new weather cases.
 
@@ -1003,7 +1019,7 @@ static int filt_t (pfstate_t *pf)
  *
  *			  We also need to know the location (if any) from the packet.
  *
- *				decoded.g_lat & decoded.g_lon
+ *				decoded->g_lat & decoded->g_lon
  *
  * Outputs:	sdist	- Distance as a string for troubleshooting.
  *
@@ -1029,7 +1045,7 @@ static int filt_r (pfstate_t *pf, char *sdist)
 	sep[1] = '\0';
 	cp = str + 2;
 
-	if (pf->decoded.g_lat == G_UNKNOWN || pf->decoded.g_lon == G_UNKNOWN) {
+	if (pf->decoded->g_lat == G_UNKNOWN || pf->decoded->g_lon == G_UNKNOWN) {
 	  return (0);
 	}
 
@@ -1054,7 +1070,7 @@ static int filt_r (pfstate_t *pf, char *sdist)
 	}
 	ddist = atof(v);
 
-	km = ll_distance_km (dlat, dlon, pf->decoded.g_lat, pf->decoded.g_lon);
+	km = ll_distance_km (dlat, dlon, pf->decoded->g_lat, pf->decoded->g_lon);
 
 	sprintf (sdist, "%.2f km", km);
 
@@ -1218,16 +1234,16 @@ static int filt_s (pfstate_t *pf)
 // This applies only for Position, Object, Item.
 // decode_aprs() should set symbol code to space to mean undefined.
 
-	if (pf->decoded.g_symbol_code == ' ') {
+	if (pf->decoded->g_symbol_code == ' ') {
 	  return (0);
 	}
 
 
 // Look for Primary symbols.
 
-	if (pf->decoded.g_symbol_table == '/') {
+	if (pf->decoded->g_symbol_table == '/') {
 	  if (pri != NULL && strlen(pri) > 0) {
-	    return (strchr(pri, pf->decoded.g_symbol_code) != NULL);
+	    return (strchr(pri, pf->decoded->g_symbol_code) != NULL);
 	  }
 	}
 
@@ -1235,11 +1251,11 @@ static int filt_s (pfstate_t *pf)
 	  return (0);
 	}
 
-	//printf ("alt=\"%s\"  sym='%c'\n", alt, pf->decoded.g_symbol_code);
+	//printf ("alt=\"%s\"  sym='%c'\n", alt, pf->decoded->g_symbol_code);
 
 // Look for Alternate symbols.
 
-	if (strchr(alt, pf->decoded.g_symbol_code) != NULL) {
+	if (strchr(alt, pf->decoded->g_symbol_code) != NULL) {
 
 	  // We have a match but that might not be enough.
 	  // We must see if there was an overlay part specified.
@@ -1251,21 +1267,21 @@ static int filt_s (pfstate_t *pf)
 	      // Non-zero length overlay part was specified.
 	      // Need to match one of them.
 
-	      return (strchr(over, pf->decoded.g_symbol_table) != NULL);
+	      return (strchr(over, pf->decoded->g_symbol_table) != NULL);
 	    }
 	    else {
 
 	      // Zero length overlay part was specified.
 	      // We must have no overlay, i.e.  table is \.
 
-	      return (pf->decoded.g_symbol_table == '\\');
+	      return (pf->decoded->g_symbol_table == '\\');
 	    }
 	  }
 	  else {
 
 	    // No check of overlay part.  Just make sure it is not primary table.
 
-	    return (pf->decoded.g_symbol_table != '/');
+	    return (pf->decoded->g_symbol_table != '/');
 	  }
 	}
 
@@ -1414,7 +1430,7 @@ static int filt_i (pfstate_t *pf)
 
 /*
  * Get source address and info part.
- * Addressee has already been extracted into pf->decoded.g_addressee.
+ * Addressee has already been extracted into pf->decoded->g_addressee.
  */
 
 	memset (src, 0, sizeof(src));
@@ -1448,7 +1464,7 @@ static int filt_i (pfstate_t *pf)
  *	 period (range defined as digi hops, distance, or both)."
  */
 
-	int was_heard = mheard_was_recently_nearby ("addressee", pf->decoded.g_addressee, heardtime, maxhops, dlat, dlon, km);
+	int was_heard = mheard_was_recently_nearby ("addressee", pf->decoded->g_addressee, heardtime, maxhops, dlat, dlon, km);
 
 	if ( ! was_heard) return (0);
 
@@ -65,6 +65,7 @@
  *					for each audio device.
  *					Each thread reads audio samples and
  *					passes them to multi_modem_process_sample.
+ *					(Version 1.5: multi_modem_process_block.)
  *
  *					The difference is that app_process_rec_frame
  *					is no longer called directly.  Instead
@@ -78,6 +79,15 @@
  *					in the dlq queue and calls app_process_rec_frame
  *					for each.
  *
+ *		Version 1.5:  With "SPLIT_CHANNELS ON" for a stereo device,
+ *		the thread for the audio device only separates the left
+ *		and right samples.  Each channel has its own thread doing
+ *		the demodulation so the two can run on different processor
+ *		cores.  Blocks of audio are passed along in a ring buffer
+ *		with one writer and one reader so no lock is needed for
+ *		the normal case.  We only need to sleep, and be woken up,
+ *		when the ring is empty or full.
+ *
  *---------------------------------------------------------------*/
 
 //#define DEBUG 1
@@ -110,12 +120,57 @@
 #include "ax25_link.h"
 
 
+#if __WIN32__
+#include <process.h>
+#endif
+
 #if __WIN32__
 static unsigned __stdcall recv_adev_thread (void *arg);
+static unsigned __stdcall recv_chan_thread (void *arg);
 #else
 static void * recv_adev_thread (void *arg);
+static void * recv_chan_thread (void *arg);
+#endif
+
+
+/*
+ * Version 1.5:  Ring buffer for passing audio from device thread to channel thread.
+ *
+ * head is changed only by the writer, tail only by the reader.
+ * The difference is the number of blocks waiting to be processed.
+ * A block with fewer than DEMOD_BLOCK_SIZE samples marks end of input.
+ */
+
+#define RING_BLOCKS 32		/* About 1/6 second at 48000 samples per second. */
+
+static struct ring_s {
+
+	int16_t samples[RING_BLOCKS][DEMOD_BLOCK_SIZE];
+	int n[RING_BLOCKS];
+
+	unsigned int head;		/* Next block to be written. */
+	unsigned int tail;		/* Next block to be read. */
+
+	int writer_waiting;		/* Set while writer is waiting for space. */
+	int reader_waiting;		/* Set while reader is waiting for data. */
+
+#if __WIN32__
+	HANDLE space_event;
+	HANDLE data_event;
+#else
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
 #endif
 
+} *ring[MAX_CHANS];		/* Allocated only for channels with their own thread. */
+
+static void ring_init (int chan);
+static void ring_put (int chan, const int16_t *samples, int n);
+static int ring_get (int chan, int16_t *samples);
+static void ring_drain (int chan);
+
+static void process_chan_block (int chan, int16_t *samples, int n);
+
 
 static struct audio_s *save_pa;		/* Keep pointer to audio configuration */
 					/* for later use. */
@@ -154,6 +209,37 @@ void recv_init (struct audio_s *pa)
 
 	  if (pa->adev[a].defined) {
 
+/*
+ * Version 1.5:  Optional separate thread for each channel of a stereo device.
+ * These must be ready before the audio device thread starts.
+ */
+	    if (pa->adev[a].split_channels && pa->adev[a].num_channels == 2) {
+	      int c;
+
+	      for (c = ADEVFIRSTCHAN(a); c < ADEVFIRSTCHAN(a) + 2; c++) {
+
+	        ring_init (c);
+#if __WIN32__
+	        HANDLE chan_th;
+	        chan_th = (HANDLE)_beginthreadex (NULL, 0, recv_chan_thread, (void*)(long)c, 0, NULL);
+	        if (chan_th == NULL) {
+	          text_color_set(DW_COLOR_ERROR);
+	          dw_printf ("FATAL: Could not create receive thread for channel %d.\n", c);
+	          exit(1);
+	        }
+#else
+	        pthread_t chan_tid;
+	        int e;
+	        e = pthread_create (&chan_tid, NULL, recv_chan_thread, (void *)(long)c);
+	        if (e != 0) {
+	          text_color_set(DW_COLOR_ERROR);
+	          dw_printf ("FATAL: Could not create receive thread for channel %d.\n", c);
+	          exit(1);
+	        }
+#endif
+	      }
+	    }
+
 #if DEBUG
 	    text_color_set(DW_COLOR_DEBUG);
 	    dw_printf ("recv_init: start up thread, a=%d\n", a);
@@ -205,6 +291,7 @@ static void * recv_adev_thread (void *arg)
 {
 	int a = (int)(long)arg;	// audio device number.
 	int eof;
+	int c;
 	
 	/* This audio device can have one (mono) or two (stereo) channels. */
 	/* Find number of the first channel. */
@@ -223,44 +310,24 @@ static void * recv_adev_thread (void *arg)
 	while ( ! eof) 
 	{
 
-	  int audio_sample;
-	  int c;
-	  char tt;
+	  int16_t samples[2][DEMOD_BLOCK_SIZE];	/* [0] is left, [1] is right. */
+	  int n;
+
+	  /* Version 1.5: Process a block of samples at a time rather than */
+	  /* one at a time.  This greatly reduces the overhead per sample. */
+
+	  n = demod_get_block (a, num_chan, samples);
+
+	  if (n < DEMOD_BLOCK_SIZE) 
+	    eof = 1;
 
 	  for (c=0; c<num_chan; c++)
 	  {
-	    audio_sample = demod_get_sample (a);
-	  
- 	    if (audio_sample >= 256 * 256) 
-	      eof = 1;
-
-	    multi_modem_process_sample(first_chan + c, audio_sample);
-
-
-	    /* Originally, the DTMF decoder was always active. */
-	    /* It took very little CPU time and the thinking was that an */
-	    /* attached application might be interested in this even when */
-	    /* the APRStt gateway was not being used.  */
-
-	    /* Unfortunately it resulted in too many false detections of */
-	    /* touch tones when hearing other types of digital communications */
-	    /* on HF.  Starting in version 1.0, the DTMF decoder is active */
-	    /* only when the APRStt gateway is configured. */
-
-	    /* The test below allows us to listen to only a single channel for */
-	    /* for touch tone sequences.  The DTMF decoder and the accumulation */
-	    /* of digits into a sequence maintain separate data for each channel. */
-	    /* We should be able to accept touch tone sequences concurrently on */
-	    /* all channels.  The only issue is when a complete sequence is */
-	    /* sent to aprs_tt_sequence which doesn't have separate data for each */
-	    /* channel.  This shouldn't be a problem unless we have multiple */
-	    /* sequences arriving at the same instant. */
-
-	    if (save_pa->achan[first_chan + c].dtmf_decode != DTMF_DECODE_OFF) {
-	      tt = dtmf_sample (first_chan + c, audio_sample/16384.);
-	      if (tt != ' ') {
-	        aprs_tt_button (first_chan + c, tt);
-	      }
+	    if (ring[first_chan + c] != NULL) {
+	      ring_put (first_chan + c, samples[c], n);
+	    }
+	    else {
+	      process_chan_block (first_chan + c, samples[c], n);
 	    }
 	  }
 
@@ -271,6 +338,15 @@ static void * recv_adev_thread (void *arg)
 
 	}
 
+/*
+ * Let the channel threads finish what was already read.
+ */
+	for (c=0; c<num_chan; c++) {
+	  if (ring[first_chan + c] != NULL) {
+	    ring_drain (first_chan + c);
+	  }
+	}
+
 // What should we do now?
 // Seimply terminate the application?  
 // Try to re-init the audio device a couple times before giving up?
@@ -284,6 +360,228 @@ static void * recv_adev_thread (void *arg)
 
 
 
+
+/*------------------------------------------------------------------
+ *
+ * Name:        process_chan_block
+ *
+ * Purpose:     Demodulate a block of audio for one channel.
+ *
+ * Inputs:	chan		- Radio channel number.
+ *
+ *		samples		- Audio samples for this channel.
+ *
+ *		n		- Number of samples.
+ *
+ * Description:	Called from the audio device thread or, for a split
+ *		stereo device, the channel's own thread.
+ *
+ *----------------------------------------------------------------*/
+
+__attribute__((hot))
+static void process_chan_block (int chan, int16_t *samples, int n)
+{
+	int k;
+	char tt;
+
+	multi_modem_process_block (chan, samples, n);
+
+	/* Originally, the DTMF decoder was always active. */
+	/* It took very little CPU time and the thinking was that an */
+	/* attached application might be interested in this even when */
+	/* the APRStt gateway was not being used.  */
+
+	/* Unfortunately it resulted in too many false detections of */
+	/* touch tones when hearing other types of digital communications */
+	/* on HF.  Starting in version 1.0, the DTMF decoder is active */
+	/* only when the APRStt gateway is configured. */
+
+	/* The test below allows us to listen to only a single channel for */
+	/* for touch tone sequences.  The DTMF decoder and the accumulation */
+	/* of digits into a sequence maintain separate data for each channel. */
+	/* We should be able to accept touch tone sequences concurrently on */
+	/* all channels.  The only issue is when a complete sequence is */
+	/* sent to aprs_tt_sequence which doesn't have separate data for each */
+	/* channel.  This shouldn't be a problem unless we have multiple */
+	/* sequences arriving at the same instant. */
+
+	if (save_pa->achan[chan].dtmf_decode != DTMF_DECODE_OFF) {
+	  for (k=0; k<n; k++) {
+	    tt = dtmf_sample (chan, samples[k]/16384.);
+	    if (tt != ' ') {
+	      aprs_tt_button (chan, tt);
+	    }
+	  }
+	}
+
+} /* end process_chan_block */
+
+
+
+/*------------------------------------------------------------------
+ *
+ * Name:        recv_chan_thread
+ *
+ * Purpose:     Demodulate one channel of a split stereo device.
+ *
+ * Inputs:	arg		- Radio channel number.
+ *
+ * Description:	Take blocks of audio from the ring buffer, filled
+ *		by the audio device thread, until end of input.
+ *
+ *----------------------------------------------------------------*/
+
+__attribute__((hot))
+#if __WIN32__
+static unsigned __stdcall recv_chan_thread (void *arg)
+#else
+static void * recv_chan_thread (void *arg)
+#endif
+{
+	int chan = (int)(long)arg;
+	int16_t samples[DEMOD_BLOCK_SIZE];
+	int n;
+
+	do {
+	  n = ring_get (chan, samples);
+	  process_chan_block (chan, samples, n);
+	} while (n == DEMOD_BLOCK_SIZE);
+
+	return (0);
+}
+
+
+/*
+ * Ring buffer operations.
+ *
+ * The head and tail are read and written with atomic operations.
+ * A side that must wait sets its flag, then checks again, before sleeping.
+ * The other side updates head or tail, then checks the flag.
+ * With sequentially consistent ordering, at least one of them
+ * must see the other's change so a wake up can't be lost.
+ */
+
+static void ring_init (int chan)
+{
+	struct ring_s *r;
+
+	r = calloc (1, sizeof(struct ring_s));
+	if (r == NULL) {
+	  text_color_set(DW_COLOR_ERROR);
+	  dw_printf ("FATAL: Out of memory for channel %d receive buffer.\n", chan);
+	  exit (1);
+	}
+#if __WIN32__
+	r->space_event = CreateEvent (NULL, FALSE, FALSE, NULL);
+	r->data_event = CreateEvent (NULL, FALSE, FALSE, NULL);
+#else
+	pthread_mutex_init (&(r->mutex), NULL);
+	pthread_cond_init (&(r->cond), NULL);
+#endif
+	ring[chan] = r;
+}
+
+
+static int ring_count (struct ring_s *r)
+{
+	return (__atomic_load_n (&(r->head), __ATOMIC_SEQ_CST) - __atomic_load_n (&(r->tail), __ATOMIC_SEQ_CST));
+}
+
+
+/* Wait until number of blocks in ring is within the range. */
+
+static void ring_wait (struct ring_s *r, int *waiting, int min_count, int max_count)
+{
+	int count = ring_count (r);
+
+	if (count >= min_count && count <= max_count) return;
+
+	__atomic_store_n (waiting, 1, __ATOMIC_SEQ_CST);
+
+#if __WIN32__
+	count = ring_count (r);
+	while (count < min_count || count > max_count) {
+	  WaitForSingleObject (waiting == &(r->writer_waiting) ? r->space_event : r->data_event, INFINITE);
+	  count = ring_count (r);
+	}
+#else
+	pthread_mutex_lock (&(r->mutex));
+	count = ring_count (r);
+	while (count < min_count || count > max_count) {
+	  pthread_cond_wait (&(r->cond), &(r->mutex));
+	  count = ring_count (r);
+	}
+	pthread_mutex_unlock (&(r->mutex));
+#endif
+
+	__atomic_store_n (waiting, 0, __ATOMIC_SEQ_CST);
+}
+
+
+/* Wake up the other side if it is waiting. */
+
+static void ring_wake (struct ring_s *r, int *waiting)
+{
+	if (__atomic_load_n (waiting, __ATOMIC_SEQ_CST)) {
+#if __WIN32__
+	  SetEvent (waiting == &(r->writer_waiting) ? r->space_event : r->data_event);
+#else
+	  pthread_mutex_lock (&(r->mutex));
+	  pthread_cond_broadcast (&(r->cond));
+	  pthread_mutex_unlock (&(r->mutex));
+#endif
+	}
+}
+
+
+/* Writer, audio device thread.  Wait if full. */
+
+static void ring_put (int chan, const int16_t *samples, int n)
+{
+	struct ring_s *r = ring[chan];
+	int i;
+
+	ring_wait (r, &(r->writer_waiting), 0, RING_BLOCKS - 1);
+
+	i = r->head % RING_BLOCKS;
+	memcpy (r->samples[i], samples, n * sizeof(int16_t));
+	r->n[i] = n;
+
+	__atomic_store_n (&(r->head), r->head + 1, __ATOMIC_SEQ_CST);
+	ring_wake (r, &(r->reader_waiting));
+}
+
+
+/* Reader, channel thread.  Wait if empty.  Returns number of samples. */
+
+static int ring_get (int chan, int16_t *samples)
+{
+	struct ring_s *r = ring[chan];
+	int i, n;
+
+	ring_wait (r, &(r->reader_waiting), 1, RING_BLOCKS);
+
+	i = r->tail % RING_BLOCKS;
+	n = r->n[i];
+	memcpy (samples, r->samples[i], n * sizeof(int16_t));
+
+	__atomic_store_n (&(r->tail), r->tail + 1, __ATOMIC_SEQ_CST);
+	ring_wake (r, &(r->writer_waiting));
+
+	return (n);
+}
+
+
+/* Writer waits for reader to process everything. */
+
+static void ring_drain (int chan)
+{
+	struct ring_s *r = ring[chan];
+
+	ring_wait (r, &(r->writer_waiting), 0, 0);
+}
+
+
 void recv_process (void) 
 {
 
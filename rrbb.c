@@ -31,6 +31,13 @@
  *
  * Version 1.3:	Store as bytes rather than packing 8 bits per byte.
  *
+ * Version 1.5:	Keep a confidence value, from the demodulator, for each bit.
+ *
+ *		Pack 8 bits per byte again.  See FASTER13 in rrbb.h.
+ *
+ *		Reuse deleted ones rather than going back to malloc
+ *		and free for every frame candidate.
+ *
  *******************************************************************************/
 
 #define RRBB_C
@@ -55,6 +62,28 @@ static int new_count = 0;
 static int delete_count = 0;
 
 
+/*
+ * Version 1.5:  Deleted bit buffers are kept for reuse.
+ *
+ * There is a pool for each subchannel.  Only the thread demodulating
+ * that subchannel calls rrbb_new for it so only that one takes from
+ * 'avail'.  rrbb_delete could be called from elsewhere so deleted
+ * ones are pushed onto 'returned' without a lock.  When 'avail' runs
+ * out, the whole 'returned' list is taken at once.  With a single
+ * taker there is no ABA problem.
+ *
+ * Each slicer has one bit buffer collecting and hands it off when a
+ * frame ends.  It's deleted when decoding is done, so the pool never
+ * grows beyond the most that were in use at the same time.  After the
+ * first few frames there is no more malloc or free.
+ */
+
+static struct rrbb_pool_s {
+	rrbb_t avail;		/* Only taken by the subchannel's demodulator thread. */
+	rrbb_t returned;	/* Pushed by anyone. */
+} pool[MAX_CHANS][MAX_SUBCHANS];
+
+
 /***********************************************************************************
  *
  * Name:	rrbb_new	
@@ -87,7 +116,24 @@ rrbb_t rrbb_new (int chan, int subchan, int slice, int is_scrambled, int descram
 	assert (subchan >= 0 && subchan < MAX_SUBCHANS);
 	assert (slice >= 0 && slice < MAX_SLICERS);
 
-	result = malloc(sizeof(struct rrbb_s));
+	struct rrbb_pool_s *P = &(pool[chan][subchan]);
+
+	if (P->avail == NULL) {
+	  P->avail = __atomic_exchange_n (&(P->returned), NULL, __ATOMIC_ACQUIRE);
+	}
+
+	if (P->avail != NULL) {
+	  result = P->avail;
+	  P->avail = result->nextp;
+	}
+	else {
+	  result = malloc(sizeof(struct rrbb_s));
+	  if (result == NULL) {
+	    text_color_set(DW_COLOR_ERROR);
+	    dw_printf ("FATAL: Out of memory for received bit buffer.\n");
+	    exit (1);
+	  }
+	}
 
 	result->magic1 = MAGIC1;
 	result->chan = chan;
@@ -154,6 +200,7 @@ void rrbb_clear (rrbb_t b, int is_scrambled, int descram_state, int prev_descram
  *
  * Inputs:	Handle for sample array.
  *		Value for the sample.
+ *		Confidence.  0 for a coin toss up to 255 for certain.
  *
  ***********************************************************************************/
 
@@ -219,6 +266,40 @@ int rrbb_get_len (rrbb_t b)
 /* Definition in header file so it can be inlined. */
 
 
+/***********************************************************************************
+ *
+ * Name:	rrbb_get_conf	
+ *
+ * Purpose:	Version 1.5:  Get confidence of bit in specified position.
+ *
+ * Inputs:	Handle for sample array.
+ *		Index into array.
+ *
+ * Returns:	0 for a coin toss up to 255 for certain.
+ *		Only the order, within one block, is meaningful.
+ *		
+ ***********************************************************************************/
+
+/* Definition in header file so it can be inlined. */
+
+
+/***********************************************************************************
+ *
+ * Name:	rrbb_get_byte	
+ *
+ * Purpose:	Version 1.5:  Get 8 bits starting at specified position.
+ *
+ * Inputs:	Handle for sample array.
+ *		Index of first bit.  There must be at least 8 bits from here.
+ *
+ * Returns:	First bit in the least significant position,
+ *		the same order they are sent.
+ *		
+ ***********************************************************************************/
+
+/* Definition in header file so it can be inlined. */
+
+
 
 
 /***********************************************************************************
@@ -255,19 +336,30 @@ int rrbb_get_len (rrbb_t b)
  * Purpose:	Free the storage associated with the bit array.
  *
  * Inputs:	Handle for bit array.
+ *
+ * Description:	Version 1.5:  Returned to the pool for its subchannel
+ *		rather than freed.  This can be called from any thread.
  *		
  ***********************************************************************************/
 
 void rrbb_delete (rrbb_t b)
 {
+	struct rrbb_pool_s *P;
+	rrbb_t old;
+
 	assert (b != NULL);
 	assert (b->magic1 == MAGIC1);
 	assert (b->magic2 == MAGIC2);
 
 	b->magic1 = 0;
 	b->magic2 = 0;
-	
-	free (b);
+
+	P = &(pool[b->chan][b->subchan]);
+
+	old = __atomic_load_n (&(P->returned), __ATOMIC_RELAXED);
+	do {
+	  b->nextp = old;
+	} while ( ! __atomic_compare_exchange_n (&(P->returned), &old, b, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
 
 	delete_count++;
 }
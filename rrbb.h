@@ -4,7 +4,9 @@
 #define RRBB_H
 
 
-#define FASTER13 1		// Don't pack 8 samples per byte.
+//#define FASTER13 1		// Don't pack 8 samples per byte.
+				// Version 1.5:  Packed again.  Most bits are now
+				// taken 8 at a time with rrbb_get_byte.
 
 
 //typedef short slice_t;
@@ -39,7 +41,15 @@ typedef struct rrbb_s {
 	int descram_state;	/* Descrambler state before first data bit of frame. */
 	int prev_descram;	/* Previous descrambled bit. */
 
+#if FASTER13
 	unsigned char fdata[MAX_NUM_BITS];
+#else
+	unsigned char fdata[(MAX_NUM_BITS + 7) / 8 + 1];	/* First bit in LSB.  Extra octet so */
+								/* rrbb_get_byte can always take two. */
+#endif
+
+	unsigned char fconf[MAX_NUM_BITS];	/* Version 1.5:  How sure the demodulator was about */
+						/* each bit.  0 for a coin toss up to 255 for certain. */
 
 	int magic2;
 } *rrbb_t;
@@ -51,18 +61,51 @@ rrbb_t rrbb_new (int chan, int subchan, int slice, int is_scrambled, int descram
 void rrbb_clear (rrbb_t b, int is_scrambled, int descram_state, int prev_descram);
 
 
-static inline /*__attribute__((always_inline))*/ void rrbb_append_bit (rrbb_t b, const unsigned char val)
+static inline /*__attribute__((always_inline))*/ void rrbb_append_bit (rrbb_t b, const unsigned char val, const unsigned char conf)
 {
 	if (b->len >= MAX_NUM_BITS) {
 	  return;	/* Silently discard if full. */
 	}
+#if FASTER13
 	b->fdata[b->len] = val;
+#else
+	if (val) {
+	  b->fdata[b->len >> 3] |= 1 << (b->len & 7);
+	}
+	else {
+	  b->fdata[b->len >> 3] &= ~(1 << (b->len & 7));
+	}
+#endif
+	b->fconf[b->len] = conf;
 	b->len++;
 }
 
 static inline /*__attribute__((always_inline))*/ unsigned char rrbb_get_bit (const rrbb_t b, const int ind)
 {
+#if FASTER13
 	return (b->fdata[ind]);
+#else
+	return ((b->fdata[ind >> 3] >> (ind & 7)) & 1);
+#endif
+}
+
+static inline /*__attribute__((always_inline))*/ unsigned char rrbb_get_conf (const rrbb_t b, const int ind)
+{
+	return (b->fconf[ind]);
+}
+
+static inline /*__attribute__((always_inline))*/ unsigned char rrbb_get_byte (const rrbb_t b, const int ind)
+{
+#if FASTER13
+	const unsigned char *p = b->fdata + ind;
+
+	return (p[0] | (p[1] << 1) | (p[2] << 2) | (p[3] << 3) |
+		(p[4] << 4) | (p[5] << 5) | (p[6] << 6) | (p[7] << 7));
+#else
+	const unsigned char *p = b->fdata + (ind >> 3);
+
+	return (((p[0] | (p[1] << 8)) >> (ind & 7)) & 0xff);
+#endif
 }
 
 
@@ -1573,7 +1573,12 @@ static THREAD_F cmd_listen_thread (void *arg)
 		  /* xastir when using the AGW interface.  */
 		  /* The current version uses only the 'V' message, not 'K' for transmitting. */
 
-		  tq_append (cmd.hdr.portx, TQ_PRIO_1_LO, pp);
+		  if ( ! tq_wait_while_full (cmd.hdr.portx)) {
+		    ax25_delete (pp);
+		  }
+		  else {
+		    tq_append (cmd.hdr.portx, TQ_PRIO_1_LO, pp);
+		  }
 
 		}
 	      }
@@ -1619,7 +1624,13 @@ static THREAD_F cmd_listen_thread (void *arg)
 		  /* the high priority queue. */
 		  /* Otherwise, it is an original for the low priority queue. */
 
-		  if (ax25_get_num_repeaters(pp) >= 1 &&
+		  /* Version 1.5:  Don't take any more from the client while the */
+		  /* transmit queue is too long.  See TXQUEUE_LIMIT. */
+
+		  if ( ! tq_wait_while_full (cmd.hdr.portx)) {
+		    ax25_delete (pp);
+		  }
+		  else if (ax25_get_num_repeaters(pp) >= 1 &&
 		      ax25_get_h(pp,AX25_REPEATER_1)) {
 		    tq_append (cmd.hdr.portx, TQ_PRIO_0_HI, pp);
 		  }
@@ -1840,6 +1851,9 @@ static THREAD_F cmd_listen_thread (void *arg)
 	          text_color_set(DW_COLOR_ERROR);
 		  dw_printf ("Failed to create frame from AGW 'M' message.\n");
 		}
+		else if ( ! tq_wait_while_full (cmd.hdr.portx)) {
+		  ax25_delete (pp);
+		}
 		else {
 		  tq_append (cmd.hdr.portx, TQ_PRIO_1_LO, pp);
 		}
@@ -33,6 +33,10 @@
  *
  * Revisions:	1.2 - Enhance for multiple audio devices.
  *
+ *		1.5 - Appending and counting no longer walk the whole list.
+ *		      Client applications can be made to wait when they
+ *		      get too far ahead of the transmitter.
+ *
  *---------------------------------------------------------------*/
 
 #define TQ_C 1
@@ -56,6 +60,40 @@
 
 static packet_t queue_head[MAX_CHANS][TQ_NUM_PRIO];	/* Head of linked list for each queue. */
 
+static packet_t queue_tail[MAX_CHANS][TQ_NUM_PRIO];	/* Version 1.5:  Last in each list so */
+							/* appending doesn't need to walk it. */
+
+static int queue_frames[MAX_CHANS][TQ_NUM_PRIO];	/* Version 1.5:  Running totals so */
+static int queue_bytes[MAX_CHANS][TQ_NUM_PRIO];		/* tq_count doesn't need to walk the list. */
+
+
+/*
+ * Version 1.5:  Counts by address for the AGW 'Y' query.
+ *
+ * Each frame is counted three times:  by source and destination,
+ * by source with "" for destination, and by destination with ""
+ * for source.  An empty string means any, as it does for tq_count.
+ * Entries are removed when the count goes back to zero.
+ */
+
+#define TQ_ADDR_HASH 64
+
+struct tq_addr_count_s {
+	struct tq_addr_count_s *next;		/* Next in same hash bucket. */
+	int chan;
+	int prio;
+	char source[AX25_MAX_ADDR_LEN];
+	char dest[AX25_MAX_ADDR_LEN];
+	int frames;
+	int bytes;
+};
+
+static struct tq_addr_count_s *addr_count[TQ_ADDR_HASH];
+
+static void count_frame (int chan, int prio, packet_t pp, int add);
+
+static void queue_append (int chan, int prio, packet_t pp);
+
 
 static dw_mutex_t tq_mutex;				/* Critical section for updating queues. */
 							/* Just one for all queues. */
@@ -130,8 +168,12 @@ void tq_init (struct audio_s *audio_config_p)
 	for (c=0; c<MAX_CHANS; c++) {
 	  for (p=0; p<TQ_NUM_PRIO; p++) {
 	    queue_head[c][p] = NULL;
+	    queue_tail[c][p] = NULL;
+	    queue_frames[c][p] = 0;
+	    queue_bytes[c][p] = 0;
 	  }
 	}
+	memset (addr_count, 0, sizeof(addr_count));
 
 /*
  * Mutex to coordinate access to the queue.
@@ -206,7 +248,7 @@ void tq_init (struct audio_s *audio_config_p)
  * Outputs:	
  *
  * Description:	Add packet to end of linked list.
- *		Signal the transmit thread if the queue was formerly empty.
+ *		Signal the transmit thread if it is waiting.
  *
  *		Note that we have a transmit thread each audio channel.
  *		Two channels can share one audio output device.
@@ -218,9 +260,6 @@ void tq_init (struct audio_s *audio_config_p)
 
 void tq_append (int chan, int prio, packet_t pp)
 {
-	packet_t plast;
-	packet_t pnext;
-
 
 #if DEBUG
 	unsigned char *pinfo;
@@ -294,20 +333,7 @@ void tq_append (int chan, int prio, packet_t pp)
 	dw_printf ("tq_append: enter critical section\n");
 #endif
 
-	dw_mutex_lock (&tq_mutex);
-
-	if (queue_head[chan][prio] == NULL) {
-	  queue_head[chan][prio] = pp;
-	}
-	else {
-	  plast = queue_head[chan][prio];
-	  while ((pnext = ax25_get_nextp(plast)) != NULL) {
-	    plast = pnext;
-	  }
-	  ax25_set_nextp (plast, pp);
-	}
-
-	dw_mutex_unlock (&tq_mutex);
+	queue_append (chan, prio, pp);
 
 
 #if DEBUG
@@ -418,9 +444,6 @@ void tq_append (int chan, int prio, packet_t pp)
 
 void lm_data_request (int chan, int prio, packet_t pp)
 {
-	packet_t plast;
-	packet_t pnext;
-
 
 #if DEBUG
 	unsigned char *pinfo;
@@ -469,21 +492,7 @@ void lm_data_request (int chan, int prio, packet_t pp)
 	dw_printf ("lm_data_request: enter critical section\n");
 #endif
 
-	dw_mutex_lock (&tq_mutex);
-
-
-	if (queue_head[chan][prio] == NULL) {
-	  queue_head[chan][prio] = pp;
-	}
-	else {
-	  plast = queue_head[chan][prio];
-	  while ((pnext = ax25_get_nextp(plast)) != NULL) {
-	    plast = pnext;
-	  }
-	  ax25_set_nextp (plast, pp);
-	}
-
-	dw_mutex_unlock (&tq_mutex);
+	queue_append (chan, prio, pp);
 
 
 #if DEBUG
@@ -590,9 +599,6 @@ void lm_seize_request (int chan)
 	packet_t pp;
 	int prio = TQ_PRIO_1_LO;
 
-	packet_t plast;
-	packet_t pnext;
-
 
 #if DEBUG
 	unsigned char *pinfo;
@@ -621,21 +627,7 @@ void lm_seize_request (int chan)
 	dw_printf ("lm_seize_request: enter critical section\n");
 #endif
 
-	dw_mutex_lock (&tq_mutex);
-
-
-	if (queue_head[chan][prio] == NULL) {
-	  queue_head[chan][prio] = pp;
-	}
-	else {
-	  plast = queue_head[chan][prio];
-	  while ((pnext = ax25_get_nextp(plast)) != NULL) {
-	    plast = pnext;
-	  }
-	  ax25_set_nextp (plast, pp);
-	}
-
-	dw_mutex_unlock (&tq_mutex);
+	queue_append (chan, prio, pp);
 
 
 #if DEBUG
@@ -672,6 +664,220 @@ void lm_seize_request (int chan)
 
 
 
+/*-------------------------------------------------------------------
+ *
+ * Name:        queue_append
+ *
+ * Purpose:     Version 1.5:  Common part of tq_append, lm_data_request,
+ *		and lm_seize_request.  Add to end of list and update counts.
+ *
+ *--------------------------------------------------------------------*/
+
+static void queue_append (int chan, int prio, packet_t pp)
+{
+	dw_mutex_lock (&tq_mutex);
+
+	ax25_set_nextp (pp, NULL);
+
+	if (queue_tail[chan][prio] == NULL) {
+	  queue_head[chan][prio] = pp;
+	}
+	else {
+	  ax25_set_nextp (queue_tail[chan][prio], pp);
+	}
+	queue_tail[chan][prio] = pp;
+
+	count_frame (chan, prio, pp, 1);
+
+	dw_mutex_unlock (&tq_mutex);
+}
+
+
+
+/*-------------------------------------------------------------------
+ *
+ * Name:        count_frame
+ *
+ * Purpose:     Version 1.5:  Keep the running counts used by tq_count.
+ *
+ * Inputs:	chan, prio	- Which queue.
+ *		pp		- Frame being added or removed.
+ *		add		- True when adding, false when removing.
+ *
+ * Description:	Must be called with tq_mutex held.
+ *		The frame must not be changed while it is in the queue
+ *		so we get the same length and addresses each time.
+ *
+ *--------------------------------------------------------------------*/
+
+static unsigned int addr_hash (int chan, int prio, const char *source, const char *dest)
+{
+	unsigned int h = chan * 2 + prio;
+
+	while (*source != '\0') h = h * 31 + (unsigned char)(*source++);
+	h = h * 31 + ' ';
+	while (*dest != '\0') h = h * 31 + (unsigned char)(*dest++);
+
+	return (h % TQ_ADDR_HASH);
+}
+
+static void count_addr (int chan, int prio, const char *source, const char *dest, int len, int add)
+{
+	struct tq_addr_count_s **pp = &(addr_count[addr_hash(chan, prio, source, dest)]);
+	struct tq_addr_count_s *p;
+
+	while ((p = *pp) != NULL) {
+	  if (p->chan == chan && p->prio == prio && strcmp(p->source, source) == 0 && strcmp(p->dest, dest) == 0) {
+	    break;
+	  }
+	  pp = &(p->next);
+	}
+
+	if (add) {
+	  if (p == NULL) {
+	    p = calloc (1, sizeof(struct tq_addr_count_s));
+	    if (p == NULL) {
+	      text_color_set(DW_COLOR_ERROR);
+	      dw_printf ("FATAL: Out of memory for transmit queue.\n");
+	      exit (1);
+	    }
+	    p->chan = chan;
+	    p->prio = prio;
+	    strlcpy (p->source, source, sizeof(p->source));
+	    strlcpy (p->dest, dest, sizeof(p->dest));
+	    *pp = p;
+	  }
+	  p->frames++;
+	  p->bytes += len;
+	}
+	else if (p != NULL) {
+	  p->frames--;
+	  p->bytes -= len;
+	  if (p->frames <= 0) {
+	    *pp = p->next;
+	    free (p);
+	  }
+	}
+}
+
+static void count_frame (int chan, int prio, packet_t pp, int add)
+{
+	int len = ax25_get_frame_len(pp);
+
+	if (add) {
+	  queue_frames[chan][prio]++;
+	  queue_bytes[chan][prio] += len;
+	}
+	else {
+	  queue_frames[chan][prio]--;
+	  queue_bytes[chan][prio] -= len;
+	}
+
+	/* Empty frame from lm_seize_request has no addresses. */
+
+	if (ax25_get_num_addr(pp) >= AX25_MIN_ADDRS) {
+	  char source[AX25_MAX_ADDR_LEN];
+	  char dest[AX25_MAX_ADDR_LEN];
+
+	  ax25_get_addr_with_ssid (pp, AX25_SOURCE, source);
+	  ax25_get_addr_with_ssid (pp, AX25_DESTINATION, dest);
+
+	  count_addr (chan, prio, source, dest, len, add);
+	  count_addr (chan, prio, source, "", len, add);
+	  count_addr (chan, prio, "", dest, len, add);
+	}
+}
+
+
+
+/*-------------------------------------------------------------------
+ *
+ * Name:        tq_wait_while_full
+ *
+ * Purpose:     Version 1.5:  Make a client application wait when it
+ *		gets too far ahead of the transmitter.
+ *
+ * Inputs:	chan	- Channel, 0 is first.
+ *
+ * Returns:	1 if the frame can be added to the queue.
+ *		0 if the queue stayed full for TQ_FULL_TIMEOUT.
+ *		The caller should discard the frame.
+ *
+ * Description:	Called before tq_append by the threads taking data frames
+ *		from KISS and AGW client applications.  While we wait here,
+ *		nothing more is read from the client so TCP flow control,
+ *		or the serial port, pushes back on the application.
+ *		Previously the queue would just keep growing.
+ *
+ *		The limit is TXQUEUE_LIMIT frames, both priorities,
+ *		in the configuration file.  0 for no limit.
+ *
+ *		A channel that can't transmit, because of a stuck
+ *		carrier detect or PTT, must not hang the client interface
+ *		forever.  After waiting TQ_FULL_TIMEOUT, we give up and
+ *		then discard frames, without waiting, until the queue is
+ *		no longer full.
+ *
+ *		Other producers, such as the digipeater and beacons,
+ *		must never wait.  They are limited only by the check
+ *		in tq_append.
+ *
+ *--------------------------------------------------------------------*/
+
+#define TQ_FULL_TIMEOUT 30	/* Seconds. */
+
+static int full_gave_up[MAX_CHANS];	/* Discarding until not full.  Protected by tq_mutex. */
+
+int tq_wait_while_full (int chan)
+{
+	int limit;
+	int waited = 0;
+
+	if (chan < 0 || chan >= MAX_CHANS || ! save_audio_config_p->achan[chan].valid) {
+	  return (1);		/* tq_append will complain. */
+	}
+
+	limit = save_audio_config_p->achan[chan].txqueue_limit;
+	if (limit <= 0) {
+	  return (1);
+	}
+
+	while (1) {
+	  int full, gave_up, now_giving_up = 0;
+
+	  dw_mutex_lock (&tq_mutex);
+
+	  full = queue_frames[chan][TQ_PRIO_0_HI] + queue_frames[chan][TQ_PRIO_1_LO] >= limit;
+	  if ( ! full) {
+	    full_gave_up[chan] = 0;
+	  }
+	  else if ( ! full_gave_up[chan] && waited >= TQ_FULL_TIMEOUT * 10) {
+	    full_gave_up[chan] = 1;
+	    now_giving_up = 1;
+	  }
+	  gave_up = full_gave_up[chan];
+
+	  dw_mutex_unlock (&tq_mutex);
+
+	  if ( ! full) {
+	    return (1);
+	  }
+	  if (now_giving_up) {
+	    text_color_set(DW_COLOR_ERROR);
+	    dw_printf ("Transmit queue for channel %d has been full for %d seconds.\n", chan, TQ_FULL_TIMEOUT);
+	    dw_printf ("Discarding frames from client applications until it can transmit again.\n");
+	  }
+	  if (gave_up) {
+	    return (0);
+	  }
+
+	  SLEEP_MS(100);
+	  waited++;
+	}
+}
+
+
+
 /*-------------------------------------------------------------------
  *
  * Name:        tq_wait_while_empty
@@ -802,6 +1008,10 @@ packet_t tq_remove (int chan, int prio)
 	  result_p = queue_head[chan][prio];
 	  queue_head[chan][prio] = ax25_get_nextp(result_p);
 	  ax25_set_nextp (result_p, NULL);
+	  if (queue_head[chan][prio] == NULL) {
+	    queue_tail[chan][prio] = NULL;
+	  }
+	  count_frame (chan, prio, result_p, 0);
 	}
 	 
 	dw_mutex_unlock (&tq_mutex);
@@ -932,8 +1142,6 @@ static int tq_is_empty (int chan)
 
 int tq_count (int chan, int prio, char *source, char *dest, int bytes)
 {
-
-	packet_t pp;
 	int n;
 
 	if (prio == -1) {
@@ -949,39 +1157,28 @@ int tq_count (int chan, int prio, char *source, char *dest, int bytes)
 	  return (0);
 	}
 
-	if (queue_head[chan][prio] == 0) {
-	  return (0);
-	}
-
-	// Don't want lists being rearranged while we are traversing them.
+	if (source == NULL) source = "";
+	if (dest == NULL) dest = "";
 
+/*
+ * Version 1.5:  Use the running counts rather than walking the list
+ * and extracting addresses from every frame.
+ */
 	dw_mutex_lock (&tq_mutex);
 
-	n = 0;
-	pp = queue_head[chan][prio];
-	while (pp != NULL) {
-	  int count_it = 1;
-
-	  if (source != NULL && *source != '\0') {
-	    char frame_source[AX25_MAX_ADDR_LEN];
-	    ax25_get_addr_with_ssid (pp, AX25_SOURCE, frame_source);
-	    if (strcmp(source,frame_source) != 0) count_it = 0;
-	  }
-	  if (count_it && dest != NULL && *dest != '\0') {
-	    char frame_dest[AX25_MAX_ADDR_LEN];
-	    ax25_get_addr_with_ssid (pp, AX25_DESTINATION, frame_dest);
-	    if (strcmp(dest,frame_dest) != 0) count_it = 0;
-	  }
+	if (*source == '\0' && *dest == '\0') {
+	  n = bytes ? queue_bytes[chan][prio] : queue_frames[chan][prio];
+	}
+	else {
+	  struct tq_addr_count_s *p;
 
-	  if (count_it) {
-	    if (bytes) {
-	      n += ax25_get_frame_len(pp);
-	    }
-	    else {
-	      n++;
+	  n = 0;
+	  for (p = addr_count[addr_hash(chan, prio, source, dest)]; p != NULL; p = p->next) {
+	    if (p->chan == chan && p->prio == prio && strcmp(p->source, source) == 0 && strcmp(p->dest, dest) == 0) {
+	      n = bytes ? p->bytes : p->frames;
+	      break;
 	    }
 	  }
-	  pp = ax25_get_nextp(pp);
 	}
 
 	dw_mutex_unlock (&tq_mutex);